@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# DenseKernelCheck -- compares every vectorized
+# dense kernel path the cpu supports with the
+# plain C++ one, bit for bit (see ops/MatrixUtil.cpp)
+#
+#   qmake DenseKernelCheck.pro && make && ./DenseKernelCheck
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET   = DenseKernelCheck
+TEMPLATE = app
+
+unix:  QMAKE_CXXFLAGS_WARN_ON = -Wall -Wno-unused-variable -std=c++11
+win32: QMAKE_CXXFLAGS += /Y- -wd"4100"
+
+include(OPS_includes.pro)
+
+SOURCES += \
+        kernelcheck/main.cpp
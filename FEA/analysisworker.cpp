@@ -0,0 +1,153 @@
+#include "analysisworker.h"
+
+#include <QMutexLocker>
+#include <QMetaObject>
+#include <QThread>
+
+typedef QList<QVector<QVector<double> *> *> (PileFEAmodeler::*ResultGetter)();
+
+static const QList<QPair<PilePlotData, ResultGetter>> RESULT_GETTERS = {
+    {PilePlotData::LateralDisplacement, &PileFEAmodeler::getLateralDisplacements},
+    {PilePlotData::AxialDisplacement,   &PileFEAmodeler::getAxialDisplacements},
+    {PilePlotData::PileMoment,          &PileFEAmodeler::getMoment},
+    {PilePlotData::PileShear,           &PileFEAmodeler::getShear},
+    {PilePlotData::PileAxialForce,      &PileFEAmodeler::getForce},
+    {PilePlotData::SoilStress,          &PileFEAmodeler::getStress},
+    {PilePlotData::Pultimate,           &PileFEAmodeler::getPult},
+    {PilePlotData::Y50,                 &PileFEAmodeler::getY50},
+    {PilePlotData::Tultimate,           &PileFEAmodeler::getTult},
+    {PilePlotData::Z50,                 &PileFEAmodeler::getZ50}
+};
+
+AnalysisWorker::AnalysisWorker(QObject *parent) : QObject(parent)
+{
+    qRegisterMetaType<AnalysisResults>("AnalysisResults");
+
+    theModeler = new PileFEAmodeler();
+    theModeler->setNumThreads(QThread::idealThreadCount());
+}
+
+AnalysisWorker::~AnalysisWorker()
+{
+    if (theModeler != nullptr) delete theModeler;
+}
+
+/* ******** called from the GUI thread ******** */
+
+void AnalysisWorker::submit(const AnalysisRequest &request)
+{
+    QMutexLocker lock(&requestMutex);
+
+    // the newest model state replaces anything not yet started ...
+    pendingRequest    = request;
+    hasPendingRequest = true;
+
+    // ... and whatever is being analyzed right now is outdated
+    theModeler->requestAbort();
+
+    if (!isScheduled)
+    {
+        isScheduled = true;
+        QMetaObject::invokeMethod(this, "processPending", Qt::QueuedConnection);
+    }
+}
+
+void AnalysisWorker::cancel()
+{
+    QMutexLocker lock(&requestMutex);
+
+    hasPendingRequest = false;
+    theModeler->requestAbort();
+}
+
+/* ******** executed in the worker thread ******** */
+
+void AnalysisWorker::processPending()
+{
+    AnalysisRequest request;
+
+    {
+        QMutexLocker lock(&requestMutex);
+
+        isScheduled = false;
+        if (!hasPendingRequest) return;
+
+        request           = pendingRequest;
+        hasPendingRequest = false;
+
+        theModeler->clearAbort();
+    }
+
+    this->configureModel(request);
+
+    bool converged = theModeler->doAnalysis();
+
+    // a newer request is already queued -- don't bother extracting stale data
+    if (theModeler->abortRequested()) return;
+
+    AnalysisResults results;
+    results.serial    = request.serial;
+    results.converged = converged;
+
+    this->collectResults(results);
+
+    emit resultsReady(results);
+}
+
+void AnalysisWorker::exportModel(QString filename)
+{
+    theModeler->writeFEMinput(filename);
+}
+
+void AnalysisWorker::configureModel(const AnalysisRequest &request)
+{
+    QVector<PILE_INFO>  pileInfo    = request.pileInfo;
+    QVector<soilLayer>  soilLayers  = request.soilLayers;
+    QVector<double>     dispProfile = request.dispProfile;
+
+    theModeler->updatePiles(pileInfo);
+    theModeler->setMeshParameters(request.minElementsPerLayer, request.maxElementsPerLayer, request.numElementsInAir);
+    theModeler->setWinklerElements(request.useWinklerElements);
+    theModeler->updateSwitches(request.useToeResistance, request.assumeRigidPileHeadConnection);
+    theModeler->updateSoil(soilLayers);
+    theModeler->updateGWtable(request.gwtDepth);
+    theModeler->setLoadType(request.loadControlType);
+
+    switch (request.loadControlType) {
+    case LoadControlType::ForceControl:
+        theModeler->updateLoad(request.P, request.PV, request.PMom);
+        break;
+    case LoadControlType::PushOver:
+        theModeler->updateDisplacement(request.HDisp, request.VDisp);
+        break;
+    case LoadControlType::SoilMotion:
+        theModeler->updateDispProfile(dispProfile);
+        break;
+    }
+}
+
+void AnalysisWorker::collectResults(AnalysisResults &results)
+{
+    bool haveLocation = false;
+
+    for (const QPair<PilePlotData, ResultGetter> &item : RESULT_GETTERS)
+    {
+        QList<QVector<QVector<double> *> *> list = (theModeler->*item.second)();
+        if (list.size() < 2) continue;
+
+        if (!haveLocation)
+        {
+            foreach (QVector<double> *vec, *list[0])
+            {
+                results.location.append(vec != nullptr ? *vec : QVector<double>());
+            }
+            haveLocation = true;
+        }
+
+        QVector<QVector<double>> &data = results.values[item.first];
+        foreach (QVector<double> *vec, *list[1])
+        {
+            data.append(vec != nullptr ? *vec : QVector<double>());
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef ANALYSISWORKER_H
+#define ANALYSISWORKER_H
+
+#include <QObject>
+#include <QMutex>
+#include <QVector>
+#include <QMap>
+#include <QMetaType>
+
+#include "pilegrouptool_parameters.h"
+#include "pilefeamodeler.h"
+#include "soilmat.h"
+
+/*
+ * complete model state as entered in the main window
+ */
+struct AnalysisRequest {
+    int serial = -1;
+
+    QVector<PILE_INFO> pileInfo;
+    bool useToeResistance              = true;
+    bool assumeRigidPileHeadConnection = false;
+
+    QVector<soilLayer> soilLayers;
+    double gwtDepth = 0.0;
+
+    int minElementsPerLayer = MIN_ELEMENTS_PER_LAYER;
+    int maxElementsPerLayer = MAX_ELEMENTS_PER_LAYER;
+    int numElementsInAir    = NUM_ELEMENTS_IN_AIR;
+    bool useWinklerElements = false;
+
+    LoadControlType loadControlType = LoadControlType::ForceControl;
+    double P     = 0.0;  // lateral force on pile cap
+    double PV    = 0.0;  // vertical force on pile cap
+    double PMom  = 0.0;  // applied moment on pile cap
+    double HDisp = 0.0;  // prescribed horizontal displacement
+    double VDisp = 0.0;  // prescribed vertical displacement
+    QVector<double> dispProfile;  // surface displacement and percentages at interfaces/base
+};
+
+/*
+ * deep copy of the plot data of one analysis; owned by the receiver
+ */
+struct AnalysisResults {
+    int  serial    = -1;
+    bool converged = false;
+
+    QVector<QVector<double>>                     location;  // node depths per pile
+    QMap<PilePlotData, QVector<QVector<double>>> values;    // per quantity, per pile
+};
+
+Q_DECLARE_METATYPE(AnalysisResults)
+
+/*
+ * AnalysisWorker owns a PileFEAmodeler and is meant to live in its own
+ * thread.  submit() may be called from any thread and never blocks on
+ * the analysis: only the newest pending request is kept, and a running
+ * analysis is aborted as soon as a newer request arrives.  Results of
+ * completed (not aborted) analyses are delivered via resultsReady().
+ */
+class AnalysisWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit AnalysisWorker(QObject *parent = nullptr);
+    ~AnalysisWorker();
+
+    void submit(const AnalysisRequest &);
+    void cancel();
+
+public slots:
+    void exportModel(QString filename);
+
+signals:
+    void resultsReady(const AnalysisResults &);
+
+private slots:
+    void processPending();
+
+private:
+    void configureModel(const AnalysisRequest &);
+    void collectResults(AnalysisResults &);
+
+    PileFEAmodeler *theModeler = nullptr;
+
+    QMutex          requestMutex;
+    AnalysisRequest pendingRequest;
+    bool            hasPendingRequest = false;
+    bool            isScheduled       = false;
+};
+
+#endif // ANALYSISWORKER_H
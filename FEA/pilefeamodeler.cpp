@@ -5,6 +5,8 @@
 #include <QVector>
 #include <QTextStream>
 #include <QDateTime>
+#include <QStringList>
+#include <cmath>
 
 extern int getTzParam(double phi, double b, double sigV, double pEleLength, double *tult, double *z50);
 extern int getQzParam(double phiDegree, double b, double sigV, double G, double *qult, double *z50);
@@ -25,18 +27,23 @@ extern int getPyParam(double pyDepth,
 #include <SP_Constraint.h>
 #include <MP_Constraint.h>
 #include <Domain.h>
+#include <ObjectArena.h>
+#include <DenseArrayOfTaggedObjects.h>
+#include <MapOfTaggedObjects.h>
 #include <StandardStream.h>
 #include <LinearCrdTransf3d.h>
-#include <DispBeamColumn3d.h>
+#include <VerticalCrdTransf3d.h>
+#include <ElasticBeam3d.h>
 #include <PySimple1.h>
 #include <TzSimple1.h>
 #include <QzSimple1.h>
-#include <ZeroLength.h>
-#include <LegendreBeamIntegration.h>
-#include <ElasticSection3d.h>
+#include <GroundedSpring.h>
+#include <GroundDisplacement.h>
+#include <WinklerFoundation3d.h>
 #include <LinearSeries.h>
 #include <NodalLoad.h>
 #include <LoadPattern.h>
+#include <Parameter.h>
 #include <SimulationInformation.h>
 
 #include <NodeIter.h>
@@ -45,25 +52,80 @@ extern int getPyParam(double pyDepth,
 #include <MP_ConstraintIter.h>
 #include <LoadPatternIter.h>
 
-#include <LoadControl.h>
+#include <AdaptiveLoadControl.h>
 #include <RCM.h>
 #include <PlainNumberer.h>
 #include <NewtonRaphson.h>
+#include <ModifiedNewton.h>
+#include <Broyden.h>
+#include <BFGS.h>
+#include <KrylovNewton.h>
+#include <NewtonLineSearch.h>
+#include <BisectionLineSearch.h>
+#include <SecantLineSearch.h>
+#include <RegulaFalsiLineSearch.h>
 #include <CTestNormDispIncr.h>
 #include <TransformationConstraintHandler.h>
 #include <PenaltyConstraintHandler.h>
-#include <BandGenLinSOE.h>
-#include <BandGenLinLapackSolver.h>
+#include <PileChainLinSOE.h>
+#include <PileChainLinLapackSolver.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
 #include <StaticAnalysis.h>
 #include <AnalysisModel.h>
 
 #include <soilmat.h>
+
 #include <QDebug>
 
+/*
+ * convergence test giving up as soon as the abort flag of the
+ * modeler is raised, e.g., because a newer model state is waiting
+ */
+class AbortableNormDispIncr : public CTestNormDispIncr
+{
+public:
+    AbortableNormDispIncr(double tol, int maxNumIter, int printFlag, QAtomicInt *flag)
+        : CTestNormDispIncr(tol, maxNumIter, printFlag), abortFlag(flag) {}
+
+    int test(void)
+    {
+        if (abortFlag->loadAcquire()) return -2;
+        return CTestNormDispIncr::test();
+    }
+
+private:
+    QAtomicInt *abortFlag;
+};
+
 
 #define SET_3_NDOF if (nDOFs != 3) { nDOFs = 3; out << "model BasicBuilder -ndm 3 -ndf " << nDOFs << " ;" << endl; }
 #define SET_6_NDOF if (nDOFs != 6) { nDOFs = 6; out << "model BasicBuilder -ndm 3 -ndf " << nDOFs << " ;" << endl; }
 
+// ElasticBeam3d parameters of pile and pile cap elements (see updateMeshParameters)
+static const char *PILE_SECTION_PARAMETERS[NUM_SECTION_PARAMETERS] = {"E", "A", "Iz", "Iy", "G"};
+static const char *CAP_SECTION_PARAMETERS[NUM_SECTION_PARAMETERS]  = {"A", "Iz", "Iy", "G", "J"};
+
+// solution algorithms accepted by setAnalysisType() -- named as in OpenSees
+static const QStringList SOLUTION_ALGORITHMS = {"Newton", "ModifiedNewton", "Broyden", "BFGS", "KrylovNewton"};
+
+// line searches accepted by setLineSearch() -- used by Newton and ModifiedNewton
+static const QStringList LINE_SEARCHES = {"None", "Bisection", "Secant", "RegulaFalsi"};
+
+// systems of equations accepted by setSystemOfEquations():
+//   PileChain -- block-tridiagonal piles coupled through the cap (Schur complement)
+//   BandSPD   -- banded Cholesky with a general-band fallback, for meshes that do
+//                not form chains joined at the cap, and for comparison
+static const QStringList SYSTEMS_OF_EQUATIONS = {"PileChain", "BandSPD"};
+
+// strategies accepted by setFallbackStrategies(), the default cascade in order.
+// Each one adds to those before it:
+//   LineSearch        -- Newton with a line search (Bisection unless one is selected)
+//   SmallerStep       -- the failed step is halved down to MIN_LOAD_INCREMENT
+//   InitialTangent    -- Newton on the initial stiffness
+//   ConstraintHandler -- the constraints are enforced by penalty instead of elimination
+static const QStringList FALLBACK_STRATEGIES = {"LineSearch", "SmallerStep", "InitialTangent", "ConstraintHandler"};
+
 PileFEAmodeler::PileFEAmodeler()
 {
     // set default parameters
@@ -75,7 +137,13 @@ PileFEAmodeler::PileFEAmodeler()
     modelState.insert(AnalysisState::loadValid, false);
     modelState.insert(AnalysisState::analysisValid, false);
 
-    theDomain = new Domain();
+    // node and element tags are assigned in dense ranges by buildMesh()
+    theDomain = new Domain(*(new DenseArrayOfTaggedObjects()),
+                           *(new DenseArrayOfTaggedObjects()),
+                           *(new MapOfTaggedObjects()),
+                           *(new MapOfTaggedObjects()),
+                           *(new MapOfTaggedObjects()));
+    meshArena = new ObjectArena();
 
     numLoadedNode = -1;
 
@@ -84,13 +152,26 @@ PileFEAmodeler::PileFEAmodeler()
     /* set default parameters */
     this->setDefaultParameters();
 
+    fallbackStrategies = FALLBACK_STRATEGIES;
+
     dumpFEMinput = false;
 }
 
 PileFEAmodeler::~PileFEAmodeler()
 {
+    if (theAnalysis != nullptr)
+    {
+        theAnalysis->clearAll();
+        delete theAnalysis;
+        theAnalysis = nullptr;
+    }
+
     delete theDomain;
     theDomain = nullptr;
+
+    // after theDomain, which holds the objects taken from it
+    delete meshArena;
+    meshArena = nullptr;
 }
 
 
@@ -313,10 +394,232 @@ void PileFEAmodeler::updateDispProfile(QVector<double> &profile)
     this->updateMotionData();
 }
 
-void PileFEAmodeler::setAnalysisType(QString)
+void PileFEAmodeler::setMeshParameters(int minElemPerLayer, int maxElemPerLayer, int numElemInAir)
 {
-    qWarning() << "PileFEAmodeler::setAnalysisType(QString) not implemented";
-    DISABLE_STATE(AnalysisState::analysisValid);
+    if (minElemPerLayer != minElementsPerLayer ||
+        maxElemPerLayer != maxElementsPerLayer ||
+        numElemInAir    != numElementsInAir      )
+    {
+        minElementsPerLayer = minElemPerLayer;
+        maxElementsPerLayer = maxElemPerLayer;
+        numElementsInAir    = numElemInAir;
+
+        DISABLE_STATE(AnalysisState::meshValid);
+        DISABLE_STATE(AnalysisState::solutionValid);
+        DISABLE_STATE(AnalysisState::solutionAvailable);
+        DISABLE_STATE(AnalysisState::dataExtracted);
+    }
+}
+
+void PileFEAmodeler::setWinklerElements(bool flag)
+{
+    if (flag != useWinklerElements)
+    {
+        useWinklerElements = flag;
+
+        DISABLE_STATE(AnalysisState::meshValid);
+        DISABLE_STATE(AnalysisState::solutionValid);
+        DISABLE_STATE(AnalysisState::solutionAvailable);
+        DISABLE_STATE(AnalysisState::dataExtracted);
+    }
+}
+
+void PileFEAmodeler::setNumThreads(int n)
+{
+    // results do not depend on the number of threads -- no state change
+    numThreads = (n > 0) ? n : 1;
+
+    theDomain->setNumThreads(numThreads);
+}
+
+void PileFEAmodeler::setIncrementalReload(bool flag)
+{
+    // takes effect with the next load change
+    incrementalReload = flag;
+}
+
+void PileFEAmodeler::setAnalysisType(QString type)
+{
+    int idx = -1;
+    for (int k=0; k<SOLUTION_ALGORITHMS.size(); k++) {
+        if (type.compare(SOLUTION_ALGORITHMS[k], Qt::CaseInsensitive) == 0) idx = k;
+    }
+
+    if (idx < 0)
+    {
+        qWarning() << "PileFEAmodeler::setAnalysisType(QString) -- unknown solution algorithm" << type;
+        return;
+    }
+
+    if (SOLUTION_ALGORITHMS[idx] != solutionAlgorithm)
+    {
+        solutionAlgorithm = SOLUTION_ALGORITHMS[idx];
+        DISABLE_STATE(AnalysisState::analysisValid);
+    }
+}
+
+void PileFEAmodeler::setLineSearch(QString type)
+{
+    int idx = -1;
+    for (int k=0; k<LINE_SEARCHES.size(); k++) {
+        if (type.compare(LINE_SEARCHES[k], Qt::CaseInsensitive) == 0) idx = k;
+    }
+
+    if (idx < 0)
+    {
+        qWarning() << "PileFEAmodeler::setLineSearch(QString) -- unknown line search" << type;
+        return;
+    }
+
+    if (LINE_SEARCHES[idx] != lineSearchType)
+    {
+        lineSearchType = LINE_SEARCHES[idx];
+        DISABLE_STATE(AnalysisState::analysisValid);
+    }
+}
+
+void PileFEAmodeler::setSystemOfEquations(QString system)
+{
+    int idx = -1;
+    for (int k=0; k<SYSTEMS_OF_EQUATIONS.size(); k++) {
+        if (system.compare(SYSTEMS_OF_EQUATIONS[k], Qt::CaseInsensitive) == 0) idx = k;
+    }
+
+    if (idx < 0)
+    {
+        qWarning() << "PileFEAmodeler::setSystemOfEquations(QString) -- unknown system" << system;
+        return;
+    }
+
+    if (SYSTEMS_OF_EQUATIONS[idx] != systemOfEquations)
+    {
+        systemOfEquations = SYSTEMS_OF_EQUATIONS[idx];
+        DISABLE_STATE(AnalysisState::analysisValid);
+    }
+}
+
+void PileFEAmodeler::setFallbackStrategies(QStringList strategies)
+{
+    // an empty list makes the first step that fails to converge final
+    QStringList newStrategies;
+
+    foreach (QString strategy, strategies)
+    {
+        int idx = -1;
+        for (int k=0; k<FALLBACK_STRATEGIES.size(); k++) {
+            if (strategy.compare(FALLBACK_STRATEGIES[k], Qt::CaseInsensitive) == 0) idx = k;
+        }
+
+        if (idx < 0)
+            qWarning() << "PileFEAmodeler::setFallbackStrategies(QStringList) -- unknown strategy" << strategy;
+        else if (!newStrategies.contains(FALLBACK_STRATEGIES[idx]))
+            newStrategies.append(FALLBACK_STRATEGIES[idx]);
+    }
+
+    // takes effect at the next failed step, the analysis is not affected
+    fallbackStrategies = newStrategies;
+}
+
+LineSearch *PileFEAmodeler::createLineSearch(QString type)
+{
+    if (type == "Bisection")   return new BisectionLineSearch();
+    if (type == "Secant")      return new SecantLineSearch();
+    if (type == "RegulaFalsi") return new RegulaFalsiLineSearch();
+
+    return nullptr;
+}
+
+EquiSolnAlgo *PileFEAmodeler::createSolutionAlgorithm(QString algorithm, QString lineSearch, int tangent)
+{
+    // all but Newton keep the factored tangent for several iterations
+    if (algorithm == "ModifiedNewton") return new ModifiedNewton(tangent, 0, 0.5, this->createLineSearch(lineSearch));
+    if (algorithm == "Broyden")        return new Broyden(tangent, 10);
+    if (algorithm == "BFGS")           return new BFGS(tangent, 10);
+    if (algorithm == "KrylovNewton")   return new KrylovNewton(tangent, 3);
+
+    LineSearch *theLineSearch = this->createLineSearch(lineSearch);
+    if (theLineSearch != nullptr) return new NewtonLineSearch(theLineSearch, tangent);
+
+    return new NewtonRaphson(tangent);
+}
+
+ConstraintHandler *PileFEAmodeler::createConstraintHandler(bool alternate)
+{
+    if (alternate) return new PenaltyConstraintHandler(1.0e14, 1.0e14);
+
+    // the constrained dofs are eliminated from the SOE: the pile heads
+    // share the cap node equations
+    return new TransformationConstraintHandler();
+}
+
+LinearSOE *PileFEAmodeler::createLinearSOE(QString system)
+{
+    theChainSOE    = nullptr;
+    theChainSolver = nullptr;
+
+    if (system == "BandSPD") return new BandSPDLinSOE(*new BandSPDLinLapackSolver());
+
+    theChainSolver = new PileChainLinLapackSolver();
+    theChainSOE    = new PileChainLinSOE(*theChainSolver);
+
+    return theChainSOE;
+}
+
+void PileFEAmodeler::useSolutionAlgorithm(QString algorithm, QString lineSearch, int tangent)
+{
+    QString key = QString("%1/%2/%3").arg(algorithm).arg(lineSearch).arg(tangent);
+
+    if (key == algorithmInUse) return;
+
+    // replaces (and deletes) the current algorithm, keeps the convergence test
+    theAnalysis->setAlgorithm(*this->createSolutionAlgorithm(algorithm, lineSearch, tangent));
+    algorithmInUse = key;
+}
+
+void PileFEAmodeler::useSolutionStrategy(int level)
+{
+    // level 0 is the selected algorithm, level k adds fallbackStrategies[0..k-1]
+    QStringList strategies = fallbackStrategies.mid(0, level);
+
+    QString algorithm  = solutionAlgorithm;
+    QString lineSearch = lineSearchType;
+    int     tangent    = CURRENT_TANGENT;
+
+    if (strategies.contains("LineSearch"))
+    {
+        algorithm = "Newton";
+        if (lineSearch == "None") lineSearch = "Bisection";
+    }
+    if (strategies.contains("InitialTangent"))
+    {
+        algorithm = "Newton";
+        tangent   = INITIAL_TANGENT;
+    }
+
+    this->useSolutionAlgorithm(algorithm, lineSearch, tangent);
+
+    bool alternate = strategies.contains("ConstraintHandler");
+
+    if (alternate != alternateHandlerInUse)
+    {
+        // renumbers and resizes the SOE at the next step
+        theAnalysis->setConstraintHandler(*this->createConstraintHandler(alternate));
+        alternateHandlerInUse = alternate;
+    }
+}
+
+QString PileFEAmodeler::solutionStrategyName(int level)
+{
+    if (level > 0) return fallbackStrategies[level-1];
+
+    if (lineSearchType == "None") return solutionAlgorithm;
+
+    return solutionAlgorithm + "/" + lineSearchType;
+}
+
+QList<PileFEAmodeler::SolutionAttempt> PileFEAmodeler::getSolutionAttempts()
+{
+    return solutionAttempts;
 }
 
 bool PileFEAmodeler::doAnalysis()
@@ -324,6 +627,7 @@ bool PileFEAmodeler::doAnalysis()
     if (!CHECK_STATE(AnalysisState::meshValid))
     {
         this->buildMesh();
+        DISABLE_STATE(AnalysisState::loadValid);
         DISABLE_STATE(AnalysisState::analysisValid);
     }
     if (!CHECK_STATE(AnalysisState::loadValid))
@@ -343,7 +647,18 @@ bool PileFEAmodeler::doAnalysis()
     //
     //analyze & get results
     //
-    int converged = theAnalysis->analyze(20);
+    solutionAttempts.clear();
+
+    int converged = this->applyLoad();
+
+    // a continued load path that fails is retried from the unloaded state
+    if (converged < 0 && loadContinued && !this->abortRequested())
+    {
+        loadApplied = false;
+        this->buildLoad();
+        converged = this->applyLoad();
+    }
+
     theDomain->calculateNodalReactions(0);
 
     // the solution exists, but it may or may not be valid !
@@ -355,16 +670,67 @@ bool PileFEAmodeler::doAnalysis()
     {
         DISABLE_STATE(AnalysisState::solutionValid);
         isConverged = false;
+
+        // the load is only partially applied -- the next analysis starts over
+        DISABLE_STATE(AnalysisState::loadValid);
     }
     else
     {
         ENABLE_STATE(AnalysisState::solutionValid);
         isConverged = true;
+
+        // the committed state now carries the full load
+        loadApplied = true;
     }
 
     return isConverged;
 }
 
+int PileFEAmodeler::applyLoad()
+{
+    // steps grow while Newton converges quickly; a step that fails is retried
+    // with the fallback strategies in turn, each adding to the ones before it
+    theIntegrator->setDeltaLambda(LOAD_INCREMENT);
+
+    int converged = 0;
+    int level     = 0;    // fallback strategies in effect for the current step
+
+    while (!theIntegrator->isComplete())
+    {
+        double lambda = theModel->getCurrentDomainTime();
+
+        converged = theAnalysis->analyze(1);
+
+        solutionAttempts.append(SolutionAttempt(lambda, theIntegrator->getStepLambda(),
+                                                this->solutionStrategyName(level), converged,
+                                                theAnalysis->getConvergenceTest()->getNumTests()));
+
+        if (converged >= 0)
+        {
+            // the next step starts over with the selected algorithm
+            if (level > 0) this->useSolutionStrategy(level = 0);
+            continue;
+        }
+
+        if (this->abortRequested()) break;
+
+        // the failed step has been undone and its increment halved
+        bool cutBack = fallbackStrategies.mid(0, level).contains("SmallerStep");
+        if (cutBack && theIntegrator->canCutBack()) continue;
+
+        if (level == fallbackStrategies.size()) break;
+
+        // the next strategy repeats the failed step, unless it is the smaller step
+        if (fallbackStrategies[level] != "SmallerStep") theIntegrator->undoCutBack();
+        this->useSolutionStrategy(++level);
+    }
+
+    // leave the analysis set up for the selected algorithm
+    if (level > 0) this->useSolutionStrategy(0);
+
+    return converged;
+}
+
 void PileFEAmodeler::buildMesh()
 {
     if (CHECK_STATE(AnalysisState::meshValid)) return;
@@ -372,14 +738,6 @@ void PileFEAmodeler::buildMesh()
     QTextStream out(FEMfile);
     int materialIndex = 0;
     int nDOFs = 0;
-    excentricity = 0.0;
-
-    // clear the list of soil nodes == those nodes where p-y springs are attaching to the soil
-    soilNodes.clear();
-
-    for (int k=0; k<MAXPILES; k++) {
-        headNodeList[k] = {-1, -1, 0.0, 1.0, 1.0};
-    }
 
     if (dumpFEMinput)
     {
@@ -393,13 +751,6 @@ void PileFEAmodeler::buildMesh()
         out << endl;
     }
 
-    // clear existing model
-    theDomain->clearAll();
-    OPS_clearAllUniaxialMaterial();
-    ops_Dt = 0.0;
-
-    capNodeList.clear();
-
     //
     // find meshing parameters
     //
@@ -424,7 +775,8 @@ void PileFEAmodeler::buildMesh()
 
     for (int pileIdx=0; pileIdx<numPiles; pileIdx++)
     {
-        pileInfo[pileIdx].numNodePile = 2; // bottom plus surface node
+        // bottom plus surface node (with Winkler elements, the top layer ends at the surface node)
+        pileInfo[pileIdx].numNodePile = useWinklerElements ? 1 : 2;
         if (pileInfo[pileIdx].L1 > 0.0001) pileInfo[pileIdx].numNodePile += numElementsInAir; // free standing
 
         //
@@ -452,9 +804,23 @@ void PileFEAmodeler::buildMesh()
                 thickness = pileInfo[pileIdx].L2 - depthOfLayer[iLayer];
             }
 
-            int numElemThisLayer = int(thickness/pileInfo[pileIdx].pileDiameter);
-            if (numElemThisLayer < minElementsPerLayer) numElemThisLayer = minElementsPerLayer;
-            if (numElemThisLayer > maxElementsPerLayer) numElemThisLayer = maxElementsPerLayer;
+            int numElemThisLayer;
+            if (useWinklerElements) {
+                // the soil resistance is integrated along the elements; a mesh refined
+                // through setMeshParameters() refines the Winkler elements alike
+                double refinement = double(minElementsPerLayer)/MIN_ELEMENTS_PER_LAYER;
+                int minWinklerElements = int(MIN_WINKLER_ELEMENTS*refinement + 0.5);
+                if (minWinklerElements < 1) minWinklerElements = 1;
+
+                numElemThisLayer = int(refinement*thickness/(WINKLER_ELEMENT_LENGTH*pileInfo[pileIdx].pileDiameter) + 0.5);
+                if (numElemThisLayer < minWinklerElements)  numElemThisLayer = minWinklerElements;
+                if (numElemThisLayer > maxElementsPerLayer) numElemThisLayer = maxElementsPerLayer;
+            }
+            else {
+                numElemThisLayer = int(thickness/pileInfo[pileIdx].pileDiameter);
+                if (numElemThisLayer < minElementsPerLayer) numElemThisLayer = minElementsPerLayer;
+                if (numElemThisLayer > maxElementsPerLayer) numElemThisLayer = maxElementsPerLayer;
+            }
 
             // remember number of elements in this layer
             elemsInLayer[pileIdx][iLayer] = numElemThisLayer;
@@ -482,6 +848,65 @@ void PileFEAmodeler::buildMesh()
 
     /* ******** done with sizing and adjustments ******** */
 
+    // layer interfaces may have moved -- refresh the soil motion profile
+    this->updateMotionData();
+
+    //
+    // nodes, elements and constraints depend on nothing but the sizing above.
+    // If it matches the mesh in theDomain, only the spring and section
+    // parameters are updated (the FEM dump always writes the complete model).
+    //
+
+    QVector<double> topology;
+    topology << numPiles << numElementsInAir << useToeResistance << assumeRigidPileHeadConnection << useWinklerElements;
+    for (int pileIdx=0; pileIdx<numPiles; pileIdx++)
+    {
+        topology << pileInfo[pileIdx].L1 << pileInfo[pileIdx].L2 << pileInfo[pileIdx].xOffset
+                 << pileInfo[pileIdx].numNodePile << pileInfo[pileIdx].maxLayers;
+        for (int iLayer=0; iLayer<MAXLAYERS; iLayer++) topology << elemsInLayer[pileIdx][iLayer];
+    }
+    for (int iLayer=0; iLayer<=MAXLAYERS; iLayer++) topology << depthOfLayer[iLayer];
+
+    if (!dumpFEMinput && topology == meshTopology)
+    {
+        // changed springs restart from their initial state, and so does the load
+        if (this->updateMeshParameters()) loadApplied = false;
+
+        ENABLE_STATE(AnalysisState::meshValid);
+        DISABLE_STATE(AnalysisState::solutionAvailable);
+        return;
+    }
+
+    meshTopology = topology;
+    loadApplied  = false;
+    shaftSprings.clear();
+    toeSprings.clear();
+    springProfile.clear();
+    sectionParameters.fill(QVector<int>(NUM_SECTION_PARAMETERS, 0));
+    numParameters = 0;
+
+    excentricity = 0.0;
+
+    for (int k=0; k<MAXPILES; k++) {
+        headNodeList[k] = {-1, -1, 0.0, 1.0, 1.0};
+    }
+
+    // clear existing model -- the analysis model refers to its nodes and elements
+    if (theModel != nullptr) theModel->clearAll();
+    theDomain->clearAll();
+
+    // the components of the new mesh are taken from meshArena, one after the
+    // other; with the old mesh deleted its memory is reused as a whole.  If
+    // parts of the old mesh are still alive the new one is appended instead.
+    if (meshArena->reset() != 0)
+    {
+        qWarning() << "PileFEAmodeler::buildMesh() --" << meshArena->getNumObjects()
+                   << "objects of the previous mesh still in use, its memory is not reused";
+    }
+    ObjectArena *previousArena = ObjectArena::setCurrent(meshArena);
+
+    capNodeList.clear();
+
     locList.clear();
     pultList.clear();
     y50List.clear();
@@ -497,10 +922,10 @@ void PileFEAmodeler::buildMesh()
         z50List.append(new QVector<double>(pileInfo[pileIdx].numNodePile));
     }
 
-    int ioffset  = numNodePiles;              // for p-y spring nodes
+    int ioffset  = numNodePiles;              // for spring nodes (OpenSees input only)
     int ioffset2 = ioffset + numNodePiles;    // for pile nodes
-    int ioffset3 = ioffset2 + numNodePiles;   // for t-z spring nodes
-    int ioffset4 = ioffset3 + numNodePiles;   // for toe resistance nodes
+    int ioffset3 = ioffset2 + numNodePiles;   // for p-y/t-z spring elements
+    int ioffset4 = ioffset3 + numNodePiles;   // for toe resistance elements
     int ioffset5 = ioffset4 + numNodePiles;   // for pile cap nodes
 
     /* ******** build the finite element mesh ******** */
@@ -515,19 +940,17 @@ void PileFEAmodeler::buildMesh()
     }
 
     //
-    // matrix used to constrain spring and pile nodes with equalDOF (identity constraints)
+    // dofs tying spring and pile nodes with equalDOF in the OpenSees input
     //
-    static Matrix Ccr (2, 2);
-    Ccr.Zero(); Ccr(0,0)=1.0; Ccr(1,1)=1.0;
-    static ID rcDof (2);
+    ID rcDof (2);
     rcDof(0) = 0;
     rcDof(1) = 2;
 
-    // create the vectors for the spring elements orientation
-    static Vector x(3); x(0) = 1.0; x(1) = 0.0; x(2) = 0.0;
-    static Vector y(3); y(0) = 0.0; y(1) = 1.0; y(2) = 0.0;
+    // the orientation of the zeroLength spring elements in the OpenSees input
+    Vector x(3); x(0) = 1.0; x(1) = 0.0; x(2) = 0.0;
+    Vector y(3); y(0) = 0.0; y(1) = 1.0; y(2) = 0.0;
 
-    // direction for spring elements
+    // direction for spring elements (pile node dofs)
     ID direction(2);
     direction[0] = 0;
     direction[1] = 2;
@@ -559,29 +982,8 @@ void PileFEAmodeler::buildMesh()
         //
         // compute pile properties (compute once; used for all pile elements)
         //
-        double PI = 3.14159;
-        double A  = 0.2500 * PI * pileInfo[pileIdx].pileDiameter * pileInfo[pileIdx].pileDiameter;
-        double Iz = 0.0625 *  A * pileInfo[pileIdx].pileDiameter * pileInfo[pileIdx].pileDiameter;
-        double G  = pileInfo[pileIdx].E/(2.0*(1.+0.3));
-        double J  = 1.0e10;
-
-        // suitable pile head parameters (make pile head stiff)
-        if (100.*pileInfo[pileIdx].E*A > EA ) EA = 100.*pileInfo[pileIdx].E*A;
-        if (100.*pileInfo[pileIdx].E*Iz > EI) EI = 100.*pileInfo[pileIdx].E*Iz;
-        if (10.*G*J > GJ)            GJ = 10.*G*J;
-
-        if (dumpFEMinput)
-        {
-            // section Elastic $secTag $E $A $Iz $Iy $G $J <$alphaY $alphaZ>
-            out << "section Elastic " << pileIdx+1 << " " // $secTag
-                                      << pileInfo[pileIdx].E   << " "     // $E
-                                      << A   << " "     // $A
-                                      << Iz  << " "     // $Iz
-                                      << Iz  << " "     // $Iy
-                                      << G   << " "     // $G
-                                      << J   << " ;"     // $J
-                                      << endl;
-        }
+        double A, Iz, G, J;
+        this->computePileSection(pileIdx, A, Iz, G, J);
 
         //
         // Ready to generate the structure
@@ -622,56 +1024,42 @@ void PileFEAmodeler::buildMesh()
         //
 
         if (useToeResistance) {
-            Node *theNode = 0;
-
-            theNode = new Node(numNode,         3, pileInfo[pileIdx].xOffset, 0., zCoord);  theDomain->addNode(theNode);
-            theNode = new Node(numNode+ioffset, 3, pileInfo[pileIdx].xOffset, 0., zCoord);  theDomain->addNode(theNode);
-
+            //
+            // the q-z spring acts between the pile node and the ground.  The OpenSees
+            // input models the ground by a fixed soil node and a spring node tied to the pile.
+            //
             if (dumpFEMinput)
             {
                 SET_3_NDOF
                 out << "node " << numNode         << " " << pileInfo[pileIdx].xOffset << " 0. " << zCoord << " ;" << endl;
                 out << "node " << numNode+ioffset << " " << pileInfo[pileIdx].xOffset << " 0. " << zCoord << " ;" << endl;
-            }
-
-            SP_Constraint *theSP = 0;
-            theSP = new SP_Constraint(numNode, 0, 0., true);  theDomain->addSP_Constraint(theSP);
-            theSP = new SP_Constraint(numNode, 1, 0., true);  theDomain->addSP_Constraint(theSP);
-            theSP = new SP_Constraint(numNode, 2, 0., true);  theDomain->addSP_Constraint(theSP);
-            theSP = new SP_Constraint(numNode+ioffset, 0, 0., true);  theDomain->addSP_Constraint(theSP);
-            theSP = new SP_Constraint(numNode+ioffset, 1, 0., true);  theDomain->addSP_Constraint(theSP);
-
-            if (dumpFEMinput)
-            {
                 out << "fix  " << numNode         << "  1 1 1 ;" << endl;
                 out << "fix  " << numNode+ioffset << "  1 1 0 ;" << endl;
-            }
-
-            MP_Constraint *theMP = new MP_Constraint(numNode+ioffset2, numNode+ioffset, Ccr, rcDof, rcDof);
-            theDomain->addMP_Constraint(theMP);
-
-            if (dumpFEMinput)
-            {
                 out << "equalDOF " << numNode+ioffset2 << " " << numNode+ioffset << " ";
                 for (int k=0; k<rcDof.Size(); k++) { out << rcDof(k)+1 << " "; }
                 out << " ;" << endl;
             }
 
             // # q-z spring material
-            // # vertical effective stress at pile tip, no water table (depth is embedded pile length)
-            double sigVq  = mSoilLayers[pileInfo[pileIdx].maxLayers-1].getLayerBottomStress();
-            double phi  = mSoilLayers[pileInfo[pileIdx].maxLayers-1].getLayerFrictionAng();
+            this->computeToeParameters(pileIdx);
 
-            getQzParam(phi, pileInfo[pileIdx].pileDiameter,  sigVq,  gSoil, &qult, &z50q);
             UniaxialMaterial *theMat = new QzSimple1(numNode, 2, qult, z50q, 0.0, 0.0);
-            OPS_addUniaxialMaterial(theMat);
 
             ID Onedirection(1); Onedirection[0] = 2;
 
             // pile toe
-            Element *theEle = new ZeroLength(1+pileIdx+ioffset4, 3, numNode, numNode+ioffset, x, y, 1, &theMat, Onedirection);
+            Element *theEle = new GroundedSpring(1+pileIdx+ioffset4, numNode+ioffset2, 1, &theMat, Onedirection);
             theDomain->addElement(theEle);
 
+            // parameters for updating the spring in place (qult, z50)
+            int paramTag = this->addParameter(theEle, "qult");
+            this->addParameter(theEle, "z50");
+
+            toeSprings.append(SpringData(pileIdx, -1, -1, zCoord, 0.0, paramTag, theEle->getTag()));
+
+            // the element works on its own copy of the material
+            delete theMat;
+
             if (dumpFEMinput)
             {
                 out << "uniaxialMaterial QzSimple1 " << numNode << " "
@@ -703,6 +1091,8 @@ void PileFEAmodeler::buildMesh()
         // work the way up layer by layer
         //
 
+        QVector<int> elementLayers;  // layer of each Winkler element, from the bottom up
+
         for (int iLayer=pileInfo[pileIdx].maxLayers-1; iLayer >= 0; iLayer--)
         {
             double thickness = mSoilLayers[iLayer].getLayerThickness();
@@ -714,54 +1104,24 @@ void PileFEAmodeler::buildMesh()
             int numNodesLayer = elemsInLayer[pileIdx][iLayer] + 1;
 
             //
-            // create spring nodes
+            // create pile nodes with soil springs.  Nodes of Winkler elements
+            // are at the element ends rather than in the element centers.
             //
-            zCoord += 0.5*eleSize;
-
-            for (int i=1; i<numNodesLayer; i++) {
-                numNode += 1;
-
-                //
-                // spring nodes
-                //
-
-                Node *theNode = 0;
-
-                theNode = new Node(numNode,         3, pileInfo[pileIdx].xOffset, 0., zCoord);  theDomain->addNode(theNode);
-                theNode = new Node(numNode+ioffset, 3, pileInfo[pileIdx].xOffset, 0., zCoord);  theDomain->addNode(theNode);
-
-                if (dumpFEMinput)
-                {
-                    SET_3_NDOF
-                    out << "node " << numNode         << " " << pileInfo[pileIdx].xOffset << " 0. " << zCoord << " ;" << endl;
-                    out << "node " << numNode+ioffset << " " << pileInfo[pileIdx].xOffset << " 0. " << zCoord << " ;" << endl;
-                }
+            double firstNodeOffset = 0.5*eleSize;
 
+            if (useWinklerElements) {
+                firstNodeOffset = eleSize;
+                for (int i=1; i<numNodesLayer; i++) elementLayers << iLayer;
+            }
 
-                SP_Constraint *theSP = 0;
-                //
-                // this is the node connected to the soil -- needs to feel the moving soil
-                //
-                theSP = new SP_Constraint(numNode, 0, 0., true);  theDomain->addSP_Constraint(theSP);
-                theSP = new SP_Constraint(numNode, 1, 0., true);  theDomain->addSP_Constraint(theSP);
-                theSP = new SP_Constraint(numNode, 2, 0., true);  theDomain->addSP_Constraint(theSP);
+            zCoord += firstNodeOffset;
 
-                soilNodes.append(SoilNodeData(numNode, -zCoord));
+            for (int i=1; i<numNodesLayer; i++) {
 
-                if (dumpFEMinput)
-                {
-                    out << "fix  " << numNode         << "  1 1 1 ;" << endl;
-                }
-                //
-                // this is the node connecting to the pile.
-                // -- We need to fix the out of plane movement here for the MP constraint won't link that direction
-                //
-                theSP = new SP_Constraint(numNode+ioffset, 1, 0., true);  theDomain->addSP_Constraint(theSP);
+                // the surface node on top of Winkler elements is added with the free length
+                if (useWinklerElements && iLayer == 0 && i == numNodesLayer-1) { zCoord += eleSize; continue; }
 
-                if (dumpFEMinput)
-                {
-                    out << "fix  " << numNode+ioffset << "  0 1 0 ;" << endl;
-                }
+                numNode += 1;
 
                 //
                 // pile nodes
@@ -769,7 +1129,7 @@ void PileFEAmodeler::buildMesh()
 
                 nodeTag = numNode+ioffset2;
 
-                theNode = new Node(nodeTag, 6, pileInfo[pileIdx].xOffset, 0., zCoord);  theDomain->addNode(theNode);
+                Node *theNode = new Node(nodeTag, 6, pileInfo[pileIdx].xOffset, 0., zCoord);  theDomain->addNode(theNode);
 
                 if (dumpFEMinput)
                 {
@@ -789,12 +1149,19 @@ void PileFEAmodeler::buildMesh()
                     }
                 }
 
-                // constrain spring and pile nodes with equalDOF (identity constraints)
-                MP_Constraint *theMP = new MP_Constraint(numNode+ioffset2, numNode+ioffset, Ccr, rcDof, rcDof);
-                theDomain->addMP_Constraint(theMP);
-
-                if (dumpFEMinput)
+                //
+                // the p-y and t-z springs act between the pile node and the (moving) soil.
+                // The OpenSees input models the soil by a soil node, whose lateral dof is
+                // prescribed by the load pattern (see buildLoad()), and a spring node tied
+                // to the pile with equalDOF.
+                //
+                if (dumpFEMinput && !useWinklerElements)
                 {
+                    SET_3_NDOF
+                    out << "node " << numNode         << " " << pileInfo[pileIdx].xOffset << " 0. " << zCoord << " ;" << endl;
+                    out << "node " << numNode+ioffset << " " << pileInfo[pileIdx].xOffset << " 0. " << zCoord << " ;" << endl;
+                    out << "fix  " << numNode         << "  0 1 1 ;" << endl;
+                    out << "fix  " << numNode+ioffset << "  0 1 0 ;" << endl;
                     out << "equalDOF " << numNode+ioffset2 << " " << numNode+ioffset << " ";
                     for (int k=0; k<rcDof.Size(); k++) { out << rcDof(k)+1 << " "; }
                     out << " ;" << endl;
@@ -804,32 +1171,30 @@ void PileFEAmodeler::buildMesh()
                 // create soil-spring materials
                 //
 
-                // # p-y spring material
-                puSwitch  = 2;  // Hanson
-                //puSwitch  = 1;  // API // temporary switch
-                kSwitch   = 1;  // API
+                // # p-y and t-z spring materials
+                this->computeSpringParameters(pileIdx, iLayer, zCoord, eleSize);
 
-                gwtSwitch = (gwtDepth > -zCoord)?1:2;
-
-                double depthInLayer = -zCoord - depthOfLayer[iLayer];
-                sigV = mSoilLayers[iLayer].getEffectiveStress(depthInLayer);
-                double phi  = mSoilLayers[iLayer].getLayerFrictionAng();
+                //
+                // collect plot data
+                //
 
-                UniaxialMaterial *theMat;
-                getPyParam(-zCoord, sigV, phi, pileInfo[pileIdx].pileDiameter, eleSize, puSwitch, kSwitch, gwtSwitch, &pult, &y50);
+                (*locList[pileIdx])[numNode+ioffset2- pileInfo[pileIdx].nodeIDoffset-1]  = zCoord;
+                // pult is a nodal value for the p-y spring.
+                // It needs to be scaled by element length ito represent a line load
+                (*pultList[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1] = pult/eleSize;
+                (*y50List[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1]  = y50;
+                (*tultList[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1] = tult/eleSize;
+                (*z50List[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1]  = z50;
 
-                if(pult <= 0.0 || y50 <= 0.0) {
-                    qDebug() << "WARNING -- only accepts positive nonzero pult and y50";
-                    qDebug() << "*** iLayer: " << iLayer << "   pile number" << pileIdx+1
-                             << "   depth: " << -zCoord
-                             << "   depth in layer: " << depthInLayer
-                             << "   sigV: "  << sigV
-                             << "   diameter: " << pileInfo[pileIdx].pileDiameter << "   eleSize: " << eleSize;
-                    qDebug() << "*** pult: " << pult << "   y50: " << y50;
+                if (useWinklerElements) {
+                    // the soil springs are integrated along the pile elements (see below)
+                    springProfile.append(SpringData(pileIdx, iLayer, numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1,
+                                                    zCoord, eleSize, 0, -1));
+                    zCoord += eleSize;
+                    continue;
                 }
 
-                theMat = new PySimple1(numNode, 0, 2, pult, y50, 0.0, 0.0);
-                OPS_addUniaxialMaterial(theMat);
+                UniaxialMaterial *pyMat = new PySimple1(numNode, 0, 2, pult, y50, 0.0, 0.0);
 
                 if (dumpFEMinput)
                 {
@@ -837,46 +1202,35 @@ void PileFEAmodeler::buildMesh()
                 }
 
                 // t-z spring material
-                getTzParam(phi, pileInfo[pileIdx].pileDiameter,  sigV,  eleSize, &tult, &z50);
-
-                if (tult <= 0.0 || z50 <= 0.0) {
-                    qDebug() << "WARNING -- only accepts positive nonzero tult and z50";
-                    qDebug() << "*** iLayer: " << iLayer << "   pile number" << pileIdx+1
-                             << "   depth: " << -zCoord << "   sigV: "  << sigV
-                             << "   diameter: " << pileInfo[pileIdx].pileDiameter << "   eleSize: " << eleSize;
-                    qDebug() << "*** tult: " << tult << "   z50: " << z50;
-                }
-
-                theMat = new TzSimple1(numNode+ioffset, 0, 2, tult, z50, 0.0);
-                OPS_addUniaxialMaterial(theMat);
+                UniaxialMaterial *tzMat = new TzSimple1(numNode+ioffset, 0, 2, tult, z50, 0.0);
 
                 if (dumpFEMinput)
                 {
                     out << "uniaxialMaterial TzSimple1 " << numNode+ioffset << " 2 " << tult << " " << z50 << " 0.0 ;" << endl;
                 }
 
-                //
-                // collect plot data
-                //
-
-                (*locList[pileIdx])[numNode+ioffset2- pileInfo[pileIdx].nodeIDoffset-1]  = zCoord;
-                // pult is a nodal value for the p-y spring.
-                // It needs to be scaled by element length ito represent a line load
-                (*pultList[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1] = pult/eleSize;
-                (*y50List[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1]  = y50;
-                (*tultList[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1] = tult/eleSize;
-                (*z50List[pileIdx])[numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1]  = z50;
-
                 //
                 // create soil spring elements
                 //
 
                 UniaxialMaterial *theMaterials[2];
-                theMaterials[0] = OPS_getUniaxialMaterial(numNode);
-                theMaterials[1] = OPS_getUniaxialMaterial(numNode+ioffset);
-                Element *theEle = new ZeroLength(numNode+ioffset3, 3, numNode, numNode+ioffset, x, y, 2, theMaterials, direction);
+                theMaterials[0] = pyMat;
+                theMaterials[1] = tzMat;
+                Element *theEle = new GroundedSpring(numNode+ioffset3, numNode+ioffset2, 2, theMaterials, direction);
                 theDomain->addElement(theEle);
 
+                // parameters for updating the springs in place (pult, y50, tult, z50)
+                int paramTag = this->addParameter(theEle, "pult");
+                this->addParameter(theEle, "y50");
+                this->addParameter(theEle, "tult");
+                this->addParameter(theEle, "z50");
+
+                shaftSprings.append(SpringData(pileIdx, iLayer, numNode+ioffset2-pileInfo[pileIdx].nodeIDoffset-1,
+                                               zCoord, eleSize, paramTag, theEle->getTag()));
+
+                delete pyMat;
+                delete tzMat;
+
                 if (dumpFEMinput)
                 {
                     out << "element zeroLength "
@@ -893,7 +1247,7 @@ void PileFEAmodeler::buildMesh()
                 zCoord += eleSize;
             }
             // back to the layer interface
-            zCoord -= 0.5*eleSize;
+            zCoord -= firstNodeOffset;
 
             //qDebug() << "Layer interface at " << "zCoord: " << zCoord << ", eleSize: " << eleSize;
 
@@ -959,8 +1313,9 @@ void PileFEAmodeler::buildMesh()
         // create pile elements
         //
 
-        static Vector crdV(3); crdV(0)=0.; crdV(1)=-1; crdV(2) = 0.;
-        CrdTransf *theTransformation = new LinearCrdTransf3d(1, crdV);
+        // piles are vertical: the linear transformation reduces to a dof permutation
+        Vector crdV(3); crdV(0)=0.; crdV(1)=-1; crdV(2) = 0.;
+        CrdTransf *theTransformation = new VerticalCrdTransf3d(1, crdV);
 
         if (dumpFEMinput)
         {
@@ -978,35 +1333,105 @@ void PileFEAmodeler::buildMesh()
 
         for (int i=0; i<pileInfo[pileIdx].numNodePile-1; i++) {
             numElem++;
-            BeamIntegration *theIntegration = new LegendreBeamIntegration();
-            SectionForceDeformation *theSections[3];
-            SectionForceDeformation *theSection = new ElasticSection3d(pileIdx+1, pileInfo[pileIdx].E, A, Iz, Iz, G, J);
-            theSections[0] = theSection;
-            theSections[1] = theSection;
-            theSections[2] = theSection;
-
-            Element *theEle = new DispBeamColumn3d(numElem,
-                                                   pileInfo[pileIdx].nodeIDoffset+i+1,
-                                                   pileInfo[pileIdx].nodeIDoffset+i+2,
-                                                   3, theSections, *theIntegration, *theTransformation);
+            Element *theEle = new ElasticBeam3d(numElem,
+                                                pileInfo[pileIdx].nodeIDoffset+i+1,
+                                                pileInfo[pileIdx].nodeIDoffset+i+2,
+                                                pileInfo[pileIdx].E, A, Iz, Iz, G, J, *theTransformation);
             theDomain->addElement(theEle);
 
+            // all elements of the pile share one set of section parameters
+            for (int k=0; k<NUM_SECTION_PARAMETERS; k++) {
+                sectionParameters[pileIdx][k] = this->addParameter(theEle, PILE_SECTION_PARAMETERS[k], sectionParameters[pileIdx][k]);
+            }
+
             if (dumpFEMinput)
             {
-                // need a section definition
-
-                //element dispBeamColumn $eleTag $iNode $jNode $numIntgrPts $secTag $transfTag
-                //                             <-mass $massDens> <-cMass> <-integration $intType>
-                out << "element dispBeamColumn " << numElem << " "
+                //element elasticBeamColumn $eleTag $iNode $jNode $A $E $G $J $Iy $Iz $transfTag
+                out << "element elasticBeamColumn " << numElem << " "
                         << pileInfo[pileIdx].nodeIDoffset+i+1 << " "
                         << pileInfo[pileIdx].nodeIDoffset+i+2 << " "
-                        << 3 << " "
-                        << pileIdx+1 << " "   // section tag: use pileIdx+1
+                        << A << " " << pileInfo[pileIdx].E << " " << G << " " << J << " "
+                        << Iz << " " << Iz << " "
                         << pileIdx+1 << " "   // transformation tag: use pileIdx+1
                         << " ;" << endl;
             }
+
+            //
+            // embedded elements rest on a Winkler foundation between the same nodes
+            //
+            if (i < elementLayers.size())
+            {
+                int iLayer = elementLayers[i];
+                int iNode  = pileInfo[pileIdx].nodeIDoffset+i+1;
+                int jNode  = pileInfo[pileIdx].nodeIDoffset+i+2;
+                double zI  = theDomain->getNode(iNode)->getCrds()(2);
+                double L   = theDomain->getNode(jNode)->getCrds()(2) - zI;
+
+                double xi[NUM_WINKLER_POINTS];
+                double wt[NUM_WINKLER_POINTS];
+                WinklerFoundation3d::getPointLocations(NUM_WINKLER_POINTS, xi);
+                WinklerFoundation3d::getPointWeights(NUM_WINKLER_POINTS, wt);
+
+                UniaxialMaterial *pyMat[NUM_WINKLER_POINTS];
+                UniaxialMaterial *tzMat[NUM_WINKLER_POINTS];
+
+                for (int k=0; k<NUM_WINKLER_POINTS; k++) {
+                    // each integration point carries the springs of its tributary length
+                    this->computeSpringParameters(pileIdx, iLayer, zI + xi[k]*L, wt[k]*L);
+
+                    pyMat[k] = new PySimple1(ioffset + (++materialIndex), 0, 2, pult, y50, 0.0, 0.0);
+                    tzMat[k] = new TzSimple1(ioffset + (++materialIndex), 0, 2, tult, z50, 0.0);
+
+                    if (dumpFEMinput)
+                    {
+                        out << "uniaxialMaterial PySimple1 " << pyMat[k]->getTag() << " 2 " << pult << " " << y50 << " 0.0" << " ;" << endl;
+                        out << "uniaxialMaterial TzSimple1 " << tzMat[k]->getTag() << " 2 " << tult << " " << z50 << " 0.0 ;" << endl;
+                    }
+                }
+
+                // tagged like the spring elements, which are not used with Winkler elements
+                int eleTag = numElem + numNodePiles;
+
+                Element *theFoundation = new WinklerFoundation3d(eleTag, iNode, jNode, NUM_WINKLER_POINTS, pyMat, tzMat);
+                theDomain->addElement(theFoundation);
+
+                for (int k=0; k<NUM_WINKLER_POINTS; k++) {
+
+                    // parameters for updating the springs of each point in place (pult, y50, tult, z50)
+                    char point[8];
+                    snprintf(point, 8, "%d", k+1);
+                    const char *argv[3] = {"point", point, "pult"};
+
+                    int paramTag = this->addParameter(theFoundation, argv, 3);
+                    argv[2] = "y50";   this->addParameter(theFoundation, argv, 3);
+                    argv[2] = "tult";  this->addParameter(theFoundation, argv, 3);
+                    argv[2] = "z50";   this->addParameter(theFoundation, argv, 3);
+
+                    shaftSprings.append(SpringData(pileIdx, iLayer, -1, zI + xi[k]*L, wt[k]*L, paramTag, eleTag));
+                }
+
+                if (dumpFEMinput)
+                {
+                    // there is no OpenSees command for this element
+                    out << "# element winklerFoundation " << eleTag << " " << iNode << " " << jNode << " " << NUM_WINKLER_POINTS;
+                    out << " -py";
+                    for (int k=0; k<NUM_WINKLER_POINTS; k++) { out << " " << pyMat[k]->getTag(); }
+                    out << " -tz";
+                    for (int k=0; k<NUM_WINKLER_POINTS; k++) { out << " " << tzMat[k]->getTag(); }
+                    out << " ;" << endl;
+                }
+
+                // the element works on its own copies of the materials
+                for (int k=0; k<NUM_WINKLER_POINTS; k++) {
+                    delete pyMat[k];
+                    delete tzMat[k];
+                }
+            }
         }
 
+        // the elements hold copies of the transformation
+        delete theTransformation;
+
         pileInfo[pileIdx].lastElementTag = numElem;
     }
 
@@ -1027,7 +1452,7 @@ void PileFEAmodeler::buildMesh()
 
         // set up transformation and orientation for the pile cap elements
 
-        static Vector crdV(3); crdV(0)=0.; crdV(1)=-1; crdV(2) = 0.;
+        Vector crdV(3); crdV(0)=0.; crdV(1)=-1; crdV(2) = 0.;
         CrdTransf *theTransformation = new LinearCrdTransf3d(1, crdV);
 
         if (dumpFEMinput)
@@ -1042,28 +1467,6 @@ void PileFEAmodeler::buildMesh()
             out << " ;" << endl;
         }
 
-        // define beam element integration and cross sections
-
-        BeamIntegration *theIntegration = new LegendreBeamIntegration();
-        SectionForceDeformation *theSections[3];
-        SectionForceDeformation *theSection = new ElasticSection3d(numPiles+1, 1., EA, EI, EI, 1., GJ);
-        theSections[0] = theSection;
-        theSections[1] = theSection;
-        theSections[2] = theSection;
-
-        if (dumpFEMinput)
-        {
-            // section Elastic $secTag $E $A $Iz $Iy $G $J <$alphaY $alphaZ>
-            out << "section Elastic " << MAXPILES+1 << " " // $secTag
-                                      << 1.0 << " "     // $E
-                                      << EA  << " "     // $A
-                                      << EI  << " "     // $Iz
-                                      << EI  << " "     // $Iy
-                                      << 1.0 << " "     // $G
-                                      << GJ  << " "     // $J
-                                      << " ;" << endl;
-        }
-
         int prevNode = -1;
 
         for (int pileIdx=0; pileIdx<numPiles; pileIdx++) {
@@ -1084,10 +1487,10 @@ void PileFEAmodeler::buildMesh()
             // create single point constraints
             if (assumeRigidPileHeadConnection) {
                 // constrain spring and pile nodes with equalDOF (identity constraints)
-                static Matrix Chr (6, 6);
+                Matrix Chr (6, 6);
                 Chr.Zero();
                 Chr(0,0)=1.0; Chr(1,1)=1.0; Chr(2,2)=1.0; Chr(3,3)=1.0; Chr(4,4)=1.0; Chr(5,5)=1.0;
-                static ID hcDof (6);
+                ID hcDof (6);
                 hcDof(0) = 0; hcDof(1) = 1; hcDof(2) = 2; hcDof(3) = 3; hcDof(4) = 4; hcDof(5) = 5;
 
                 //qDebug() << "MP_Constraint(" << nodeTag << "," << headNodeList[pileIdx].nodeIdx << "," << "Idty(6,6)" << "," << "{0,1,2,3,4,5}" << "," << "{0,1,2,3,4,5}" << ")";
@@ -1104,10 +1507,10 @@ void PileFEAmodeler::buildMesh()
             }
             else {
                 // constrain spring and pile nodes with equalDOF (identity constraints)
-                static Matrix Chl (5, 5);
+                Matrix Chl (5, 5);
                 Chl.Zero();
                 Chl(0,0)=1.0; Chl(1,1)=1.0; Chl(2,2)=1.0; Chl(3,3)=1.0; Chl(4,4)=1.0;
-                static ID hlDof (5);
+                ID hlDof (5);
                 hlDof(0) = 0; hlDof(1) = 1; hlDof(2) = 2; hlDof(3) = 3; hlDof(4) = 5;
 
                 //qDebug() << "MP_Constraint(" << nodeTag << "," << headNodeList[pileIdx].nodeIdx << "," << "Idty(5,5)" << "," << "{0,1,2,3,5}" << "," << "{0,1,2,3,5}" << ")";
@@ -1127,28 +1530,32 @@ void PileFEAmodeler::buildMesh()
             if (prevNode > 0) {
                 numElem++;
 
-                Element *theEle = new DispBeamColumn3d(numElem, prevNode, nodeTag,
-                                                       3, theSections, *theIntegration, *theTransformation);
+                // rigidities are given as EA, EI and GJ with unit E and G
+                Element *theEle = new ElasticBeam3d(numElem, prevNode, nodeTag,
+                                                    1.0, EA, EI, EI, 1.0, GJ, *theTransformation);
                 theDomain->addElement(theEle);
 
+                for (int k=0; k<NUM_SECTION_PARAMETERS; k++) {
+                    sectionParameters[MAXPILES][k] = this->addParameter(theEle, CAP_SECTION_PARAMETERS[k], sectionParameters[MAXPILES][k]);
+                }
+
                 if (dumpFEMinput)
                 {
-                    // need a section definition
-
-                    //element dispBeamColumn $eleTag $iNode $jNode $numIntgrPts $secTag $transfTag
-                    //                             <-mass $massDens> <-cMass> <-integration $intType>
-                    out << "element dispBeamColumn " << numElem << " "
+                    //element elasticBeamColumn $eleTag $iNode $jNode $A $E $G $J $Iy $Iz $transfTag
+                    out << "element elasticBeamColumn " << numElem << " "
                             << prevNode << " "
                             << nodeTag << " "
-                            << 3 << " "
-                            << MAXPILES+1 << " "   // section tag: use pileIdx+1
-                            << MAXPILES+1 << " "   // transformation tag: use pileIdx+1
+                            << EA << " " << 1.0 << " " << 1.0 << " " << GJ << " "
+                            << EI << " " << EI << " "
+                            << MAXPILES+1 << " "   // transformation tag
                             << " ;" << endl;
                 }
             }
 
             prevNode = nodeTag;
         }
+
+        delete theTransformation;
     }
 
     if (numPiles == 1) {
@@ -1193,10 +1600,197 @@ void PileFEAmodeler::buildMesh()
         out << endl;
     }
 
+    // remembered for updating this mesh in place
+    for (int k=0; k<MAXPILES; k++) { meshPileInfo[k] = pileInfo[k]; }
+
+    ObjectArena::setCurrent(previousArena);
+
+    QVector<int> paramTags;
+    this->collectMeshParameters(paramTags, meshParameterValues);
+
     ENABLE_STATE(AnalysisState::meshValid);
     DISABLE_STATE(AnalysisState::solutionAvailable);
 }
 
+bool PileFEAmodeler::updateMeshParameters()
+{
+    // node and element tags are those of the mesh in theDomain
+    for (int k=0; k<MAXPILES; k++)
+    {
+        pileInfo[k].nodeIDoffset    = meshPileInfo[k].nodeIDoffset;
+        pileInfo[k].elemIDoffset    = meshPileInfo[k].elemIDoffset;
+        pileInfo[k].firstNodeTag    = meshPileInfo[k].firstNodeTag;
+        pileInfo[k].lastNodeTag     = meshPileInfo[k].lastNodeTag;
+        pileInfo[k].firstElementTag = meshPileInfo[k].firstElementTag;
+        pileInfo[k].lastElementTag  = meshPileInfo[k].lastElementTag;
+    }
+
+    QVector<int>    paramTags;
+    QVector<double> values;
+    this->collectMeshParameters(paramTags, values);
+
+    // returns true if any parameter of the mesh in theDomain was changed
+    bool changed = false;
+
+    for (int i=0; i<paramTags.size(); i++)
+    {
+        if (i < meshParameterValues.size() && values[i] == meshParameterValues[i]) continue;
+
+        theDomain->updateParameter(paramTags[i], values[i]);
+        changed = true;
+    }
+
+    meshParameterValues = values;
+
+    return changed;
+}
+
+void PileFEAmodeler::collectMeshParameters(QVector<int> &paramTags, QVector<double> &values)
+{
+    paramTags.clear();
+    values.clear();
+
+    //
+    // pile and pile cap sections
+    //
+    for (int pileIdx=0; pileIdx<numPiles; pileIdx++)
+    {
+        double A, Iz, G, J;
+        this->computePileSection(pileIdx, A, Iz, G, J);
+
+        double sectionValues[NUM_SECTION_PARAMETERS] = {pileInfo[pileIdx].E, A, Iz, Iz, G};
+        for (int k=0; k<NUM_SECTION_PARAMETERS; k++) {
+            if (sectionParameters[pileIdx][k] > 0) { paramTags << sectionParameters[pileIdx][k]; values << sectionValues[k]; }
+        }
+    }
+
+    double capValues[NUM_SECTION_PARAMETERS] = {EA, EI, EI, 1.0, GJ};
+    for (int k=0; k<NUM_SECTION_PARAMETERS; k++) {
+        if (sectionParameters[MAXPILES][k] > 0) { paramTags << sectionParameters[MAXPILES][k]; values << capValues[k]; }
+    }
+
+    //
+    // p-y, t-z, and q-z springs
+    //
+    foreach (SpringData sd, shaftSprings)
+    {
+        this->computeSpringParameters(sd.pileIdx, sd.layerIdx, sd.z, sd.eleSize);
+
+        paramTags << sd.paramTag << sd.paramTag+1 << sd.paramTag+2 << sd.paramTag+3;
+        values    << pult << y50 << tult << z50;
+
+        if (sd.plotIdx < 0) continue;
+
+        (*pultList[sd.pileIdx])[sd.plotIdx] = pult/sd.eleSize;
+        (*y50List[sd.pileIdx])[sd.plotIdx]  = y50;
+        (*tultList[sd.pileIdx])[sd.plotIdx] = tult/sd.eleSize;
+        (*z50List[sd.pileIdx])[sd.plotIdx]  = z50;
+    }
+
+    // plot data of springs integrated along Winkler elements
+    foreach (SpringData sd, springProfile)
+    {
+        this->computeSpringParameters(sd.pileIdx, sd.layerIdx, sd.z, sd.eleSize);
+
+        (*pultList[sd.pileIdx])[sd.plotIdx] = pult/sd.eleSize;
+        (*y50List[sd.pileIdx])[sd.plotIdx]  = y50;
+        (*tultList[sd.pileIdx])[sd.plotIdx] = tult/sd.eleSize;
+        (*z50List[sd.pileIdx])[sd.plotIdx]  = z50;
+    }
+
+    foreach (SpringData sd, toeSprings)
+    {
+        this->computeToeParameters(sd.pileIdx);
+
+        paramTags << sd.paramTag << sd.paramTag+1;
+        values    << qult << z50q;
+    }
+}
+
+void PileFEAmodeler::computePileSection(int pileIdx, double &A, double &Iz, double &G, double &J)
+{
+    double PI = 3.14159;
+    A  = 0.2500 * PI * pileInfo[pileIdx].pileDiameter * pileInfo[pileIdx].pileDiameter;
+    Iz = 0.0625 *  A * pileInfo[pileIdx].pileDiameter * pileInfo[pileIdx].pileDiameter;
+    G  = pileInfo[pileIdx].E/(2.0*(1.+0.3));
+    J  = 1.0e10;
+
+    // suitable pile head parameters (make pile head stiff)
+    if (100.*pileInfo[pileIdx].E*A > EA ) EA = 100.*pileInfo[pileIdx].E*A;
+    if (100.*pileInfo[pileIdx].E*Iz > EI) EI = 100.*pileInfo[pileIdx].E*Iz;
+    if (10.*G*J > GJ)            GJ = 10.*G*J;
+}
+
+void PileFEAmodeler::computeSpringParameters(int pileIdx, int iLayer, double z, double h)
+{
+    // # p-y spring material
+    puSwitch  = 2;  // Hanson
+    //puSwitch  = 1;  // API // temporary switch
+    kSwitch   = 1;  // API
+
+    gwtSwitch = (gwtDepth > -z)?1:2;
+
+    double depthInLayer = -z - depthOfLayer[iLayer];
+    sigV = mSoilLayers[iLayer].getEffectiveStress(depthInLayer);
+    double phi  = mSoilLayers[iLayer].getLayerFrictionAng();
+
+    getPyParam(-z, sigV, phi, pileInfo[pileIdx].pileDiameter, h, puSwitch, kSwitch, gwtSwitch, &pult, &y50);
+
+    if(pult <= 0.0 || y50 <= 0.0) {
+        qDebug() << "WARNING -- only accepts positive nonzero pult and y50";
+        qDebug() << "*** iLayer: " << iLayer << "   pile number" << pileIdx+1
+                 << "   depth: " << -z
+                 << "   depth in layer: " << depthInLayer
+                 << "   sigV: "  << sigV
+                 << "   diameter: " << pileInfo[pileIdx].pileDiameter << "   eleSize: " << h;
+        qDebug() << "*** pult: " << pult << "   y50: " << y50;
+    }
+
+    // t-z spring material
+    getTzParam(phi, pileInfo[pileIdx].pileDiameter,  sigV,  h, &tult, &z50);
+
+    if (tult <= 0.0 || z50 <= 0.0) {
+        qDebug() << "WARNING -- only accepts positive nonzero tult and z50";
+        qDebug() << "*** iLayer: " << iLayer << "   pile number" << pileIdx+1
+                 << "   depth: " << -z << "   sigV: "  << sigV
+                 << "   diameter: " << pileInfo[pileIdx].pileDiameter << "   eleSize: " << h;
+        qDebug() << "*** tult: " << tult << "   z50: " << z50;
+    }
+}
+
+void PileFEAmodeler::computeToeParameters(int pileIdx)
+{
+    // # vertical effective stress at pile tip, no water table (depth is embedded pile length)
+    double sigVq  = mSoilLayers[pileInfo[pileIdx].maxLayers-1].getLayerBottomStress();
+    double phi  = mSoilLayers[pileInfo[pileIdx].maxLayers-1].getLayerFrictionAng();
+
+    getQzParam(phi, pileInfo[pileIdx].pileDiameter,  sigVq,  gSoil, &qult, &z50q);
+}
+
+int PileFEAmodeler::addParameter(DomainComponent *theComponent, const char *name, int paramTag)
+{
+    const char *argv[1] = {name};
+
+    return this->addParameter(theComponent, argv, 1, paramTag);
+}
+
+int PileFEAmodeler::addParameter(DomainComponent *theComponent, const char **argv, int argc, int paramTag)
+{
+    if (paramTag > 0)
+    {
+        Parameter *theParam = theDomain->getParameter(paramTag);
+        if (theParam != nullptr) theParam->addComponent(theComponent, argv, argc);
+        return paramTag;
+    }
+
+    paramTag = ++numParameters;
+
+    Parameter *theParam = new Parameter(paramTag, theComponent, argv, argc);
+    theDomain->addParameter(theParam);
+
+    return paramTag;
+}
+
 void PileFEAmodeler::buildLoad()
 {
     QTextStream out(FEMfile);
@@ -1218,11 +1812,20 @@ void PileFEAmodeler::buildLoad()
     LoadPattern  *theLoadPattern = nullptr;
     NodalLoad    *theLoad        = nullptr;
 
+    // replace the load of a previous analysis
+    theLoadPattern = theDomain->removeLoadPattern(1);
+    if (theLoadPattern != nullptr) delete theLoadPattern;
+
+    QVector<double> newLoad;  // all load and displacement values of the new pattern
+
     theTimeSeries  = new LinearSeries(1, 1.0);
     theLoadPattern = new LoadPattern(1);
     theLoadPattern->setTimeSeries(theTimeSeries);
 
-    static Vector load(6);
+    Vector load(6);
+
+    // the OpenSees input models the soil by a node tagged as the p-y spring less ioffset3
+    int ioffset3 = 3*numNodePiles;
 
     switch (loadControlType)
     {
@@ -1241,6 +1844,8 @@ void PileFEAmodeler::buildLoad()
         load(2) = PV;
         load(4) = PMom - PV*excentricity;
 
+        newLoad << load(0) << load(2) << load(4);
+
         if (numLoadedNode >= 0)
         {
             theLoad = new NodalLoad(0, numLoadedNode, load);
@@ -1254,6 +1859,12 @@ void PileFEAmodeler::buildLoad()
                 out << " ;" << endl;
             }
 
+            // the soil does not move
+            if (dumpFEMinput && !useWinklerElements)
+            {
+                foreach (SpringData sd, shaftSprings) { out << "              sp " << sd.eleTag-ioffset3 << " 1 0.0 ;" << endl; }
+            }
+
             ENABLE_STATE(AnalysisState::loadValid);
             DISABLE_STATE(AnalysisState::solutionAvailable);
             DISABLE_STATE(AnalysisState::solutionValid);
@@ -1271,6 +1882,8 @@ void PileFEAmodeler::buildLoad()
             theLoadPattern->addSP_Constraint(new SP_Constraint(numLoadedNode, 0, HDisp, false));
             theLoadPattern->addSP_Constraint(new SP_Constraint(numLoadedNode, 2, VDisp, false));
 
+            newLoad << HDisp << VDisp;
+
             theDomain->addLoadPattern(theLoadPattern);
 
             ENABLE_STATE(AnalysisState::loadValid);
@@ -1284,6 +1897,9 @@ void PileFEAmodeler::buildLoad()
                 out << "pattern Plain 200 Linear {"    << endl;
                 out << "              sp " << numLoadedNode << " 1 " << HDisp << " ;" << endl;
                 out << "              sp " << numLoadedNode << " 3 " << VDisp << " ;" << endl;
+                if (!useWinklerElements) {
+                    foreach (SpringData sd, shaftSprings) { out << "              sp " << sd.eleTag-ioffset3 << " 1 0.0 ;" << endl; }
+                }
                 out << "          } ;" << endl;  out << endl;
             }
         };
@@ -1291,9 +1907,9 @@ void PileFEAmodeler::buildLoad()
 
     case LoadControlType::SoilMotion:
 
-        // soilNodes is a list of nodeID, depth pairs for soil nodes that are attached to p-y and t-z springs
+        // the ground under each p-y spring moves by the soil motion at its depth
 
-        if (soilNodes.length() > 0)
+        if (shaftSprings.length() > 0)
         {
             if (dumpFEMinput)
             {
@@ -1302,16 +1918,40 @@ void PileFEAmodeler::buildLoad()
                 out << "pattern Plain 200 Linear {"    << endl;
             }
 
-            foreach (SoilNodeData nd, soilNodes)
+            // the springs of an element are consecutive in shaftSprings.  Its load holds
+            // the ground displacement at all p-y springs followed by all t-z springs.
+            for (int i=0; i<shaftSprings.size(); )
             {
-                SP_Constraint *theSP = new SP_Constraint(nd.ID, 0, shift(nd.depth), false);
-                theLoadPattern->addSP_Constraint(theSP);
+                int eleTag = shaftSprings[i].eleTag;
+                int n = 1;
+                while (i+n < shaftSprings.size() && shaftSprings[i+n].eleTag == eleTag) n++;
 
-                if (dumpFEMinput)
+                Vector groundDisp(2*n);   // t-z: the soil does not settle
+
+                for (int k=0; k<n; k++)
+                {
+                    groundDisp(k) = shift(-shaftSprings[i+k].z);   // p-y
+
+                    newLoad << groundDisp(k);
+
+                    if (dumpFEMinput && !useWinklerElements)
+                    {
+                        // sp $nodeTag $dofTag $dofValue
+                        out << "              sp " << eleTag-ioffset3 << " 1 " << groundDisp(k) << " ;" << endl;
+                    }
+                }
+
+                theLoadPattern->addElementalLoad(new GroundDisplacement(eleTag, groundDisp, eleTag));
+
+                if (dumpFEMinput && useWinklerElements)
                 {
-                    // sp $nodeTag $dofTag $dofValue
-                    out << "              sp " << nd.ID << " 1 " << shift(nd.depth) << " ;" << endl;
+                    // there is no OpenSees command for this load
+                    out << "              # groundDisplacement " << eleTag;
+                    for (int k=0; k<n; k++) { out << " " << groundDisp(k); }
+                    out << " ;" << endl;
                 }
+
+                i += n;
             }
 
             if (dumpFEMinput) { out << "          } ;" << endl;  out << endl; }
@@ -1324,6 +1964,67 @@ void PileFEAmodeler::buildLoad()
         };
         break;
     }
+
+    //
+    // a load further along the proportional path of the load applied last
+    // continues from the committed state; anything else starts over
+    //
+    double lambda0 = 0.0;
+    if (incrementalReload && loadApplied && loadControlType == appliedLoadType)
+    {
+        lambda0 = this->continuationLoadFactor(newLoad);
+    }
+
+    loadContinued = (lambda0 > 0.0);
+
+    if (loadContinued)
+    {
+        // pseudo time is the load factor -- the integrator applies the rest
+        theDomain->setCommittedTime(lambda0);
+        theDomain->setCurrentTime(lambda0);
+    }
+    else
+    {
+        theDomain->revertToStart();
+    }
+
+    appliedLoadType = loadControlType;
+    appliedLoad     = newLoad;
+    loadApplied     = false;
+}
+
+double PileFEAmodeler::continuationLoadFactor(QVector<double> &newLoad)
+{
+    // returns the load factor at which the new load reproduces the applied one, or 0.0
+    if (newLoad.size() != appliedLoad.size()) return 0.0;
+
+    double oldOld = 0.0;
+    double oldNew = 0.0;
+    double newNew = 0.0;
+
+    for (int i=0; i<newLoad.size(); i++)
+    {
+        oldOld += appliedLoad[i]*appliedLoad[i];
+        oldNew += appliedLoad[i]*newLoad[i];
+        newNew += newLoad[i]*newLoad[i];
+    }
+
+    // nothing applied yet, or the load is reduced or reversed
+    if (oldOld <= 0.0 || oldNew < oldOld) return 0.0;
+
+    double ratio = oldNew/oldOld;
+
+    double residual = 0.0;
+    for (int i=0; i<newLoad.size(); i++)
+    {
+        double r = newLoad[i] - ratio*appliedLoad[i];
+        residual += r*r;
+    }
+
+    // a different load pattern, not just a larger one
+    if (residual > 1.0e-12*newNew) return 0.0;
+
+    return 1.0/ratio;
 }
 
 void PileFEAmodeler::buildAnalysis()
@@ -1333,29 +2034,72 @@ void PileFEAmodeler::buildAnalysis()
     QTextStream out(FEMfile);
 
     //
-    // create the analysis
+    // create the analysis -- once.  Later calls keep the analysis objects so
+    // the numbering, DOF graph and SOE storage carry over whenever the
+    // topology of the rebuilt domain is unchanged.
     //
 
-    AnalysisModel     *theModel      = new AnalysisModel();
-    CTestNormDispIncr *theTest       = new CTestNormDispIncr(1.0e-3, 25, 0);
-    EquiSolnAlgo      *theSolnAlgo   = new NewtonRaphson();
-    StaticIntegrator  *theIntegrator = new LoadControl(0.05, 1, 0.05, 0.05);
-    ConstraintHandler *theHandler    = new PenaltyConstraintHandler(1.0e14, 1.0e14);
-    RCM               *theRCM        = new RCM();
-    DOF_Numberer      *theNumberer   = new DOF_Numberer(*theRCM);
-    BandGenLinSolver  *theSolver     = new BandGenLinLapackSolver();
-    LinearSOE         *theSOE        = new BandGenLinSOE(*theSolver);
-
-    if (theAnalysis != nullptr) delete theAnalysis;
-
-    theAnalysis = new StaticAnalysis(*theDomain,
-                                  *theHandler,
-                                  *theNumberer,
-                                  *theModel,
-                                  *theSolnAlgo,
-                                  *theSOE,
-                                  *theIntegrator);
-    theSolnAlgo->setConvergenceTest(theTest);
+    if (theAnalysis == nullptr)
+    {
+        CTestNormDispIncr *theTest       = new AbortableNormDispIncr(1.0e-3, 25, 0, &abortFlag);
+        EquiSolnAlgo      *theSolnAlgo   = this->createSolutionAlgorithm(solutionAlgorithm, lineSearchType, CURRENT_TANGENT);
+        ConstraintHandler *theHandler    = this->createConstraintHandler(false);
+        RCM               *theRCM        = new RCM();
+        DOF_Numberer      *theNumberer   = new DOF_Numberer(*theRCM);
+
+        theModel      = new AnalysisModel();
+        theIntegrator = new AdaptiveLoadControl(LOAD_INCREMENT, DESIRED_ITERATIONS,
+                                                MIN_LOAD_INCREMENT, MAX_LOAD_INCREMENT);
+        theSOE        = this->createLinearSOE(systemOfEquations);
+
+        theAnalysis = new StaticAnalysis(*theDomain,
+                                      *theHandler,
+                                      *theNumberer,
+                                      *theModel,
+                                      *theSolnAlgo,
+                                      *theSOE,
+                                      *theIntegrator,
+                                      theTest);
+
+        // the step size follows the Newton iterations, not the line search trials
+        theIntegrator->setConvergenceTest(theTest);
+
+        algorithmInUse = QString("%1/%2/%3").arg(solutionAlgorithm).arg(lineSearchType).arg(CURRENT_TANGENT);
+        systemInUse    = systemOfEquations;
+    }
+    else
+    {
+        this->useSolutionAlgorithm(solutionAlgorithm, lineSearchType, CURRENT_TANGENT);
+
+        if (systemInUse != systemOfEquations)
+        {
+            // the analysis deletes the old system and sizes the new one at the next step
+            theSOE = this->createLinearSOE(systemOfEquations);
+            theAnalysis->setLinearSOE(*theSOE);
+            systemInUse = systemOfEquations;
+        }
+    }
+
+    //
+    // each pile is a chain of levels, one pile node each (the soil springs
+    // are grounded at the pile nodes).  The cap nodes form the interface.
+    //
+    if (theChainSOE != nullptr)
+    {
+        theChainSOE->clearNodeLevels();
+
+        for (int pileIdx=0; pileIdx<numPiles; pileIdx++)
+        {
+            for (int i=0; i<pileInfo[pileIdx].numNodePile; i++)
+            {
+                theChainSOE->setNodeLevel(pileInfo[pileIdx].nodeIDoffset + i + 1, pileIdx, i);
+            }
+        }
+
+        theChainSolver->setNumThreads(numThreads);
+    }
+
+    theIntegrator->setNumThreads(numThreads);
 
     ENABLE_STATE(AnalysisState::analysisValid);
 
@@ -1367,17 +2111,32 @@ void PileFEAmodeler::buildAnalysis()
         out << "#----------------------------------------------------------" << endl;
         out                                                                  << endl;
         out << "# analysis commands"                                         << endl;
-        out << "    integrator LoadControl  0.05 ;"                          << endl;
+        // OpenSees' LoadControl adapts its step as AdaptiveLoadControl does, but neither
+        // limits the change per step nor shortens the last step to end at load factor 1
+        out << "    # step scaled by " << DESIRED_ITERATIONS << "/(iterations of the last step), within ["
+            << MIN_LOAD_INCREMENT << ", " << MAX_LOAD_INCREMENT << "]" << endl;
+        out << "    integrator LoadControl  " << LOAD_INCREMENT << "  " << DESIRED_ITERATIONS
+            << "  " << MIN_LOAD_INCREMENT << "  " << MAX_LOAD_INCREMENT << " ;" << endl;
         out << "    numberer RCM ;"                                          << endl;
-        out << "    system BandGeneral ;"                                    << endl;
-        out << "    constraints Penalty   1.0e14  1.0e14 ;"                  << endl;
-        out << "    test NormDispIncr 1e-5      20      1 ;"                 << endl;
-        out << "    algorithm Newton ;"                                      << endl;
+        if (systemOfEquations == "PileChain")
+        {
+            // OpenSees has no pile chain system; BandSPD solves the same equations
+            out << "    # PileChainLinSOE was used here -- it is not available in OpenSees" << endl;
+        }
+        out << "    system BandSPD ;"                                        << endl;
+        out << "    constraints Transformation ;"                            << endl;
+        out << "    test NormDispIncr 1e-3      25      0 ;"                 << endl;
+        if (solutionAlgorithm == "Newton" && lineSearchType != "None")
+            out << "    algorithm NewtonLineSearch -type " << lineSearchType << " ;" << endl;
+        else
+            out << "    algorithm " << solutionAlgorithm << " ;"             << endl;
         out << "    analysis Static ;"                                       << endl;
         out                                                                  << endl;
         out << "    set startT [clock seconds] ;"                            << endl;
         out << "    puts \"Starting Load Application...\" ;"                 << endl;
-        out << "    analyze          200 ;"                                  << endl;
+        out << "    while {[getTime] < 0.999999} {"                          << endl;
+        out << "        if {[analyze 1] != 0} { puts \"Load step failed\" ; break }" << endl;
+        out << "    }"                                                       << endl;
         out                                                                  << endl;
         out << "    set endT [clock seconds] ;"                              << endl;
         out << "    puts \"Load Application finished...\" ;"                 << endl;
@@ -1485,6 +2244,19 @@ int PileFEAmodeler::extractPlotData()
             (*MomentList[pileIdx])[i] = eleForces(10);
             (*ShearList[pileIdx])[i]  = eleForces(6);
             (*AxialList[pileIdx])[i]  = eleForces(8);
+
+            // the soil along a Winkler element is part of the pile below node 2
+            Element *theFoundation = nullptr;
+            if (useWinklerElements) theFoundation = theDomain->getElement(i+pileInfo[pileIdx].elemIDoffset+numNodePiles);
+
+            if (theFoundation != nullptr)
+            {
+                const Vector &soilForces = theFoundation->getResistingForce();
+
+                (*MomentList[pileIdx])[i] += soilForces(10);
+                (*ShearList[pileIdx])[i]  += soilForces(6);
+                (*AxialList[pileIdx])[i]  += soilForces(8);
+            }
         }
     }
 
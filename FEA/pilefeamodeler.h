@@ -4,6 +4,8 @@
 //#include <QVector>
 #include <QMap>
 #include <QFile>
+#include <QAtomicInt>
+#include <QStringList>
 
 #include "pilegrouptool_parameters.h"
 #include "soilmat.h"
@@ -34,8 +36,27 @@ enum class AnalysisState {
     analysisValid
 };
 
+// section properties of pile and pile cap elements that are updated in place
+#define NUM_SECTION_PARAMETERS 5
+
+// adaptive load steps as fractions of the full load (pseudo time 0..1)
+#define LOAD_INCREMENT      0.05
+#define MIN_LOAD_INCREMENT  (LOAD_INCREMENT/64.)
+#define MAX_LOAD_INCREMENT  0.25
+#define DESIRED_ITERATIONS  4
+
 class Domain;
+class ObjectArena;
+class DomainComponent;
 class StaticAnalysis;
+class AnalysisModel;
+class AdaptiveLoadControl;
+class EquiSolnAlgo;
+class LineSearch;
+class ConstraintHandler;
+class LinearSOE;
+class PileChainLinSOE;
+class PileChainLinLapackSolver;
 
 class PileFEAmodeler
 {
@@ -54,14 +75,32 @@ public:
         double  zmax;
     };
 
-    class SoilNodeData
+    class SolutionAttempt
     {
     public:
-        SoilNodeData() {ID=-1; depth=0;};
-        SoilNodeData(int id, double z) {ID=id; depth=z;};
+        SolutionAttempt() {lambda=0; dLambda=0; result=0; numIterations=0;};
+        SolutionAttempt(double l, double dl, QString s, int r, int n) {lambda=l; dLambda=dl; strategy=s; result=r; numIterations=n;};
+
+        double  lambda;         // load factor at the start of the step
+        double  dLambda;        // load increment tried
+        QString strategy;       // selected algorithm or fallback strategy
+        int     result;         // negative if the step failed to converge
+        int     numIterations;
+    };
 
-        int     ID;
-        double  depth;
+    class SpringData
+    {
+    public:
+        SpringData() {pileIdx=-1; layerIdx=-1; plotIdx=-1; z=0; eleSize=0; paramTag=0; eleTag=-1;};
+        SpringData(int pile, int layer, int idx, double zz, double h, int tag, int ele) {pileIdx=pile; layerIdx=layer; plotIdx=idx; z=zz; eleSize=h; paramTag=tag; eleTag=ele;};
+
+        int     pileIdx;
+        int     layerIdx;
+        int     plotIdx;   // index into the pult/y50/tult/z50 plot data (-1: none)
+        double  z;
+        double  eleSize;
+        int     paramTag;  // first of the consecutive Domain parameters of the spring
+        int     eleTag;    // the GroundedSpring or WinklerFoundation3d element
     };
 
     void updatePiles(QVector<PILE_INFO> &);
@@ -72,14 +111,29 @@ public:
     void updateGWtable(double );
     void updateDisplacement(double ux=0.0, double uy=0.0);
     void updateDispProfile(QVector<double> &);
+    // with Winkler elements, minElemPerLayer/MIN_ELEMENTS_PER_LAYER scales the
+    // Winkler element count and maxElemPerLayer caps it
+    void setMeshParameters(int minElemPerLayer, int maxElemPerLayer, int numElemInAir);
+    void setWinklerElements(bool);
+    void setNumThreads(int);
+    void setIncrementalReload(bool);
     void setAnalysisType(QString);
+    void setLineSearch(QString);
+    void setSystemOfEquations(QString);
+    void setFallbackStrategies(QStringList);
     void setDefaultParameters(void);
     bool doAnalysis();
 
+    // thread safe: makes a running doAnalysis() give up at its next iteration
+    void requestAbort()     { abortFlag.storeRelease(1); }
+    void clearAbort()       { abortFlag.storeRelease(0); }
+    bool abortRequested()   { return abortFlag.loadAcquire() != 0; }
+
     void writeFEMinput(QString filename);
     void dumpDomain(QString filename);
 
     int  getExitStatus();
+    QList<SolutionAttempt> getSolutionAttempts();
 
     void buildMesh();
     void buildLoad();
@@ -103,6 +157,23 @@ private:
     int extractPlotData();
     void clearPlotBuffers();
 
+    int  applyLoad();
+    EquiSolnAlgo      *createSolutionAlgorithm(QString algorithm, QString lineSearch, int tangent);
+    LineSearch        *createLineSearch(QString type);
+    ConstraintHandler *createConstraintHandler(bool alternate);
+    LinearSOE         *createLinearSOE(QString system);
+    void useSolutionAlgorithm(QString algorithm, QString lineSearch, int tangent);
+    void useSolutionStrategy(int level);
+    QString solutionStrategyName(int level);
+    bool updateMeshParameters();
+    void collectMeshParameters(QVector<int> &paramTags, QVector<double> &values);
+    void computePileSection(int pileIdx, double &A, double &Iz, double &G, double &J);
+    void computeSpringParameters(int pileIdx, int iLayer, double z, double h);
+    void computeToeParameters(int pileIdx);
+    int  addParameter(DomainComponent *, const char *name, int paramTag = 0);
+    int  addParameter(DomainComponent *, const char **argv, int argc, int paramTag = 0);
+    double continuationLoadFactor(QVector<double> &newLoad);
+
 protected:
     // load control
     LoadControlType loadControlType;
@@ -158,6 +229,12 @@ protected:
     int maxElementsPerLayer = MAX_ELEMENTS_PER_LAYER;
     int numElementsInAir    = NUM_ELEMENTS_IN_AIR;
 
+    // soil resistance integrated along fewer, longer pile elements instead of nodal springs
+    bool useWinklerElements = false;
+
+    // threads used for element state determination (needs OpenMP)
+    int numThreads = 1;
+
     PILE_FEA_INFO pileInfo[MAXPILES];
 
     int numNodePiles;
@@ -172,8 +249,32 @@ protected:
     QList<CAP_NODE_TYPE>    capNodeList;
 
     Domain *theDomain;
+    ObjectArena *meshArena;     // the nodes, elements and constraints of theDomain
     StaticAnalysis *theAnalysis = nullptr;
 
+    // owned by theAnalysis, kept for refreshing them on a rebuild
+    AnalysisModel            *theModel      = nullptr;
+    AdaptiveLoadControl      *theIntegrator = nullptr;
+    LinearSOE                *theSOE        = nullptr;
+    PileChainLinSOE          *theChainSOE   = nullptr;   // theSOE, if it is the pile chain system
+    PileChainLinLapackSolver *theChainSolver = nullptr;
+
+    // solution algorithm: selected by setAnalysisType() / used by theAnalysis
+    QString solutionAlgorithm = "Newton";
+    QString lineSearchType    = "None";
+    QString algorithmInUse;                 // algorithm/lineSearch/tangent
+    bool    alternateHandlerInUse = false;  // penalty instead of transformation
+
+    // system of equations: selected by setSystemOfEquations() / used by theAnalysis
+    QString systemOfEquations = "PileChain";
+    QString systemInUse;
+
+    // tried in turn on a step that fails to converge, and the record of all steps
+    QStringList            fallbackStrategies;
+    QList<SolutionAttempt> solutionAttempts;
+
+    QAtomicInt abortFlag;
+
     int numLoadedNode;
     QVector<double> depthOfLayer = QVector<double>(4, 0.0);
 
@@ -191,7 +292,22 @@ protected:
     QVector<QVector<double> *> tultList;
     QVector<QVector<double> *> z50List;
 
-    QList<SoilNodeData> soilNodes;
+    // the mesh in theDomain and the Domain parameters for updating it in place
+    QVector<double>       meshTopology;
+    PILE_FEA_INFO         meshPileInfo[MAXPILES];
+    QList<SpringData>     shaftSprings;          // for Winkler elements: one per integration point
+    QList<SpringData>     toeSprings;
+    QList<SpringData>     springProfile;         // plot data at the nodes of Winkler elements
+    QVector<QVector<int>> sectionParameters = QVector<QVector<int>>(MAXPILES+1, QVector<int>(NUM_SECTION_PARAMETERS, 0));  // [MAXPILES]: pile cap
+    int                   numParameters = 0;
+    QVector<double>       meshParameterValues;   // as set in theDomain, in the order of collectMeshParameters
+
+    // the load of the last analysis; continued from if the next one lies on its path
+    bool                  incrementalReload = true;
+    bool                  loadApplied       = false;   // committed state carries appliedLoad
+    bool                  loadContinued     = false;   // current load starts from appliedLoad
+    LoadControlType       appliedLoadType   = LoadControlType::ForceControl;
+    QVector<double>       appliedLoad;
 
     //
     // state switches
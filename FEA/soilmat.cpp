@@ -1,6 +1,6 @@
 #include <soilmat.h>
 #include <math.h>
-#include <mainwindow.h>
+#include "pilegrouptool_parameters.h"
 
 const double pi = atan(1.0) * 4.0;
 
@@ -6,12 +6,15 @@ SOURCES += ./ops/ArrayOfTaggedObjects.cpp
 SOURCES += ./ops/ArrayOfTaggedObjectsIter.cpp
 SOURCES += ./ops/MapOfTaggedObjects.cpp
 SOURCES += ./ops/MapOfTaggedObjectsIter.cpp
+SOURCES += ./ops/DenseArrayOfTaggedObjects.cpp
+SOURCES += ./ops/DenseArrayOfTaggedObjectsIter.cpp
 SOURCES += ./ops/SingleDomSP_Iter.cpp
 SOURCES += ./ops/SingleDomMP_Iter.cpp
 SOURCES += ./ops/SingleDomNodIter.cpp
 SOURCES += ./ops/SubdomainNodIter.cpp
 SOURCES += ./ops/SingleDomEleIter.cpp
 SOURCES += ./ops/SingleDomParamIter.cpp
+SOURCES += ./ops/Parameter.cpp
 SOURCES += ./ops/SingleDomAllSP_Iter.cpp
 SOURCES += ./ops/SingleDomPC_Iter.cpp
 SOURCES += ./ops/LoadPatternIter.cpp
@@ -22,7 +25,10 @@ SOURCES += ./ops/ElementalLoadIter.cpp
 SOURCES += ./ops/SP_Constraint.cpp
 SOURCES += ./ops/MP_Constraint.cpp
 SOURCES += ./ops/TaggedObject.cpp
+SOURCES += ./ops/ObjectArena.cpp
 SOURCES += ./ops/ZeroLength.cpp
+SOURCES += ./ops/GroundedSpring.cpp
+SOURCES += ./ops/WinklerFoundation3d.cpp
 SOURCES += ./ops/Element.cpp
 SOURCES += ./ops/Information.cpp
 SOURCES += ./ops/ElasticSection3d.cpp
@@ -34,10 +40,14 @@ SOURCES += ./ops/Channel.cpp
 SOURCES += ./ops/Node.cpp
 SOURCES += ./ops/NodalLoad.cpp
 SOURCES += ./ops/Load.cpp
+SOURCES += ./ops/ElementalLoad.cpp
+SOURCES += ./ops/GroundDisplacement.cpp
 SOURCES += ./ops/LoadPattern.cpp
 SOURCES += ./ops/DispBeamColumn3d.cpp
+SOURCES += ./ops/ElasticBeam3d.cpp
 SOURCES += ./ops/CrdTransf.cpp
 SOURCES += ./ops/LinearCrdTransf3d.cpp
+SOURCES += ./ops/VerticalCrdTransf3d.cpp
 SOURCES += ./ops/LegendreBeamIntegration.cpp
 SOURCES += ./ops/BeamIntegration.cpp
 SOURCES += ./ops/Response.cpp
@@ -54,6 +64,7 @@ SOURCES += ./ops/VertexIter.cpp
 SOURCES += ./ops/RCM.cpp
 SOURCES += ./ops/GraphNumberer.cpp
 SOURCES += ./ops/LoadControl.cpp
+SOURCES += ./ops/AdaptiveLoadControl.cpp
 SOURCES += ./ops/PenaltyConstraintHandler.cpp
 SOURCES += ./ops/TransformationConstraintHandler.cpp
 SOURCES += ./ops/TransformationDOF_Group.cpp
@@ -69,6 +80,15 @@ SOURCES += ./ops/DOF_Numberer.cpp
 SOURCES += ./ops/StaticAnalysis.cpp
 SOURCES += ./ops/Analysis.cpp
 SOURCES += ./ops/NewtonRaphson.cpp
+SOURCES += ./ops/ModifiedNewton.cpp
+SOURCES += ./ops/Broyden.cpp
+SOURCES += ./ops/BFGS.cpp
+SOURCES += ./ops/KrylovNewton.cpp
+SOURCES += ./ops/NewtonLineSearch.cpp
+SOURCES += ./ops/LineSearch.cpp
+SOURCES += ./ops/BisectionLineSearch.cpp
+SOURCES += ./ops/SecantLineSearch.cpp
+SOURCES += ./ops/RegulaFalsiLineSearch.cpp
 SOURCES += ./ops/EquiSolnAlgo.cpp
 SOURCES += ./ops/SolutionAlgorithm.cpp
 SOURCES += ./ops/AnalysisModel.cpp
@@ -79,6 +99,12 @@ SOURCES += ./ops/LinearSOESolver.cpp
 SOURCES += ./ops/BandGenLinSOE.cpp
 SOURCES += ./ops/BandGenLinSolver.cpp
 SOURCES += ./ops/BandGenLinLapackSolver.cpp
+SOURCES += ./ops/BandSPDLinSOE.cpp
+SOURCES += ./ops/BandSPDLinSolver.cpp
+SOURCES += ./ops/BandSPDLinLapackSolver.cpp
+SOURCES += ./ops/PileChainLinSOE.cpp
+SOURCES += ./ops/PileChainLinSolver.cpp
+SOURCES += ./ops/PileChainLinLapackSolver.cpp
 SOURCES += ./ops/FE_Element.cpp
 SOURCES += ./ops/DOF_Group.cpp
 SOURCES += ./ops/PySimple1.cpp
@@ -99,6 +125,12 @@ HEADERS += \
         ops/BandGenLinLapackSolver.h \
         ops/BandGenLinSOE.h \
         ops/BandGenLinSolver.h \
+        ops/BandSPDLinLapackSolver.h \
+        ops/BandSPDLinSOE.h \
+        ops/BandSPDLinSolver.h \
+        ops/PileChainLinLapackSolver.h \
+        ops/PileChainLinSOE.h \
+        ops/PileChainLinSolver.h \
         ops/BeamFiberMaterial.h \
         ops/BeamFiberMaterial2d.h \
         ops/BeamIntegration.h \
@@ -122,6 +154,7 @@ HEADERS += \
         ops/DummyStream.h \
         ops/EigenSOE.h \
         ops/EigenSolver.h \
+        ops/ElasticBeam3d.h \
         ops/ElasticSection3d.h \
         ops/Element.h \
         ops/ElementIter.h \
@@ -137,11 +170,14 @@ HEADERS += \
         ops/FiberResponse.h \
         ops/File.h \
         ops/FileIter.h \
+        ops/FixedMatrix.h \
         ops/FrictionModel.h \
         ops/FrictionResponse.h \
         ops/G3Globals.h \
         ops/Graph.h \
         ops/GraphNumberer.h \
+        ops/GroundDisplacement.h \
+        ops/GroundedSpring.h \
         ops/ID.h \
         ops/IncrementalIntegrator.h \
         ops/Information.h \
@@ -153,12 +189,15 @@ HEADERS += \
         ops/LinearSeries.h \
         ops/Load.h \
         ops/LoadControl.h \
+        ops/AdaptiveLoadControl.h \
         ops/LoadPattern.h \
         ops/LoadPatternIter.h \
         ops/MP_Constraint.h \
         ops/MP_ConstraintIter.h \
         ops/MapOfTaggedObjects.h \
         ops/MapOfTaggedObjectsIter.h \
+        ops/DenseArrayOfTaggedObjects.h \
+        ops/DenseArrayOfTaggedObjectsIter.h \
         ops/Material.h \
         ops/MaterialResponse.h \
         ops/Matrix.h \
@@ -168,6 +207,15 @@ HEADERS += \
         ops/MovableObject.h \
         ops/NDMaterial.h \
         ops/NewtonRaphson.h \
+        ops/ModifiedNewton.h \
+        ops/Broyden.h \
+        ops/BFGS.h \
+        ops/KrylovNewton.h \
+        ops/NewtonLineSearch.h \
+        ops/LineSearch.h \
+        ops/BisectionLineSearch.h \
+        ops/SecantLineSearch.h \
+        ops/RegulaFalsiLineSearch.h \
         ops/NodalLoad.h \
         ops/NodalLoadIter.h \
         ops/Node.h \
@@ -215,6 +263,7 @@ HEADERS += \
         ops/TaggedObject.h \
         ops/TaggedObjectIter.h \
         ops/TaggedObjectStorage.h \
+        ops/ObjectArena.h \
         ops/TimeSeries.h \
         ops/TransformationConstraintHandler.h \
         ops/TransformationDOF_Group.h \
@@ -225,6 +274,8 @@ HEADERS += \
         ops/Vector.h \
         ops/Vertex.h \
         ops/VertexIter.h \
+        ops/VerticalCrdTransf3d.h \
+        ops/WinklerFoundation3d.h \
         ops/ZeroLength.h \
         ops/classTags.h \
         ops/elementAPI.h
@@ -260,6 +311,10 @@ INCLUDEPATH += "$(HOME)/OpenSees/DEVELOPER/core"
 SRC += ./ops/Domain.cpp
 LIBS += -llapack -lblas
 
+# element state determination runs on all cores (see Domain::setNumThreads)
+QMAKE_CXXFLAGS += -fopenmp
+QMAKE_LFLAGS   += -fopenmp
+
 }
 }
 
@@ -276,6 +331,7 @@ LIBS += -L"C:\Program Files (x86)\IntelSWTools\compilers_and_libraries\windows\m
 
 DEFINES += -D_FORTRAN -D_RELIABILITY -D_TCL85
 QMAKE_CXXFLAGS += /GS /W3 /Gy   /Zi /Gm- /O2 /Ob1 /fp:precise /errorReport:prompt /GF /WX- /Zc:forScope /Gd /EHsc /MD
+QMAKE_CXXFLAGS += /openmp
 
 } else {
 
@@ -0,0 +1,47 @@
+#-------------------------------------------------
+#
+# PileGroupBatch -- command line driver running
+# PileGroupTool models and parameter sweeps
+# without the graphical user interface.
+#
+#   qmake PileGroupBatch.pro && make
+#
+#-------------------------------------------------
+
+QT       += core gui
+QT       -= widgets
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET   = PileGroupBatch
+TEMPLATE = app
+VERSION  = 2.1.0
+
+DEFINES += APP_VERSION=\\\"$$VERSION\\\"
+
+unix:  QMAKE_CXXFLAGS_WARN_ON = -Wall -Wno-unused-variable -std=c++11
+win32: QMAKE_CXXFLAGS += /Y- -wd"4100"
+
+include(OPS_includes.pro)
+
+INCLUDEPATH += includes
+INCLUDEPATH += FEA
+INCLUDEPATH += batch
+
+SOURCES += \
+        batch/main.cpp \
+        batch/scenario.cpp \
+        batch/batchrunner.cpp \
+        FEA/getPyParam.cpp \
+        FEA/getQzParam.cpp \
+        FEA/getTZParam.cpp \
+        FEA/soilmat.cpp \
+        FEA/pilefeamodeler.cpp
+
+HEADERS  += \
+        batch/scenario.h \
+        batch/batchrunner.h \
+        includes/pilegrouptool_parameters.h \
+        FEA/soilmat.h \
+        FEA/pilefeamodeler.h
@@ -80,6 +80,7 @@ SOURCES += main.cpp \
         FEA/getTZParam.cpp \
         FEA/soilmat.cpp \
         FEA/pilefeamodeler.cpp \
+        FEA/analysisworker.cpp \
         dialogs/materialdbinterface.cpp \
         utilWindows/copyrightdialog.cpp \
         utilWindows/dialogabout.cpp \
@@ -99,6 +100,7 @@ HEADERS  += \
         includes/pilegrouptool_parameters.h \
         FEA/soilmat.h \
         FEA/pilefeamodeler.h \
+        FEA/analysisworker.h \
         dialogs/materialdbinterface.h \
         utilWindows/copyrightdialog.h \
         utilWindows/dialogabout.h \
@@ -93,6 +93,7 @@ SOURCES += main.cpp\
         FEA/getTZParam.cpp \
         FEA/soilmat.cpp \
         FEA/pilefeamodeler.cpp \
+        FEA/analysisworker.cpp \
         dialogs/materialdbinterface.cpp \
         dialogs/surveysplashscreen.cpp \
         utilWindows/copyrightdialog.cpp \
@@ -114,6 +115,7 @@ HEADERS  += \
         qcp/qcustomplot.h \
         FEA/soilmat.h \
         FEA/pilefeamodeler.h \
+        FEA/analysisworker.h \
         dialogs/materialdbinterface.h \
         dialogs/surveysplashscreen.h \
         utilWindows/copyrightdialog.h \
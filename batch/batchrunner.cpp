@@ -0,0 +1,244 @@
+#include "batchrunner.h"
+
+#include <QCoreApplication>
+#include <QProcess>
+#include <QThread>
+#include <QFile>
+#include <QTextStream>
+#include <QJsonDocument>
+#include <QDebug>
+
+#include <math.h>
+#include <stdio.h>
+
+BatchRunner::BatchRunner(QObject *parent) : QObject(parent)
+{
+    numJobs      = QThread::idealThreadCount();
+    if (numJobs < 1) numJobs = 1;
+
+    nextScenario = 0;
+    numDone      = 0;
+    numFailed    = 0;
+    verbose      = false;
+
+    outputDir    = QDir::current();
+}
+
+BatchRunner::~BatchRunner()
+{
+    foreach (QProcess *proc, activeWorkers.keys())
+    {
+        proc->kill();
+        proc->waitForFinished();
+        delete proc;
+    }
+    activeWorkers.clear();
+}
+
+void BatchRunner::setNumJobs(int n)
+{
+    numJobs = (n > 0) ? n : 1;
+}
+
+void BatchRunner::setOutputDirectory(const QString &path)
+{
+    outputDir = QDir(path);
+    if (!outputDir.exists()) outputDir.mkpath(".");
+}
+
+void BatchRunner::run(const QVector<Scenario> &theScenarios)
+{
+    scenarios    = theScenarios;
+    nextScenario = 0;
+    numDone      = 0;
+    numFailed    = 0;
+    summary      = QJsonArray();
+
+    timer.start();
+
+    if (scenarios.isEmpty())
+    {
+        this->writeSummary();
+        emit finished(0);
+        return;
+    }
+
+    for (int i=0; i<numJobs && nextScenario<scenarios.size(); i++) { this->startNext(); }
+}
+
+void BatchRunner::startNext()
+{
+    if (nextScenario >= scenarios.size()) return;
+
+    const Scenario &scenario = scenarios[nextScenario];
+
+    QProcess *proc = new QProcess(this);
+    proc->setProcessChannelMode(QProcess::SeparateChannels);
+    proc->setReadChannel(QProcess::StandardOutput);
+
+    // OpenSees warnings go to stderr -- keep them out of our own output unless asked for
+    if (!verbose) proc->setStandardErrorFile(QProcess::nullDevice());
+    else          proc->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+
+    connect(proc, SIGNAL(finished(int,QProcess::ExitStatus)), this, SLOT(on_workerFinished(int)));
+
+    activeWorkers.insert(proc, nextScenario);
+    nextScenario++;
+
+    proc->start(QCoreApplication::applicationFilePath(), QStringList() << "--worker");
+    proc->write(QJsonDocument(scenario.toJson()).toJson(QJsonDocument::Compact));
+    proc->closeWriteChannel();
+}
+
+void BatchRunner::on_workerFinished(int exitCode)
+{
+    QProcess *proc = qobject_cast<QProcess *>(sender());
+    if (proc == nullptr || !activeWorkers.contains(proc)) return;
+
+    int idx = activeWorkers.take(proc);
+
+    QJsonObject result;
+    QJsonParseError parseError;
+    QJsonDocument doc = QJsonDocument::fromJson(proc->readAllStandardOutput(), &parseError);
+
+    if (exitCode != 0 || parseError.error != QJsonParseError::NoError || !doc.isObject())
+    {
+        result.insert("index", idx);
+        result.insert("sweep", scenarios[idx].getSweepValues());
+        result.insert("converged", false);
+        result.insert("error", QString("worker process failed (exit code %1)").arg(exitCode));
+    }
+    else
+    {
+        result = doc.object();
+    }
+
+    proc->deleteLater();
+
+    this->writeResult(result);
+
+    numDone++;
+    if (!result["converged"].toBool()) numFailed++;
+
+    qInfo().noquote() << QString("[%1/%2] scenario %3 %4")
+                         .arg(numDone).arg(scenarios.size()).arg(idx)
+                         .arg(result["converged"].toBool() ? "converged" : "FAILED");
+
+    if (nextScenario < scenarios.size())
+    {
+        this->startNext();
+    }
+    else if (activeWorkers.isEmpty())
+    {
+        this->writeSummary();
+        emit finished(numFailed);
+    }
+}
+
+void BatchRunner::writeResult(const QJsonObject &result)
+{
+    int idx = result["index"].toInt();
+    QString fileName = QString("scenario_%1.json").arg(idx, 4, 10, QChar('0'));
+
+    QFile file(outputDir.filePath(fileName));
+    if (!file.open(QFile::WriteOnly | QFile::Text))
+    {
+        qWarning() << "Could not write" << file.fileName();
+    }
+    else
+    {
+        file.write(QJsonDocument(result).toJson());
+        file.close();
+    }
+
+    //
+    // condensed information for the summary file
+    //
+    QJsonObject entry;
+    entry.insert("index", idx);
+    entry.insert("sweep", result["sweep"]);
+    entry.insert("converged", result["converged"]);
+    entry.insert("file", fileName);
+    if (result.contains("error")) entry.insert("error", result["error"]);
+
+    QJsonArray piles;
+    foreach (QJsonValue jval, result["piles"].toArray())
+    {
+        QJsonObject aPile = jval.toObject();
+        QJsonObject peaks;
+
+        foreach (QString key, QStringList({"lateralDisplacement", "axialDisplacement", "moment", "shear", "axialForce"}))
+        {
+            double peak = 0.0;
+            foreach (QJsonValue val, aPile[key].toArray())
+            {
+                double v = val.toDouble();
+                if (fabs(v) > fabs(peak)) peak = v;
+            }
+            peaks.insert(key, peak);
+        }
+        piles.append(peaks);
+    }
+    entry.insert("piles", piles);
+
+    summary.append(entry);
+}
+
+void BatchRunner::writeSummary()
+{
+    // workers finish in any order
+    QVector<QJsonObject> sorted(scenarios.size());
+    foreach (QJsonValue jval, summary)
+    {
+        QJsonObject entry = jval.toObject();
+        int idx = entry["index"].toInt();
+        if (idx >= 0 && idx < sorted.size()) sorted[idx] = entry;
+    }
+
+    QJsonArray entries;
+    foreach (QJsonObject entry, sorted) { entries.append(entry); }
+
+    QJsonObject json;
+    json.insert("creator", "PileGroupBatch");
+    json.insert("numScenarios", scenarios.size());
+    json.insert("numFailed", numFailed);
+    json.insert("numJobs", numJobs);
+    json.insert("elapsedTime", timer.elapsed()/1000.0);
+    json.insert("scenarios", entries);
+
+    QFile file(outputDir.filePath("summary.json"));
+    if (!file.open(QFile::WriteOnly | QFile::Text))
+    {
+        qWarning() << "Could not write" << file.fileName();
+        return;
+    }
+    file.write(QJsonDocument(json).toJson());
+    file.close();
+}
+
+/* ******** worker process ******** */
+
+int BatchRunner::runWorker()
+{
+    QFile input;
+    if (!input.open(stdin, QFile::ReadOnly)) return 1;
+
+    QJsonParseError parseError;
+    QJsonDocument doc = QJsonDocument::fromJson(input.readAll(), &parseError);
+    input.close();
+
+    if (parseError.error != QJsonParseError::NoError || !doc.isObject())
+    {
+        qWarning() << "worker: invalid scenario --" << parseError.errorString();
+        return 2;
+    }
+
+    QJsonObject result = Scenario::fromJson(doc.object()).run();
+
+    QFile output;
+    if (!output.open(stdout, QFile::WriteOnly)) return 1;
+    output.write(QJsonDocument(result).toJson(QJsonDocument::Compact));
+    output.close();
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <QObject>
+#include <QVector>
+#include <QList>
+#include <QMap>
+#include <QDir>
+#include <QJsonArray>
+#include <QElapsedTimer>
+
+#include "scenario.h"
+
+class QProcess;
+
+/*
+ * BatchRunner distributes a list of scenarios over a pool of worker
+ * processes.  Each worker is this very executable started with the
+ * --worker switch; it reads one scenario from stdin, runs the analysis
+ * and writes the result to stdout.
+ *
+ * Separate processes keep a failing scenario from taking the whole batch
+ * down.  Each worker analyzes single threaded; the pool size, not the
+ * element loop, is what spreads the batch over the cores.
+ */
+
+class BatchRunner : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit BatchRunner(QObject *parent = nullptr);
+    ~BatchRunner();
+
+    void setNumJobs(int);
+    void setOutputDirectory(const QString &);
+    void setVerbose(bool flag) { verbose = flag; }
+
+    int  getNumJobs() const { return numJobs; }
+    int  getNumFailed() const { return numFailed; }
+
+    void run(const QVector<Scenario> &);
+
+    static int runWorker();
+
+signals:
+    void finished(int numFailed);
+
+private slots:
+    void on_workerFinished(int exitCode);
+
+private:
+    void startNext();
+    void writeResult(const QJsonObject &);
+    void writeSummary();
+
+    QVector<Scenario> scenarios;
+    QMap<QProcess *, int> activeWorkers;   // process -> scenario index
+    QJsonArray summary;
+
+    int  numJobs;
+    int  nextScenario;
+    int  numDone;
+    int  numFailed;
+    bool verbose;
+
+    QDir outputDir;
+    QElapsedTimer timer;
+};
+
+#endif // BATCHRUNNER_H
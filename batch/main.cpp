@@ -0,0 +1,123 @@
+/*
+ * PileGroupBatch -- headless driver for PileGroupTool models
+ *
+ *   PileGroupBatch [options] input.json
+ *
+ * The input is a PileGroupTool model file (as written by File|Save)
+ * optionally extended by a "sweep" object (see batch/scenario.h).
+ * All resulting scenarios are analyzed in parallel, one worker process
+ * per scenario, and results are written to the output directory as
+ * scenario_NNNN.json plus a summary.json.
+ */
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QJsonDocument>
+#include <QDebug>
+
+#include "scenario.h"
+#include "batchrunner.h"
+
+// OpenSees include files
+#include <StandardStream.h>
+
+StandardStream sserr;
+thread_local OPS_Stream *opserrPtr = &sserr;
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("PileGroupBatch");
+    QCoreApplication::setApplicationVersion(APP_VERSION);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Run PileGroupTool models and parameter sweeps without the graphical interface.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument("input", "model file, optionally containing a \"sweep\" object");
+
+    QCommandLineOption jobsOption(QStringList() << "j" << "jobs",
+                                  "number of concurrent analyses (default: number of cores)", "N");
+    QCommandLineOption outputOption(QStringList() << "o" << "output",
+                                    "directory for result files (default: current directory)", "dir");
+    QCommandLineOption listOption(QStringList() << "l" << "list",
+                                  "list the expanded scenarios and exit");
+    QCommandLineOption verboseOption(QStringList() << "verbose",
+                                     "show diagnostic output of the analyses");
+    QCommandLineOption workerOption(QStringList() << "worker",
+                                    "internal: analyze one scenario read from stdin");
+    workerOption.setFlags(QCommandLineOption::HiddenFromHelp);
+
+    parser.addOption(jobsOption);
+    parser.addOption(outputOption);
+    parser.addOption(listOption);
+    parser.addOption(verboseOption);
+    parser.addOption(workerOption);
+
+    parser.process(app);
+
+    if (parser.isSet(workerOption)) return BatchRunner::runWorker();
+
+    if (parser.positionalArguments().size() != 1) parser.showHelp(1);
+
+    //
+    // read the input file
+    //
+    QFile inFile(parser.positionalArguments().first());
+
+    if (!inFile.open(QFile::ReadOnly | QFile::Text))
+    {
+        qCritical() << "Could not open file" << inFile.fileName();
+        return 1;
+    }
+
+    QJsonParseError parseError;
+    QJsonDocument doc = QJsonDocument::fromJson(inFile.readAll(), &parseError);
+    inFile.close();
+
+    if (parseError.error != QJsonParseError::NoError || !doc.isObject())
+    {
+        qCritical() << inFile.fileName() << ":" << parseError.errorString();
+        return 1;
+    }
+
+    QString errorMsg;
+    if (!Scenario::isValidModel(doc.object(), &errorMsg))
+    {
+        qCritical() << inFile.fileName() << ":" << errorMsg;
+        return 1;
+    }
+
+    QVector<Scenario> scenarios = Scenario::expandSweep(doc.object());
+
+    if (parser.isSet(listOption))
+    {
+        foreach (Scenario scenario, scenarios)
+        {
+            qInfo().noquote() << scenario.getIndex()
+                              << QJsonDocument(scenario.getSweepValues()).toJson(QJsonDocument::Compact);
+        }
+        return 0;
+    }
+
+    //
+    // run all scenarios
+    //
+    BatchRunner runner;
+
+    if (parser.isSet(jobsOption))   runner.setNumJobs(parser.value(jobsOption).toInt());
+    if (parser.isSet(outputOption)) runner.setOutputDirectory(parser.value(outputOption));
+    runner.setVerbose(parser.isSet(verboseOption));
+
+    qInfo().noquote() << QString("running %1 scenario(s) on %2 worker(s)")
+                         .arg(scenarios.size()).arg(runner.getNumJobs());
+
+    QObject::connect(&runner, &BatchRunner::finished, &app, &QCoreApplication::exit);
+
+    runner.run(scenarios);
+
+    if (scenarios.isEmpty()) return 0;
+
+    return app.exec();
+}
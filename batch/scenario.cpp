@@ -0,0 +1,352 @@
+#include "scenario.h"
+#include "pilefeamodeler.h"
+#include "soilmat.h"
+
+#include <QDebug>
+
+typedef QList<QVector<QVector<double> *> *> (PileFEAmodeler::*ResultGetter)();
+
+struct RESULT_TYPE {
+    const char   *name;
+    ResultGetter  getter;
+};
+
+static const RESULT_TYPE RESULT_TYPES[] = {
+    {"lateralDisplacement", &PileFEAmodeler::getLateralDisplacements},
+    {"axialDisplacement",   &PileFEAmodeler::getAxialDisplacements},
+    {"moment",              &PileFEAmodeler::getMoment},
+    {"shear",               &PileFEAmodeler::getShear},
+    {"axialForce",          &PileFEAmodeler::getForce},
+    {"stress",              &PileFEAmodeler::getStress},
+    {"pult",                &PileFEAmodeler::getPult},
+    {"y50",                 &PileFEAmodeler::getY50},
+    {"tult",                &PileFEAmodeler::getTult},
+    {"z50",                 &PileFEAmodeler::getZ50}
+};
+
+Scenario::Scenario()
+{
+    index = -1;
+}
+
+Scenario::Scenario(int idx, const QJsonObject &theModel, const QJsonObject &theSweepValues)
+{
+    index       = idx;
+    model       = theModel;
+    sweepValues = theSweepValues;
+}
+
+/* ******** sweep expansion ******** */
+
+QVector<Scenario> Scenario::expandSweep(const QJsonObject &batchInput)
+{
+    QJsonObject baseModel = batchInput;
+    baseModel.remove("sweep");
+
+    QJsonObject sweep = batchInput["sweep"].toObject();
+
+    QStringList      keys;
+    QList<QJsonArray> alternatives;
+
+    foreach (QString key, sweep.keys())
+    {
+        QJsonArray values = sweep[key].toArray();
+        if (values.isEmpty())
+        {
+            qWarning() << "sweep parameter" << key << "has no values -- ignored";
+            continue;
+        }
+        keys.append(key);
+        alternatives.append(values);
+    }
+
+    int numScenarios = 1;
+    foreach (QJsonArray values, alternatives) { numScenarios *= values.size(); }
+
+    QVector<Scenario> scenarios;
+
+    //
+    // enumerate the cartesian product: the first key varies slowest
+    //
+    for (int idx=0; idx<numScenarios; idx++)
+    {
+        QJsonValue  theModel(baseModel);
+        QJsonObject theValues;
+
+        int remainder = idx;
+        for (int k=keys.size()-1; k>=0; k--)
+        {
+            int n = alternatives[k].size();
+            QJsonValue value = alternatives[k][remainder % n];
+            remainder /= n;
+
+            theModel = setPath(theModel, keys[k].split('/', QString::SkipEmptyParts), value);
+            theValues.insert(keys[k], value);
+        }
+
+        scenarios.append(Scenario(idx, theModel.toObject(), theValues));
+    }
+
+    return scenarios;
+}
+
+QJsonValue Scenario::setPath(const QJsonValue &root, const QStringList &path, const QJsonValue &value)
+{
+    if (path.isEmpty()) return value;
+
+    QString     key  = path.first();
+    QStringList rest = path.mid(1);
+
+    if (root.isArray())
+    {
+        QJsonArray array = root.toArray();
+        int i = key.toInt();
+        while (array.size() <= i) { array.append(array.isEmpty() ? QJsonValue(QJsonObject()) : array.last()); }
+        array[i] = setPath(array[i], rest, value);
+        return array;
+    }
+    else
+    {
+        QJsonObject object = root.toObject();
+        object[key] = setPath(object[key], rest, value);
+        return object;
+    }
+}
+
+/* ******** model validation and setup ******** */
+
+bool Scenario::isValidModel(const QJsonObject &json, QString *errorMsg)
+{
+    bool fileTypeError = false;
+
+    if (json["creator"].toString() != "PileGroupTool") fileTypeError = true;
+
+    QString version = json["version"].toString();
+    if (!version.startsWith("1.") && !version.startsWith("2.0") && !version.startsWith("2.1")) fileTypeError = true;
+
+    if (fileTypeError && errorMsg != nullptr) *errorMsg = "Not a valid model file.";
+
+    return !fileTypeError;
+}
+
+bool Scenario::configure(PileFEAmodeler &modeler, QString *errorMsg) const
+{
+    const QJsonObject &json = model;
+
+    if (!isValidModel(json, errorMsg)) return false;
+
+    QString version = json["version"].toString();
+
+    /* layer information */
+    QVector<soilLayer> soilLayers;
+
+    foreach (QJsonValue jval, json["layers"].toArray()) {
+
+        QJsonObject aLayer = jval.toObject();
+
+        soilLayer layer(QString("Layer %1").arg(soilLayers.size()+1),
+                        aLayer["thickness"].toDouble(),
+                        aLayer["gamma"].toDouble(),
+                        aLayer["gammaSaturated"].toDouble(),
+                        aLayer["Gmodulus"].toDouble(),
+                        aLayer["phi"].toDouble(),
+                        aLayer["cohesion"].toDouble(),
+                        BRUSH_COLOR[3*soilLayers.size()]);
+        soilLayers.append(layer);
+
+        if (soilLayers.size() >= MAXLAYERS)  break;
+    }
+
+    if (soilLayers.isEmpty()) {
+        if (errorMsg != nullptr) *errorMsg = "model does not define any soil layers";
+        return false;
+    }
+
+    while (soilLayers.size() < MAXLAYERS) {
+        /* fill layer array with identical layer properties */
+        soilLayers.append(soilLayers.last());
+    }
+
+    double gwtDepth = json["groundWaterTable"].toDouble();
+    if (gwtDepth < 0.0) gwtDepth = 0.0;
+
+    // set depth, GWT depth and overburden for each layer (see MainWindow::updateLayerState())
+    double layerDepthFromSurface = 0.0;
+    for (int ii = 0; ii < soilLayers.size(); ii++)
+    {
+        soilLayers[ii].setLayerDepth(layerDepthFromSurface);
+        soilLayers[ii].setGWTdepth(gwtDepth - layerDepthFromSurface);
+        layerDepthFromSurface += soilLayers[ii].getLayerThickness();
+        if (ii > 0)
+            soilLayers[ii].setLayerTopStress(soilLayers[ii-1].getLayerBottomStress());
+    }
+
+    /* pile information */
+    QVector<PILE_INFO> pileInfo;
+
+    foreach (QJsonValue jval, json["piles"].toArray()) {
+        QJsonObject aPile = jval.toObject();
+
+        PILE_INFO thisPile;
+        thisPile.L2           = aPile["embeddedLength"].toDouble();
+        thisPile.L1           = aPile["freeLength"].toDouble();
+        thisPile.pileDiameter = aPile["diameter"].toDouble();
+        thisPile.E            = aPile["YoungsModulus"].toDouble();
+        thisPile.xOffset      = aPile["xOffset"].toDouble();
+        pileInfo.append(thisPile);
+
+        if (pileInfo.size() >= MAXPILES) break;
+    }
+
+    if (pileInfo.isEmpty()) {
+        if (errorMsg != nullptr) *errorMsg = "model does not define any piles";
+        return false;
+    }
+
+    // the free length is shared by all piles (the last one read wins, as in MainWindow::ReadFile)
+    for (int i=0; i<pileInfo.size(); i++) { pileInfo[i].L1 = pileInfo.last().L1; }
+
+    /* FEA parameters */
+    QJsonObject FEAparameters = json["FEAparameters"].toObject();
+
+    int minElementsPerLayer = FEAparameters["minElementsPerLayer"].toInt();
+    int maxElementsPerLayer = FEAparameters["maxElementsPerLayer"].toInt();
+    int numElementsInAir    = FEAparameters["numElementsInAir"].toInt();
+
+    if (minElementsPerLayer < MIN_ELEMENTS_PER_LAYER)   minElementsPerLayer = MIN_ELEMENTS_PER_LAYER;
+    if (maxElementsPerLayer > 3*MAX_ELEMENTS_PER_LAYER) maxElementsPerLayer = 3*MAX_ELEMENTS_PER_LAYER;
+    if (numElementsInAir < NUM_ELEMENTS_IN_AIR)         numElementsInAir = NUM_ELEMENTS_IN_AIR;
+    if (numElementsInAir > MAX_ELEMENTS_PER_LAYER)      numElementsInAir = MAX_ELEMENTS_PER_LAYER;
+
+    modeler.setMeshParameters(minElementsPerLayer, maxElementsPerLayer, numElementsInAir);
+    modeler.setWinklerElements(FEAparameters["useWinklerElements"].toBool());
+
+    modeler.updatePiles(pileInfo);
+    modeler.updateSwitches(json["useToeResistance"].toBool(), json["assumeRigidPileHeadConnection"].toBool());
+    modeler.updateSoil(soilLayers);
+    modeler.updateGWtable(gwtDepth);
+
+    /* load information */
+    if (version.startsWith("1.0"))
+    {
+        QJsonObject loadInfo = json["loads"].toObject();
+
+        modeler.setLoadType(LoadControlType::ForceControl);
+        modeler.updateLoad(loadInfo["HForce"].toDouble(), loadInfo["VForce"].toDouble(), loadInfo["Moment"].toDouble());
+    }
+    else
+    {
+        QJsonObject loadInfo = json["loads"].toObject();
+        QJsonObject forceControlObj = loadInfo["forceControl"].toObject();
+        QJsonObject pushOverObj     = loadInfo["pushOver"].toObject();
+        QJsonObject soilMotionObj   = loadInfo["soilMotion"].toObject();
+
+        QString loadType = loadInfo["loadControlType"].toString().toLower();
+
+        if (loadType == "pushover")
+        {
+            modeler.setLoadType(LoadControlType::PushOver);
+            modeler.updateDisplacement(pushOverObj["HDisp"].toDouble(), pushOverObj["VDisp"].toDouble());
+        }
+        else if (loadType == "soilmotion")
+        {
+            QVector<double> profile;
+            profile.append(soilMotionObj["surfaceDisp"].toDouble());
+            profile.append(soilMotionObj["percentage12"].toDouble());
+            profile.append(soilMotionObj["percentage23"].toDouble());
+            profile.append(soilMotionObj["percentageBase"].toDouble());
+
+            modeler.setLoadType(LoadControlType::SoilMotion);
+            modeler.updateDispProfile(profile);
+        }
+        else
+        {
+            modeler.setLoadType(LoadControlType::ForceControl);
+            modeler.updateLoad(forceControlObj["HForce"].toDouble(),
+                               forceControlObj["VForce"].toDouble(),
+                               forceControlObj["Moment"].toDouble());
+        }
+    }
+
+    return true;
+}
+
+/* ******** analysis ******** */
+
+QJsonObject Scenario::run() const
+{
+    QJsonObject result;
+
+    result.insert("index", index);
+    result.insert("sweep", sweepValues);
+
+    PileFEAmodeler modeler;
+    QString errorMsg;
+
+    if (!this->configure(modeler, &errorMsg))
+    {
+        result.insert("converged", false);
+        result.insert("error", errorMsg);
+        return result;
+    }
+
+    bool converged = modeler.doAnalysis();
+
+    result.insert("converged", converged);
+
+    //
+    // collect results pile by pile
+    //
+    QJsonArray piles;
+
+    for (const RESULT_TYPE &type : RESULT_TYPES)
+    {
+        QList<QVector<QVector<double> *> *> list = (modeler.*type.getter)();
+        if (list.size() < 2) continue;
+
+        QVector<QVector<double> *> &pos  = *list[0];
+        QVector<QVector<double> *> &data = *list[1];
+
+        for (int pileIdx=0; pileIdx<pos.size(); pileIdx++)
+        {
+            while (piles.size() <= pileIdx) piles.append(QJsonObject());
+            QJsonObject aPile = piles[pileIdx].toObject();
+
+            if (!aPile.contains("z"))
+            {
+                QJsonArray z;
+                foreach (double val, *pos[pileIdx]) { z.append(val); }
+                aPile.insert("z", z);
+            }
+
+            QJsonArray values;
+            if (pileIdx < data.size() && data[pileIdx] != nullptr)
+            {
+                foreach (double val, *data[pileIdx]) { values.append(val); }
+            }
+            aPile.insert(type.name, values);
+
+            piles[pileIdx] = aPile;
+        }
+    }
+
+    result.insert("piles", piles);
+
+    return result;
+}
+
+/* ******** (de)serialization for worker processes ******** */
+
+QJsonObject Scenario::toJson() const
+{
+    QJsonObject json;
+    json.insert("index", index);
+    json.insert("model", model);
+    json.insert("sweep", sweepValues);
+    return json;
+}
+
+Scenario Scenario::fromJson(const QJsonObject &json)
+{
+    return Scenario(json["index"].toInt(), json["model"].toObject(), json["sweep"].toObject());
+}
@@ -0,0 +1,60 @@
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonValue>
+
+#include "pilegrouptool_parameters.h"
+
+class PileFEAmodeler;
+
+/*
+ * A Scenario is one fully specified PileGroupTool model.
+ *
+ * The JSON representation is identical to the file written by
+ * MainWindow::WriteFile() and read by MainWindow::ReadFile().
+ * A batch input file may additionally contain a "sweep" object, e.g.,
+ *
+ *   "sweep": {
+ *       "loads/forceControl/HForce": [100, 200, 400],
+ *       "piles/0/diameter":          [0.8, 1.0, 1.2],
+ *       "layers/1/phi":              [30, 35]
+ *   }
+ *
+ * Every key is a '/'-separated path into the model file and every value
+ * a list of alternatives.  expandSweep() returns the cartesian product of
+ * all alternatives as a list of plain model files (18 scenarios above).
+ */
+
+class Scenario
+{
+public:
+    Scenario();
+    Scenario(int index, const QJsonObject &model, const QJsonObject &sweepValues);
+
+    static QVector<Scenario> expandSweep(const QJsonObject &batchInput);
+    static bool isValidModel(const QJsonObject &model, QString *errorMsg = nullptr);
+
+    bool configure(PileFEAmodeler &modeler, QString *errorMsg = nullptr) const;
+    QJsonObject run() const;
+
+    int         getIndex() const       { return index; }
+    QJsonObject getModel() const       { return model; }
+    QJsonObject getSweepValues() const { return sweepValues; }
+
+    QJsonObject toJson() const;
+    static Scenario fromJson(const QJsonObject &);
+
+private:
+    static QJsonValue setPath(const QJsonValue &root, const QStringList &path, const QJsonValue &value);
+
+    int         index;
+    QJsonObject model;
+    QJsonObject sweepValues;
+};
+
+#endif // SCENARIO_H
@@ -13,6 +13,11 @@
 #define MAX_ELEMENTS_PER_LAYER   40
 #define NUM_ELEMENTS_IN_AIR       4
 
+// Meshing parameters for piles on a Winkler foundation (soil integrated along the elements)
+#define WINKLER_ELEMENT_LENGTH    2   // target element length in pile diameters
+#define MIN_WINKLER_ELEMENTS      3   // per layer
+#define NUM_WINKLER_POINTS        3   // p-y/t-z integration points per element
+
 /*
  *  force limits are given as integers to work with the sliders.
  *  They are converted to floats when generating the FEA model.
@@ -0,0 +1,143 @@
+/*
+ * DenseKernelCheck -- compares the vectorized dense kernels of
+ * ops/MatrixUtil.cpp with the plain C++ ones
+ *
+ *   DenseKernelCheck
+ *
+ * Every instruction set path the cpu supports is run on all shapes
+ * of sizes 1..19, on aligned and unaligned data, and through the Matrix
+ * products built on the kernels.  Each result must match the C++ path
+ * bit for bit.  Returns 0 if all paths agree, 1 otherwise.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+// OpenSees include files
+#include <StandardStream.h>
+#include <Matrix.h>
+#include <MatrixUtil.h>
+
+StandardStream sserr;
+thread_local OPS_Stream *opserrPtr = &sserr;
+
+static const int maxSize = 19;
+static const int maxOffset = 3;
+static const int dataSize = maxSize*maxSize + maxOffset;
+
+static const char *ISA[] = {"AVX-512", "AVX", "SSE2"};
+static const int numISA = sizeof(ISA)/sizeof(const char *);
+
+// values spread over several orders of magnitude, so that a different
+// order of the operations shows in the last bits
+static void
+fillData(double *x, int n, unsigned int seed)
+{
+    for (int i=0; i<n; i++) {
+        seed = seed*1664525u + 1013904223u;
+        double r = (seed >> 8) / 16777216.0;
+        x[i] = (r - 0.5) * pow(10.0, (int)(seed % 7) - 3);
+    }
+}
+
+// results of one path for every shape, in a fixed order
+struct KernelResults {
+    double multAdd[maxSize][maxSize][dataSize];
+    double axpy[maxOffset+1][maxSize][dataSize];
+    double triple[maxSize][maxSize*maxSize];
+    double tripleC[maxSize][maxSize*maxSize];
+};
+
+static void
+runKernels(KernelResults &res)
+{
+    double A[dataSize], B[dataSize], C[dataSize];
+    fillData(A, dataSize, 1);
+    fillData(B, dataSize, 2);
+
+    // C(m x n) += A(m x l) * B(l x n) * fact, for n = 1 + (m+l)%4
+    for (int m=1; m<=maxSize; m++)
+        for (int l=1; l<=maxSize; l++) {
+            int n = 1 + (m+l)%4;
+            fillData(C, dataSize, 3);
+            denseMultAdd(m, n, l, A, B, C, -0.75);
+            memcpy(res.multAdd[m-1][l-1], C, sizeof(C));
+        }
+
+    // y += x * a, with x and y off the 16, 32 and 64 byte boundaries
+    for (int off=0; off<=maxOffset; off++)
+        for (int n=1; n<=maxSize; n++) {
+            fillData(C, dataSize, 4);
+            denseAxpy(n, 1.25, A+off, C+maxOffset-off);
+            memcpy(res.axpy[off][n-1], C, sizeof(C));
+        }
+
+    // T'BT and T'BC through Matrix
+    for (int n=1; n<=maxSize; n++) {
+        int m = 1 + (3*n)%maxSize;
+        Matrix T(m, n), Bm(m, m), Cm(m, n), X(n, n), Y(n, n);
+        for (int j=0; j<n; j++)
+            for (int i=0; i<m; i++) {
+                T(i, j) = A[j*m+i];
+                Cm(i, j) = B[maxSize*maxSize-1-j*m-i];
+            }
+        for (int j=0; j<m; j++)
+            for (int i=0; i<m; i++)
+                Bm(i, j) = B[j*m+i];
+        X.addMatrixTripleProduct(0.0, T, Bm, 1.5);
+        Y.addMatrixTripleProduct(0.0, T, Bm, Cm, 1.5);
+        for (int j=0; j<n; j++)
+            for (int i=0; i<n; i++) {
+                res.triple[n-1][j*n+i] = X(i, j);
+                res.tripleC[n-1][j*n+i] = Y(i, j);
+            }
+    }
+}
+
+static KernelResults cppResults;
+static KernelResults isaResults;
+
+int main(void)
+{
+    if (setDenseKernelISA("C++") != 0) {
+        fprintf(stderr, "DenseKernelCheck: the C++ kernels are not available\n");
+        return 1;
+    }
+    runKernels(cppResults);
+
+    int numFailed = 0;
+    for (int k=0; k<numISA; k++) {
+        int ok = setDenseKernelISA(ISA[k]);
+        if (ok == -1) {
+            printf("%-8s not supported by this cpu or build, skipped\n", ISA[k]);
+            continue;
+        }
+        if (ok == -2) {
+            printf("%-8s FAILED the check at selection\n", ISA[k]);
+            numFailed++;
+            continue;
+        }
+
+        runKernels(isaResults);
+
+        const char *routine = 0;
+        if (memcmp(cppResults.multAdd, isaResults.multAdd, sizeof(cppResults.multAdd)) != 0)
+            routine = "denseMultAdd";
+        else if (memcmp(cppResults.axpy, isaResults.axpy, sizeof(cppResults.axpy)) != 0)
+            routine = "denseAxpy";
+        else if (memcmp(cppResults.triple, isaResults.triple, sizeof(cppResults.triple)) != 0)
+            routine = "Matrix::addMatrixTripleProduct (T'BT)";
+        else if (memcmp(cppResults.tripleC, isaResults.tripleC, sizeof(cppResults.tripleC)) != 0)
+            routine = "Matrix::addMatrixTripleProduct (T'BC)";
+
+        if (routine != 0) {
+            printf("%-8s FAILED: %s differs from the C++ kernels\n", ISA[k], routine);
+            numFailed++;
+        } else
+            printf("%-8s ok\n", ISA[k]);
+    }
+
+    setDenseKernelISA("C++");
+    return numFailed == 0 ? 0 : 1;
+}
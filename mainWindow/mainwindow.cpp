@@ -8,6 +8,7 @@
 #include "utilWindows/dialogquicktips.h"
 #include "utilWindows/dialogfuturefeature.h"
 #include "pilefeamodeler.h"
+#include "analysisworker.h"
 
 #include "systemplotsuper.h"
 #include "systemplotqcp.h"
@@ -24,6 +25,7 @@
 #include <QDateTime>
 #include <QFileDialog>
 #include <QDir>
+#include <QThread>
 
 #include <QJsonDocument>
 #include <QJsonArray>
@@ -34,7 +36,7 @@
 #include <StandardStream.h>
 
 StandardStream sserr;
-OPS_Stream *opserrPtr = &sserr;
+thread_local OPS_Stream *opserrPtr = &sserr;
 
 //SimulationInformation simulationInfo;
 
@@ -117,10 +119,17 @@ MainWindow::MainWindow(bool graphicsModeQCP, QWidget *parent) :
     ui->Interface12Ctrl->setRange(-100,100);                              // display units is %
     ui->BaseDisplacementCtrl->setRange(-100,100);                         // display units is %
 
-    /* connect a FEA modeler */
-    pileFEAmodel = new PileFEAmodeler();
+    /* connect a FEA modeler running in its own thread */
+    analysisThread = new QThread(this);
+    analysisWorker = new AnalysisWorker();
+    analysisWorker->moveToThread(analysisThread);
+
+    connect(analysisThread, SIGNAL(finished()), analysisWorker, SLOT(deleteLater()));
+    connect(analysisWorker, SIGNAL(resultsReady(AnalysisResults)), this, SLOT(onAnalysisResultsReady(AnalysisResults)));
+
+    analysisThread->start();
+
     loadControlType = LoadControlType::ForceControl;
-    pileFEAmodel->setLoadType(loadControlType);
 
     // setup data
     numPiles = 1;
@@ -206,9 +215,12 @@ MainWindow::MainWindow(bool graphicsModeQCP, QWidget *parent) :
 
 MainWindow::~MainWindow()
 {
-    delete ui;
+    // stop the analysis thread (this also deletes the worker)
+    analysisWorker->cancel();
+    analysisThread->quit();
+    analysisThread->wait();
 
-    if (pileFEAmodel != nullptr) delete pileFEAmodel;
+    delete ui;
 }
 
 void MainWindow::refreshUI() {
@@ -255,12 +267,13 @@ void MainWindow::doAnalysis(void)
 {
     if (inSetupState) return;
 
+    AnalysisRequest request;
+
+    request.serial = ++analysisSerial;
+
     //
-    // create pile information for plotting
+    // create pile information
     //
-    QVector<PILE_INFO> pileInfo;
-
-    pileInfo.clear();
     for (int i=0; i<numPiles; i++)
     {
         PILE_INFO thisPile;
@@ -269,78 +282,90 @@ void MainWindow::doAnalysis(void)
         thisPile.pileDiameter = pileDiameter[i];
         thisPile.xOffset      = xOffset[i];
         thisPile.E            = E[i];
-        pileInfo.append(thisPile);
+        request.pileInfo.append(thisPile);
     }
-    pileFEAmodel->updatePiles(pileInfo);
+
+    request.minElementsPerLayer = minElementsPerLayer;
+    request.maxElementsPerLayer = maxElementsPerLayer;
+    request.numElementsInAir    = numElementsInAir;
+    request.useWinklerElements  = useWinklerElements;
 
     //
     // switches
     //
-    pileFEAmodel->updateSwitches(useToeResistance, assumeRigidPileHeadConnection);
+    request.useToeResistance              = useToeResistance;
+    request.assumeRigidPileHeadConnection = assumeRigidPileHeadConnection;
 
     //
-    // set the soil layer information
+    // soil layers and ground water table
     //
-    pileFEAmodel->updateSoil(mSoilLayers);
+    request.soilLayers = mSoilLayers;
+    request.gwtDepth   = gwtDepth;
 
     //
-    // update ground water table
+    // load control type and data
     //
-    pileFEAmodel->updateGWtable(gwtDepth);
+    request.loadControlType = loadControlType;
 
-    //
-    // set the load control type
-    //
-    pileFEAmodel->setLoadType(loadControlType);
+    request.P     = P;
+    request.PV    = PV;
+    request.PMom  = PMom;
+    request.HDisp = HDisp;
+    request.VDisp = VDisp;
 
-    //
-    // update the load control data
-    //
-    switch (loadControlType) {
-    case LoadControlType::ForceControl:
-        pileFEAmodel->updateLoad(P, PV, PMom);
-        break;
-    case LoadControlType::PushOver:
-        pileFEAmodel->updateDisplacement(HDisp, VDisp);
-        break;
-    case LoadControlType::SoilMotion:
-        QVector<double> profile;
-        profile.append(surfaceDisp);
-        profile.append(percentage12);
-        profile.append(percentage23);
-        profile.append(percentageBase);
-        pileFEAmodel->updateDispProfile(profile);
-        break;
-    }
+    request.dispProfile.append(surfaceDisp);
+    request.dispProfile.append(percentage12);
+    request.dispProfile.append(percentage23);
+    request.dispProfile.append(percentageBase);
 
     //
-    // run the analysis
+    // run the analysis -- results arrive through onAnalysisResultsReady()
     //
-    bool converged = pileFEAmodel->doAnalysis();
-    systemPlot->setSystemStable(converged);
+    analysisWorker->submit(request);
+}
+
+void MainWindow::onAnalysisResultsReady(const AnalysisResults &results)
+{
+    // never go back to an older state
+    if (results.serial < analysisResults.serial) return;
+
+    analysisResults = results;
+
+    systemPlot->setSystemStable(results.converged);
 
     //
     // plot results
     //
     this->updateResultPlots();
+    systemPlot->refresh();
+}
+
+/*
+ * pointer lists as expected by the plot classes; the pointers refer
+ * into analysisResults and remain valid until the next results arrive
+ */
+static QVector<QVector<double> *> dataPointers(QVector<QVector<double>> &data)
+{
+    QVector<QVector<double> *> ptrs;
+    for (int i=0; i<data.size(); i++) { ptrs.append(&data[i]); }
+    return ptrs;
 }
 
 void MainWindow::updateResultPlots()
 {
-    // this should call the results update from the analysis modeler and the plot methods
+    // results are a copy of the modeler's data made by the analysis thread (see onAnalysisResultsReady)
+
+    QVector<QVector<double> *> pos = dataPointers(analysisResults.location);
 
     //
     // send deformations to systemPlot
     //
 
-    QList<QVector<QVector<double> *> *> list;
-    list = pileFEAmodel->getLateralDisplacements();
-    if (list.size() >= 2)
+    if (analysisResults.values.contains(PilePlotData::LateralDisplacement)
+            && analysisResults.values.contains(PilePlotData::AxialDisplacement))
     {
-        QVector<QVector<double> *> &pos   = *list[0];
-        QVector<QVector<double> *> &dispU = *list[1];
-        list = pileFEAmodel->getAxialDisplacements();
-        QVector<QVector<double> *> &dispV = *list[1];
+        QVector<QVector<double> *> dispU = dataPointers(analysisResults.values[PilePlotData::LateralDisplacement]);
+        QVector<QVector<double> *> dispV = dataPointers(analysisResults.values[PilePlotData::AxialDisplacement]);
 
         this->systemPlot->updatePileDeformation(pos, dispU, dispV);
     }
@@ -356,73 +381,63 @@ void MainWindow::updateResultPlots()
     //
 
     // lateral displacements
-    if (showDisplacements) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getLateralDisplacements();
-        if (list.size() >= 2)
-            displPlot->plotResults(*list[0], *list[1], "Depth [m]", "Lateral Displacement [m]");
+    if (showDisplacements && analysisResults.values.contains(PilePlotData::LateralDisplacement)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::LateralDisplacement]);
+        displPlot->plotResults(pos, data, "Depth [m]", "Lateral Displacement [m]");
     }
 
     // axial displacements
-    if (showPullOut) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getAxialDisplacements();
-        if (list.size() >= 2)
-            pullOutPlot->plotResults(*list[0], *list[1], "Depth [m]", "Axial Displacement [m]");
+    if (showPullOut && analysisResults.values.contains(PilePlotData::AxialDisplacement)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::AxialDisplacement]);
+        pullOutPlot->plotResults(pos, data, "Depth [m]", "Axial Displacement [m]");
     }
 
     // axial
-    if (showAxial) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getForce();
-        if (list.size() >= 2)
-            axialPlot->plotResults(*list[0], *list[1], "Depth [m]", "Axial Force [kN]");
+    if (showAxial && analysisResults.values.contains(PilePlotData::PileAxialForce)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::PileAxialForce]);
+        axialPlot->plotResults(pos, data, "Depth [m]", "Axial Force [kN]");
     }
 
     // shear
-    if (showShear) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getShear();
-        if (list.size() >= 2)
-            shearPlot->plotResults(*list[0], *list[1], "Depth [m]", "Shear Force [kN]");
+    if (showShear && analysisResults.values.contains(PilePlotData::PileShear)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::PileShear]);
+        shearPlot->plotResults(pos, data, "Depth [m]", "Shear Force [kN]");
     }
 
     // moments
-    if (showMoments) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getMoment();
-        if (list.size() >= 2)
-            momentPlot->plotResults(*list[0], *list[1], "Depth [m]", "Pile Moment [kN.m]");
+    if (showMoments && analysisResults.values.contains(PilePlotData::PileMoment)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::PileMoment]);
+        momentPlot->plotResults(pos, data, "Depth [m]", "Pile Moment [kN.m]");
     }
 
     // vertical stress
-    if (showStress) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getStress();
-        if (list.size() >= 2)
-            stressPlot->plotResults(*list[0], *list[1], "Depth [m]", "Effective Stress [kPa]");
+    if (showStress && analysisResults.values.contains(PilePlotData::SoilStress)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::SoilStress]);
+        stressPlot->plotResults(pos, data, "Depth [m]", "Effective Stress [kPa]");
     }
 
     // p_ultimate
-    if (showPultimate) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getPult();
-        if (list.size() >= 2)
-            pultPlot->plotResults(*list[0], *list[1], "Depth [m]", "p_ult [kPa]");
+    if (showPultimate && analysisResults.values.contains(PilePlotData::Pultimate)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::Pultimate]);
+        pultPlot->plotResults(pos, data, "Depth [m]", "p_ult [kPa]");
     }
 
     // y_50
-    if (showY50) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getY50();
-        if (list.size() >= 2)
-            y50Plot->plotResults(*list[0], *list[1], "Depth [m]", "y_50 [m]");
+    if (showY50 && analysisResults.values.contains(PilePlotData::Y50)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::Y50]);
+        y50Plot->plotResults(pos, data, "Depth [m]", "y_50 [m]");
     }
 
     // t_ultimate
-    if (showTultimate) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getTult();
-        if (list.size() >= 2)
-            tultPlot->plotResults(*list[0], *list[1], "Depth [m]", "t_ult [kPa]");
+    if (showTultimate && analysisResults.values.contains(PilePlotData::Tultimate)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::Tultimate]);
+        tultPlot->plotResults(pos, data, "Depth [m]", "t_ult [kPa]");
     }
 
     // z_50
-    if (showZ50) {
-        QList<QVector<QVector<double> *> *> list = pileFEAmodel->getZ50();
-        if (list.size() >= 2)
-            z50Plot->plotResults(*list[0], *list[1], "Depth [m]", "z_50 [m]");
+    if (showZ50 && analysisResults.values.contains(PilePlotData::Z50)) {
+        QVector<QVector<double> *> data = dataPointers(analysisResults.values[PilePlotData::Z50]);
+        z50Plot->plotResults(pos, data, "Depth [m]", "z_50 [m]");
     }
 }
 
@@ -617,8 +632,8 @@ void MainWindow::on_actionExport_to_OpenSees_triggered()
 
     if (fileName != "")
     {
-        //pileFEAmodel->dumpDomain("domainDump.tcl");
-        pileFEAmodel->writeFEMinput(fileName);
+        // the export runs in the analysis thread, after any pending analysis
+        QMetaObject::invokeMethod(analysisWorker, "exportModel", Qt::QueuedConnection, Q_ARG(QString, fileName));
     }
 }
 
@@ -663,6 +678,7 @@ void MainWindow::on_actionReset_triggered()
     minElementsPerLayer = MIN_ELEMENTS_PER_LAYER;
     maxElementsPerLayer = MAX_ELEMENTS_PER_LAYER;
     numElementsInAir    = NUM_ELEMENTS_IN_AIR;
+    useWinklerElements  = false;
 
     // set up initial values before activating live analysis (= connecting the slots)
     //    or the program will fail in the analysis due to missing information
@@ -1392,6 +1408,7 @@ bool MainWindow::ReadFile(QString s)
     minElementsPerLayer = FEAparameters["minElementsPerLayer"].toInt();
     maxElementsPerLayer = FEAparameters["maxElementsPerLayer"].toInt();
     numElementsInAir    = FEAparameters["numElementsInAir"].toInt();
+    useWinklerElements  = FEAparameters["useWinklerElements"].toBool();
 
     if (minElementsPerLayer < MIN_ELEMENTS_PER_LAYER)   minElementsPerLayer = MIN_ELEMENTS_PER_LAYER;
     if (maxElementsPerLayer > 3*MAX_ELEMENTS_PER_LAYER) maxElementsPerLayer = 3*MAX_ELEMENTS_PER_LAYER;
@@ -1519,6 +1536,7 @@ bool MainWindow::WriteFile(QString s)
     FEAparameters.insert("minElementsPerLayer",minElementsPerLayer);
     FEAparameters.insert("maxElementsPerLayer",maxElementsPerLayer);
     FEAparameters.insert("numElementsInAir", numElementsInAir);
+    FEAparameters.insert("useWinklerElements", useWinklerElements);
 
     json->insert("FEAparameters", FEAparameters);
 
@@ -1582,7 +1600,6 @@ void MainWindow::on_forceTypeSelector_activated(int index)
     }
 
     systemPlot->setLoadType(loadControlType);
-    pileFEAmodel->setLoadType(loadControlType);
     this->doAnalysis();
 }
 
@@ -7,12 +7,13 @@ class QNetworkAccessManager;
 #include <QMainWindow>
 #include <QtNetwork/QNetworkReply>
 #include "pilegrouptool_parameters.h"
+#include "analysisworker.h"
 
 // forward declaration of classes
 class soilLayer;
 class QTableWidgetItem;
 class QSettings;
-class PileFEAmodeler;
+class QThread;
 class SystemPlotSuper;
 class ResultPlotSuper;
 
@@ -116,12 +117,20 @@ private slots:
     void onSystemPlot_soilLayerSelected(int );
     void onSystemPlot_groundWaterSelected();
 
+    // response to signals from the analysis thread
+    void onAnalysisResultsReady(const AnalysisResults &);
+
 private:
     Q_OBJECT
     Ui::MainWindow *ui;
 
     SystemPlotSuper *systemPlot = nullptr;
-    PileFEAmodeler *pileFEAmodel = nullptr;
+
+    // the FEA modeler lives in its own thread
+    QThread         *analysisThread = nullptr;
+    AnalysisWorker  *analysisWorker = nullptr;
+    AnalysisResults  analysisResults;
+    int              analysisSerial = 0;
 
     void updateSystemPlot();
     void refreshUI();
@@ -201,6 +210,7 @@ private:
     int minElementsPerLayer = MIN_ELEMENTS_PER_LAYER;
     int maxElementsPerLayer = MAX_ELEMENTS_PER_LAYER;
     int numElementsInAir    = NUM_ELEMENTS_IN_AIR;
+    bool useWinklerElements = false;
 
     double L1;                      // pile length above ground (all the same)
     double L2[MAXPILES];            // embedded length of pile
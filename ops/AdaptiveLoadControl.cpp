@@ -0,0 +1,247 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/AdaptiveLoadControl.cpp,v $
+
+
+// Description: This file contains the implementation for AdaptiveLoadControl.
+
+#include <AdaptiveLoadControl.h>
+#include <AnalysisModel.h>
+#include <LinearSOE.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+#include <Channel.h>
+
+// a step changes by no more than these factors relative to the last one
+#define MIN_STEP_FACTOR 0.5
+#define MAX_STEP_FACTOR 2.0
+
+// tolerance on reaching the final load factor
+#define LAMBDA_TOL 1.0e-10
+
+AdaptiveLoadControl::AdaptiveLoadControl(double dLambda, int numIterDesired,
+					 double min, double max, double final)
+:StaticIntegrator(INTEGRATOR_TAGS_AdaptiveLoadControl),
+ deltaLambda(dLambda), stepLambda(0.0),
+ specNumIncrStep(numIterDesired), numIncrLastStep(numIterDesired),
+ dLambdaMin(min), dLambdaMax(max), finalLambda(final), numCutBacks(0),
+ theTest(0)
+{
+  // to avoid divide-by-zero error on first newStep() ensure numIterDesired != 0
+  if (numIterDesired <= 0) {
+    opserr << "WARNING AdaptiveLoadControl::AdaptiveLoadControl() - numIterDesired set to 0, 1 assumed\n";
+    specNumIncrStep = 1.0;
+    numIncrLastStep = 1.0;
+  }
+}
+
+AdaptiveLoadControl::~AdaptiveLoadControl()
+{
+
+}
+
+int
+AdaptiveLoadControl::newStep(void)
+{
+    AnalysisModel *theModel = this->getAnalysisModel();
+    if (theModel == 0) {
+	opserr << "AdaptiveLoadControl::newStep() - no associated AnalysisModel\n";
+	return -1;
+    }
+
+    // determine delta lambda for this step based on dLambda and #iter of last step
+    if (numIncrLastStep > 0) {
+      double factor = specNumIncrStep/numIncrLastStep;
+      if (factor < MIN_STEP_FACTOR)
+	factor = MIN_STEP_FACTOR;
+      else if (factor > MAX_STEP_FACTOR)
+	factor = MAX_STEP_FACTOR;
+      deltaLambda *= factor;
+    }
+
+    if (deltaLambda < dLambdaMin)
+      deltaLambda = dLambdaMin;
+    else if (deltaLambda > dLambdaMax)
+      deltaLambda = dLambdaMax;
+
+    // don't step past the final load factor, nor leave a remainder below dLambdaMin
+    double currentLambda = theModel->getCurrentDomainTime();
+    double remaining = finalLambda - currentLambda;
+
+    stepLambda = deltaLambda;
+    if (remaining - stepLambda < dLambdaMin)
+      stepLambda = remaining;
+
+    currentLambda += stepLambda;
+    theModel->applyLoadDomain(currentLambda);
+
+    // the next step is as large unless commit() counts the iterations of this one
+    numIncrLastStep = specNumIncrStep;
+
+    return 0;
+}
+
+int
+AdaptiveLoadControl::update(const Vector &deltaU)
+{
+    AnalysisModel *myModel = this->getAnalysisModel();
+    LinearSOE *theSOE = this->getLinearSOE();
+    if (myModel == 0 || theSOE == 0) {
+	opserr << "WARNING AdaptiveLoadControl::update() ";
+	opserr << "No AnalysisModel or LinearSOE has been set\n";
+	return -1;
+    }
+
+    myModel->incrDisp(deltaU);
+    if (myModel->updateDomain() < 0) {
+      opserr << "AdaptiveLoadControl::update - model failed to update for new dU\n";
+      return -1;
+    }
+
+    // Set deltaU for the convergence test
+    theSOE->setX(deltaU);
+
+    return 0;
+}
+
+int
+AdaptiveLoadControl::commit(void)
+{
+    // the iterations the algorithm needed for the converged step
+    if (theTest != 0 && theTest->getNumTests() > 0)
+      numIncrLastStep = theTest->getNumTests();
+
+    return this->StaticIntegrator::commit();
+}
+
+int
+AdaptiveLoadControl::revertToLastStep(void)
+{
+    // the failed step is repeated with half the increment
+    deltaLambda = 0.5*stepLambda;
+    numIncrLastStep = specNumIncrStep;
+    numCutBacks++;
+
+    return this->StaticIntegrator::revertToLastStep();
+}
+
+int
+AdaptiveLoadControl::setDeltaLambda(double newValue)
+{
+  // we set the #incr at last step = #incr so get newValue incr
+  numIncrLastStep = specNumIncrStep;
+  deltaLambda = newValue;
+  numCutBacks = 0;
+  return 0;
+}
+
+int
+AdaptiveLoadControl::setConvergenceTest(ConvergenceTest *newTest)
+{
+  theTest = newTest;
+  return 0;
+}
+
+int
+AdaptiveLoadControl::setFinalLambda(double newValue)
+{
+  finalLambda = newValue;
+  return 0;
+}
+
+int
+AdaptiveLoadControl::undoCutBack(void)
+{
+    // the next step repeats the failed one with its full increment
+    deltaLambda = stepLambda;
+    numIncrLastStep = specNumIncrStep;
+    numCutBacks--;
+    return 0;
+}
+
+bool
+AdaptiveLoadControl::isComplete(void)
+{
+    AnalysisModel *theModel = this->getAnalysisModel();
+    if (theModel == 0)
+      return false;
+
+    return (theModel->getCurrentDomainTime() >= finalLambda - LAMBDA_TOL);
+}
+
+bool
+AdaptiveLoadControl::canCutBack(void)
+{
+    // after a failure deltaLambda holds the halved step
+    return (deltaLambda >= dLambdaMin);
+}
+
+int
+AdaptiveLoadControl::sendSelf(int cTag,
+			      Channel &theChannel)
+{
+  Vector data(6);
+  data(0) = deltaLambda;
+  data(1) = specNumIncrStep;
+  data(2) = numIncrLastStep;
+  data(3) = dLambdaMin;
+  data(4) = dLambdaMax;
+  data(5) = finalLambda;
+  if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
+      opserr << "AdaptiveLoadControl::sendSelf() - failed to send the Vector\n";
+      return -1;
+  }
+  return 0;
+}
+
+int
+AdaptiveLoadControl::recvSelf(int cTag,
+			      Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  Vector data(6);
+  if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
+      opserr << "AdaptiveLoadControl::recvSelf() - failed to receive the Vector\n";
+      deltaLambda = 0;
+      return -1;
+  }
+  deltaLambda = data(0);
+  specNumIncrStep = data(1);
+  numIncrLastStep = data(2);
+  dLambdaMin = data(3);
+  dLambdaMax = data(4);
+  finalLambda = data(5);
+  return 0;
+}
+
+void
+AdaptiveLoadControl::Print(OPS_Stream &s, int flag)
+{
+    AnalysisModel *theModel = this->getAnalysisModel();
+    if (theModel != 0) {
+	double currentLambda = theModel->getCurrentDomainTime();
+	s << "\t AdaptiveLoadControl - currentLambda: " << currentLambda;
+	s << "  deltaLambda: " << deltaLambda;
+	s << "  finalLambda: " << finalLambda << endln;
+    } else
+	s << "\t AdaptiveLoadControl - no associated AnalysisModel\n";
+}
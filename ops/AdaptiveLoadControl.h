@@ -0,0 +1,101 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/AdaptiveLoadControl.h,v $
+
+
+#ifndef AdaptiveLoadControl_h
+#define AdaptiveLoadControl_h
+
+// Description: This file contains the class definition for AdaptiveLoadControl.
+// AdaptiveLoadControl is a load control integration scheme that applies the
+// load up to a final load factor in steps of varying size.  The step grows
+// when the last step needed fewer than the desired number of iterations and
+// shrinks when it needed more; a step that failed to converge is undone by
+// the analysis (revertToLastStep()) and repeated with half the increment.
+// The iterations of a step are taken from the convergence test set with
+// setConvergenceTest() when the step is committed, not from the calls to
+// update(), of which a line search makes several per iteration.  Without a
+// test the step size only changes after a failed step.
+// All steps lie within [minLambda, maxLambda], except for a last step that
+// is shortened to end exactly at the final load factor.
+//
+// The analysis is driven one step at a time until isComplete(); after a
+// failed step canCutBack() tells whether a smaller step is still allowed,
+// undoCutBack() repeats it with the same increment instead.
+//
+// What: "@(#) AdaptiveLoadControl.h, revA"
+
+#include <StaticIntegrator.h>
+
+class LinearSOE;
+class AnalysisModel;
+class FE_Element;
+class Vector;
+class ConvergenceTest;
+
+class AdaptiveLoadControl : public StaticIntegrator
+{
+  public:
+    AdaptiveLoadControl(double deltaLambda, int numIterDesired,
+			double minLambda, double maxLambda,
+			double finalLambda = 1.0);
+
+    ~AdaptiveLoadControl();
+
+    int newStep(void);
+    int update(const Vector &deltaU);
+    int commit(void);
+    int revertToLastStep(void);
+
+    // the test of the algorithm; it must remain valid while it is set
+    int setConvergenceTest(ConvergenceTest *theTest);
+
+    int setDeltaLambda(double newDeltaLambda);
+    int setFinalLambda(double newFinalLambda);
+    int undoCutBack(void);
+
+    bool isComplete(void);
+    bool canCutBack(void);
+    int  getNumCutBacks(void) {return numCutBacks;}
+    double getStepLambda(void) {return stepLambda;}
+
+    // Public methods for Output
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+  protected:
+
+  private:
+    double deltaLambda;            // dlambda for the next step
+    double stepLambda;             // dlambda of the current step
+    double specNumIncrStep, numIncrLastStep; // Jd & J(i-1)
+    double dLambdaMin, dLambdaMax; // min & max values for dlambda
+    double finalLambda;            // load factor at which the analysis is complete
+    int    numCutBacks;            // failed steps since setDeltaLambda()
+    ConvergenceTest *theTest;      // counts the iterations of a step
+};
+
+#endif
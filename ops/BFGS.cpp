@@ -0,0 +1,300 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/BFGS.cpp,v $
+
+
+// Description: This file contains the implementation for BFGS.
+//
+// The increment s = H R is evaluated with the two-loop recursion over the
+// stored pairs (s(i), y(i)), y(i) = R(i) - R(i+1), applying the factored
+// tangent in between.
+//
+// What: "@(#)BFGS.C, revA"
+
+#include <BFGS.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+#include <ID.h>
+
+// Constructor
+BFGS::BFGS(int theTangentToUse, int n)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_BFGS),
+ tangent(theTangentToUse), maxUpdates(n),
+ s(0), y(0), rho(0), alpha(0), residOld(0), temp(0), sizeStorage(0),
+ numIterations(0), numFactorizations(0)
+{
+  if (maxUpdates < 1)
+    maxUpdates = 1;
+}
+
+// Destructor
+BFGS::~BFGS()
+{
+  this->clearStorage();
+}
+
+void
+BFGS::clearStorage(void)
+{
+  if (s != 0) {
+    for (int i=0; i<=maxUpdates; i++)
+      if (s[i] != 0)
+	delete s[i];
+    delete [] s;
+  }
+  if (y != 0) {
+    for (int i=0; i<maxUpdates; i++)
+      if (y[i] != 0)
+	delete y[i];
+    delete [] y;
+  }
+  if (rho != 0)
+    delete [] rho;
+  if (alpha != 0)
+    delete [] alpha;
+  if (residOld != 0)
+    delete residOld;
+  if (temp != 0)
+    delete temp;
+
+  s = 0;
+  y = 0;
+  rho = 0;
+  alpha = 0;
+  residOld = 0;
+  temp = 0;
+  sizeStorage = 0;
+}
+
+int
+BFGS::allocateStorage(int numEqn)
+{
+  if (s != 0 && sizeStorage == numEqn)
+    return 0;
+
+  this->clearStorage();
+
+  s = new Vector *[maxUpdates+1];
+  y = new Vector *[maxUpdates];
+  rho = new double[maxUpdates];
+  alpha = new double[maxUpdates];
+
+  for (int i=0; i<=maxUpdates; i++)
+    s[i] = new Vector(numEqn);
+  for (int i=0; i<maxUpdates; i++)
+    y[i] = new Vector(numEqn);
+
+  residOld = new Vector(numEqn);
+  temp = new Vector(numEqn);
+
+  sizeStorage = numEqn;
+
+  return 0;
+}
+
+int
+BFGS::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING BFGS::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    this->allocateStorage(theSOE->getNumEqn());
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING BFGS::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	return -2;
+    }
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "BFGS::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    int result = -1;
+    numIterations = 0;
+
+    do {
+	// a Newton iteration with a freshly formed tangent
+	SOLUTION_ALGORITHM_tangentFlag = tangent;
+	if (theIntegrator->formTangent(tangent) < 0){
+	    opserr << "WARNING BFGS::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formTangent()\n";
+	    return -1;
+	}
+	numFactorizations++;
+
+	*residOld = theSOE->getB();
+
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING BFGS::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";
+	    return -3;
+	}
+
+	*(s[0]) = theSOE->getX();
+
+	if (theIntegrator->update(*(s[0])) < 0) {
+	    opserr << "WARNING BFGS::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";
+	    return -4;
+	}
+
+	if (theIntegrator->formUnbalance() < 0) {
+	    opserr << "WARNING BFGS::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";
+	    return -2;
+	}
+
+	result = theTest->test();
+	numIterations++;
+	this->record(numIterations);
+
+	// quasi-Newton iterations with the same factorization
+	int k = 0;
+	while (result == -1 && k < maxUpdates) {
+
+	    const Vector &R = theSOE->getB();
+
+	    // new pair -- skipped (new tangent) without positive curvature
+	    Vector &yk = *(y[k]);
+	    yk = *residOld;
+	    yk -= R;
+
+	    double ys = yk ^ *(s[k]);
+	    if (ys <= 0.0)
+		break;
+
+	    rho[k] = 1.0/ys;
+	    *residOld = R;
+	    k++;
+
+	    // two-loop recursion: q = R, back to front
+	    *temp = R;
+	    for (int i=k-1; i>=0; i--) {
+		alpha[i] = rho[i] * (*(s[i]) ^ *temp);
+		temp->addVector(1.0, *(y[i]), -alpha[i]);
+	    }
+
+	    if (theSOE->setB(*temp) < 0 || theSOE->solve() < 0) {
+		opserr << "WARNING BFGS::solveCurrentStep() -";
+		opserr << "the LinearSysOfEqn failed in solve()\n";
+		return -3;
+	    }
+
+	    // ... and front to back
+	    Vector &sk = *(s[k]);
+	    sk = theSOE->getX();
+	    for (int i=0; i<k; i++) {
+		double beta = rho[i] * (*(y[i]) ^ sk);
+		sk.addVector(1.0, *(s[i]), alpha[i] - beta);
+	    }
+
+	    if (theIntegrator->update(sk) < 0) {
+		opserr << "WARNING BFGS::solveCurrentStep() -";
+		opserr << "the Integrator failed in update()\n";
+		return -4;
+	    }
+
+	    if (theIntegrator->formUnbalance() < 0) {
+		opserr << "WARNING BFGS::solveCurrentStep() -";
+		opserr << "the Integrator failed in formUnbalance()\n";
+		return -2;
+	    }
+
+	    result = theTest->test();
+	    numIterations++;
+	    this->record(numIterations);
+	}
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "BFGS::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+int
+BFGS::sendSelf(int cTag, Channel &theChannel)
+{
+  static ID data(2);
+  data(0) = tangent;
+  data(1) = maxUpdates;
+  return theChannel.sendID(this->getDbTag(), cTag, data);
+}
+
+int
+BFGS::recvSelf(int cTag,
+	       Channel &theChannel,
+	       FEM_ObjectBroker &theBroker)
+{
+  static ID data(2);
+  theChannel.recvID(this->getDbTag(), cTag, data);
+  this->clearStorage();
+  tangent = data(0);
+  maxUpdates = data(1);
+  return 0;
+}
+
+void
+BFGS::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "BFGS -count " << maxUpdates << endln;
+  }
+}
+
+int
+BFGS::getNumIterations(void)
+{
+  return numIterations;
+}
+
+int
+BFGS::getNumFactorizations(void)
+{
+  return numFactorizations;
+}
@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/BFGS.h,v $
+
+
+#ifndef BFGS_h
+#define BFGS_h
+
+// Description: This file contains the class definition for BFGS.
+// BFGS forms and factors the tangent at the start of a step and then
+// improves the inverse of it with BFGS updates built from the displacement
+// increments and the changes in the unbalance (limited memory form, the
+// factored tangent serving as the initial inverse).  Each iteration costs
+// one back substitution.  After maxUpdates updates, or if an increment
+// shows no positive curvature, the tangent is formed again.  Meant for
+// symmetric tangents.
+//
+// What: "@(#)BFGS.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class Vector;
+
+class BFGS: public EquiSolnAlgo
+{
+  public:
+    BFGS(int tangent = CURRENT_TANGENT, int maxUpdates = 10);
+    ~BFGS();
+
+    int solveCurrentStep(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    void clearStorage(void);
+    int  allocateStorage(int numEqn);
+
+    int tangent;
+    int maxUpdates;
+
+    Vector **s;        // displacement increments
+    Vector **y;        // unbalance reductions R(i) - R(i+1)
+    double  *rho;      // 1/(y(i)^T s(i))
+    double  *alpha;
+    Vector  *residOld; // unbalance before the last increment
+    Vector  *temp;
+    int      sizeStorage;
+
+    int numIterations;
+    int numFactorizations;
+};
+
+#endif
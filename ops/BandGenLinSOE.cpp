@@ -189,6 +189,7 @@ BandGenLinSOE::setSize(Graph &theGraph)
 	A[i] = 0;
 	
     factored = false;
+    this->newStorageStamp();
     
     if (size > Bsize) { // we have to get space for the vectors
 	
@@ -321,6 +322,70 @@ BandGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 
 
 
+// the map holds for entry (j,i) of the matrix, in column order, its
+// location in A, or -1 if it is not assembled
+int 
+BandGenLinSOE::formScatterMap(const ID &id, ID &map)
+{
+    int idSize = id.Size();
+    if (map.resize(idSize*idSize) < 0)
+	return -1;
+
+    int ldA = 2*numSubD + numSuperD + 1;
+    int loc = 0;
+
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    int pos = -1;
+	    if (col < size && col >= 0 && row < size && row >= 0) {
+		int diff = col - row;
+		if (diff <= numSuperD && -diff <= numSubD)
+		    pos = col*ldA + numSubD + numSuperD - diff;
+	    }
+	    map(loc++) = pos;
+	}
+    }
+
+    return 0;
+}
+
+
+int 
+BandGenLinSOE::addAScatter(const Matrix &m, const ID &map, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    int idSize = m.noRows();
+    if (idSize != m.noCols() || idSize*idSize != map.Size()) {
+	opserr << "BandGenLinSOE::addAScatter()	- Matrix and map not of similar sizes\n";
+	return -1;
+    }
+
+    int loc = 0;
+
+    if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++)
+	    for (int j=0; j<idSize; j++) {
+		int pos = map(loc++);
+		if (pos >= 0)
+		    A[pos] += m(j,i);
+	    }
+    } else {
+	for (int i=0; i<idSize; i++)
+	    for (int j=0; j<idSize; j++) {
+		int pos = map(loc++);
+		if (pos >= 0)
+		    A[pos] += m(j,i) * fact;
+	    }
+    }
+
+    return 0;
+}
+
+
 int 
 BandGenLinSOE::addColA(const Vector &colData, int col, double fact)
 {
@@ -58,6 +58,8 @@ class BandGenLinSOE : public LinearSOE
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int formScatterMap(const ID &id, ID &map);
+    virtual int addAScatter(const Matrix &, const ID &map, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
 
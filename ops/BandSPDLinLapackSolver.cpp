@@ -0,0 +1,334 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-18 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.cpp,v $
+                                                                        
+                                                                        
+// Written: fmk 
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// BandSPDLinLapackSolver. It solves the BandSPDLinSOE object by calling
+// the Lapack Cholesky routines, falling back on the general band
+// routines if the matrix turns out not to be positive definite.
+//
+// What: "@(#) BandSPDLinLapackSolver.C, revA"
+
+#include <BandSPDLinLapackSolver.h>
+#include <BandSPDLinSOE.h>
+#include <math.h>
+#include <iostream>
+using std::nothrow;
+
+void* OPS_BandSPDLinLapack()
+{
+    BandSPDLinSolver *theSolver = new BandSPDLinLapackSolver();
+    BandSPDLinSOE *theSOE = new BandSPDLinSOE(*theSolver);
+    return theSOE;
+}
+
+BandSPDLinLapackSolver::BandSPDLinLapackSolver()
+:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinLapackSolver),
+ Acopy(0), AcopySize(0), Agen(0), AgenSize(0), iPiv(0), iPivSize(0),
+ useGeneral(false), numFallbacks(0)
+{
+    
+}
+
+BandSPDLinLapackSolver::~BandSPDLinLapackSolver()
+{
+    if (Acopy != 0)
+	delete [] Acopy;
+    if (Agen != 0)
+	delete [] Agen;
+    if (iPiv != 0)
+	delete [] iPiv;
+}
+
+#ifdef _WIN32
+
+extern "C" int DPBSV(char *UPLO,
+			      int *N, int *KD, int *NRHS, 
+			      double *A, int *LDA, double *B, int *LDB, 
+			      int *INFO);
+
+extern "C" int DPBTRS(char *UPLO,
+			       int *N, int *KD, int *NRHS, 
+			       double *A, int *LDA, double *B, int *LDB, 
+			       int *INFO);
+
+extern "C" int DGBSV(int *N, int *KL, int *KU, int *NRHS, double *A, 
+			      int *LDA, int *iPiv, double *B, int *LDB, 
+			      int *INFO);
+
+extern "C" int DGBTRS(char *TRANS, 
+			       int *N, int *KL, int *KU, int *NRHS,
+			       double *A, int *LDA, int *iPiv, 
+			       double *B, int *LDB, int *INFO);
+
+#else
+
+extern "C" int dpbsv_(char *UPLO, int *N, int *KD, int *NRHS, 
+		      double *A, int *LDA, double *B, int *LDB, 
+		      int *INFO);
+
+extern "C" int dpbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
+		       double *A, int *LDA, double *B, int *LDB, 
+		       int *INFO);
+
+extern "C" int dgbsv_(int *N, int *KL, int *KU, int *NRHS, double *A, 
+		      int *LDA, int *iPiv, double *B, int *LDB, int *INFO);
+
+extern "C" int dgbtrs_(char *TRANS, int *N, int *KL, int *KU, int *NRHS, 
+		       double *A, int *LDA, int *iPiv, double *B, int *LDB, 
+		       int *INFO);
+#endif
+
+int
+BandSPDLinLapackSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BandSPDLinLapackSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    int kd = theSOE->half_band - 1;
+    int ldA = kd + 1;
+    int nrhs = 1;
+    int ldB = n;
+    int info;
+    double *Aptr = theSOE->A;
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+
+    // first copy B into X
+    for (int i=0; i<n; i++) {
+	*(Xptr++) = *(Bptr++);
+    }
+    Xptr = theSOE->X;
+
+    if (theSOE->factored == true) {
+	if (useGeneral == true)
+	    return this->solveGeneral();
+
+	// solve only using the Cholesky factor
+	char uplo[] = "U";
+#ifdef _WIN32
+	DPBTRS(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#else
+	dpbtrs_(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#endif
+	if (info != 0) {
+	    opserr << "WARNING BandSPDLinLapackSolver::solve() -";
+	    opserr << "LAPACK routine returned " << info << endln;
+	    return -info;
+	}
+	return 0;
+    }
+
+    // a new matrix: keep a copy in case the Cholesky factorization fails
+    useGeneral = false;
+    int Asize = n * ldA;
+    if (AcopySize < Asize) {
+	opserr << "WARNING BandSPDLinLapackSolver::solve(void)- ";
+	opserr << " work area not large enough - has setSize() been called?\n";
+	return -1;
+    }
+    for (int i=0; i<Asize; i++)
+	Acopy[i] = Aptr[i];
+
+    // factor and solve 
+    char uplo[] = "U";
+#ifdef _WIN32
+    DPBSV(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#else
+    dpbsv_(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#endif
+
+    if (info > 0) {
+	// not positive definite - restore A and X, solve as a general band
+	if (numFallbacks == 0) {
+	    opserr << "WARNING BandSPDLinLapackSolver::solve() -";
+	    opserr << " matrix not positive definite, using general band solver\n";
+	}
+	numFallbacks++;
+
+	for (int i=0; i<Asize; i++)
+	    Aptr[i] = Acopy[i];
+
+	Bptr = theSOE->B;
+	for (int i=0; i<n; i++)
+	    Xptr[i] = Bptr[i];
+
+	useGeneral = true;
+	theSOE->factored = false;
+	info = this->solveGeneral();
+	if (info == 0)
+	    theSOE->factored = true;
+	return info;
+    }
+
+    // check if successfull
+    if (info != 0) {
+	opserr << "WARNING BandSPDLinLapackSolver::solve() -";
+	opserr << "LAPACK routine returned " << info << endln;
+	return -info;
+    }
+
+    theSOE->factored = true;
+    return 0;
+}
+
+
+int
+BandSPDLinLapackSolver::solveGeneral(void)
+{
+    int n = theSOE->size;
+    int kl = theSOE->half_band - 1;
+    int ku = kl;
+    int ldA = 2*kl + ku + 1;
+    int nrhs = 1;
+    int ldB = n;
+    int info;
+    double *Xptr = theSOE->X;
+
+    if (theSOE->factored == false) {
+
+	// storage for the general band is only obtained when first needed
+	int newSize = n * ldA;
+	if (AgenSize < newSize) {
+	    if (Agen != 0)
+		delete [] Agen;
+	    Agen = new (nothrow) double[newSize];
+	    if (Agen == 0) {
+		opserr << "WARNING BandSPDLinLapackSolver::solve() ";
+		opserr << " - ran out of memory for general band of size ";
+		opserr << newSize << endln;
+		AgenSize = 0;
+		return -1;
+	    }
+	    AgenSize = newSize;
+	}
+	if (iPivSize < n) {
+	    if (iPiv != 0)
+		delete [] iPiv;
+	    iPiv = new (nothrow) int[n];
+	    if (iPiv == 0) {
+		opserr << "WARNING BandSPDLinLapackSolver::solve() ";
+		opserr << " - ran out of memory for iPiv of size ";
+		opserr << n << endln;
+		iPivSize = 0;
+		return -1;
+	    }
+	    iPivSize = n;
+	}
+
+	// expand the upper band into both triangles of the general band;
+	// A(i,j) goes to Agen[kl+ku+i-j + j*ldA]
+	for (int i=0; i<newSize; i++)
+	    Agen[i] = 0.0;
+
+	int halfBand = theSOE->half_band;
+	for (int j=0; j<n; j++) {
+	    double *colPtr = Acopy + (j+1)*halfBand - 1;
+	    for (int diff=0; diff<halfBand && diff<=j; diff++) {
+		int i = j - diff;
+		double aij = *(colPtr - diff);
+		Agen[kl+ku+i-j + j*ldA] = aij;
+		Agen[kl+ku+j-i + i*ldA] = aij;
+	    }
+	}
+
+#ifdef _WIN32
+	DGBSV(&n,&kl,&ku,&nrhs,Agen,&ldA,iPiv,Xptr,&ldB,&info);
+#else
+	dgbsv_(&n,&kl,&ku,&nrhs,Agen,&ldA,iPiv,Xptr,&ldB,&info);
+#endif
+    } else {
+	char temp[] = "N";
+#ifdef _WIN32
+	DGBTRS(temp,&n,&kl,&ku,&nrhs,Agen,&ldA,iPiv,Xptr,&ldB,&info);
+#else
+	dgbtrs_(temp,&n,&kl,&ku,&nrhs,Agen,&ldA,iPiv,Xptr,&ldB,&info);
+#endif
+    }
+
+    if (info != 0) {
+	opserr << "WARNING BandSPDLinLapackSolver::solve() -";
+	opserr << "LAPACK routine returned " << info << endln;
+	return -info;
+    }
+
+    return 0;
+}
+
+
+int
+BandSPDLinLapackSolver::setSize()
+{
+    int newSize = theSOE->size * theSOE->half_band;
+
+    // if the copy of A is not big enough, free it and get one large enough
+    if (AcopySize < newSize) {
+	if (Acopy != 0)
+	    delete [] Acopy;
+	
+	Acopy = new (nothrow) double[newSize];
+	if (Acopy == 0) {
+	    opserr << "WARNING BandSPDLinLapackSolver::setSize() ";
+	    opserr << " - ran out of memory for work area of size ";
+	    opserr << newSize << endln;
+	    AcopySize = 0;
+	    return -1;
+	} else
+	    AcopySize = newSize;
+    }
+
+    useGeneral = false;
+    return 0;
+}
+
+
+int
+BandSPDLinLapackSolver::getNumFallbacks(void) const
+{
+    return numFallbacks;
+}
+
+
+int    
+BandSPDLinLapackSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+int
+BandSPDLinLapackSolver::recvSelf(int commitTag,
+				 Channel &theChannel, 
+				 FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
+
@@ -0,0 +1,76 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-18 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h,v $
+                                                                        
+                                                                        
+// Description: This file contains the class definition for 
+// BandSPDLinLapackSolver. It solves the BandSPDLinSOE object by calling
+// the Lapack Cholesky routines dpbsv/dpbtrs.
+//
+// The tangent of a nonlinear model is not guaranteed to stay positive
+// definite.  If the Cholesky factorization breaks down, the solver
+// expands the band to the general storage scheme and solves with
+// dgbsv/dgbtrs (partial pivoting) instead; a copy of A is kept for this
+// purpose.  The fallback remains in effect until A is formed again.
+//
+// What: "@(#) BandSPDLinLapackSolver.h, revA"
+
+#ifndef BandSPDLinLapackSolver_h
+#define BandSPDLinLapackSolver_h
+
+#include <BandSPDLinSolver.h>
+
+class BandSPDLinLapackSolver : public BandSPDLinSolver
+{
+  public:
+    BandSPDLinLapackSolver();    
+    ~BandSPDLinLapackSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int getNumFallbacks(void) const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+
+  private:
+    int solveGeneral(void);
+
+    double *Acopy;       // A before factorization, for the fallback
+    int AcopySize;
+
+    double *Agen;        // A in general band storage, fallback only
+    int AgenSize;
+    int *iPiv;
+    int iPivSize;
+
+    bool useGeneral;     // current A is factored by dgbsv
+    int numFallbacks;
+};
+
+#endif
+
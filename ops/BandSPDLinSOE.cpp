@@ -0,0 +1,471 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-18 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.cpp,v $
+                                                                        
+                                                                        
+// Written: fmk 
+//
+// Description: This file contains the implementation for BandSPDLinSOE
+
+#include <stdlib.h>
+
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <math.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <iostream>
+using std::nothrow;
+
+BandSPDLinSOE::BandSPDLinSOE(BandSPDLinSolver &theSolvr)
+:LinearSOE(theSolvr, LinSOE_TAGS_BandSPDLinSOE),
+ size(0), half_band(0), A(0), B(0), X(0), 
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+    theSolvr.setLinearSOE(*this);
+}
+
+BandSPDLinSOE::BandSPDLinSOE(int classTag)
+:LinearSOE(classTag),
+ size(0), half_band(0), A(0), B(0), X(0), 
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+
+}
+
+
+int
+BandSPDLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+    
+BandSPDLinSOE::~BandSPDLinSOE()
+{
+    if (A != 0) delete [] A;
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;    
+    if (vectB != 0) delete vectB;    
+}
+
+
+
+int 
+BandSPDLinSOE::setSize(Graph &theGraph)
+{
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    /*
+     * determine the half band: only the superdiagonals are stored
+     */
+
+    half_band = 0;
+
+    Vertex *vertexPtr;
+    VertexIter &theVertices = theGraph.getVertices();
+    
+    while ((vertexPtr = theVertices()) != 0) {
+	int vertexNum = vertexPtr->getTag();
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	for (int i=0; i<theAdjacency.Size(); i++) {
+	    int otherNum = theAdjacency(i);
+	    int diff = vertexNum - otherNum;
+	    if (diff > half_band)
+		half_band = diff;
+	}
+    }
+    half_band += 1;
+
+    int newSize = size * half_band;
+    if (newSize > Asize) { // we have to get another space for A
+
+	if (A != 0) 
+	    delete [] A;
+
+	A = new (nothrow)double[newSize];
+	
+        if (A == 0) {
+            opserr << "WARNING BandSPDLinSOE::setSize() :";
+	    opserr << " ran out of memory for A (size,half_band) (";
+	    opserr << size <<", " << half_band << ") \n";
+	    Asize = 0; size = 0; half_band = 0;
+	    result= -1;
+        }
+	else  
+	    Asize = newSize;
+    }
+
+    // zero the matrix
+    for (int i=0; i<Asize; i++)
+	A[i] = 0;
+	
+    factored = false;
+    this->newStorageStamp();
+    
+    if (size > Bsize) { // we have to get space for the vectors
+	
+	// delete the old	
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+
+	// create the new
+	B = new (nothrow) double[size];
+	X = new (nothrow) double[size];
+	
+        if (B == 0 || X == 0) {
+            opserr << "WARNING BandSPDLinSOE::setSize() :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    Bsize = 0; size = 0; half_band = 0;
+	    result = -1;
+        }
+	else 
+	    Bsize = size;
+    }
+
+    // zero the vectors
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+
+    // get new Vector objects if size has changes
+    if (oldSize != size) {
+	if (vectX != 0) 
+	    delete vectX;
+
+	if (vectB != 0) 
+	    delete vectB;
+		
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+    
+    // invoke setSize() on the Solver
+    LinearSOESolver *theSolvr = this->getSolver();
+    int solverOK = theSolvr->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:BandSPDLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }    
+
+    return result;    
+}
+
+int 
+BandSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();    
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "BandSPDLinSOE::addA()	- Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    // only the upper triangle (row <= col) is assembled; the lower
+    // triangle of m is assumed to be its transpose
+    if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++) {
+	    int col = id(i);
+	    if (col < size && col >= 0) {
+		double *coliiPtr = A + (col+1)*half_band - 1;
+		for (int j=0; j<idSize; j++) {
+		    int row = id(j);
+		    if (row <size && row >= 0) {
+			int diff = col - row;
+			if (diff >= 0 && diff < half_band) {
+			    double *APtr = coliiPtr - diff;
+			    *APtr += m(j,i);
+			}
+		    }
+		}  // for j
+	    } 
+	}  // for i
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int col = id(i);
+	    if (col < size && col >= 0) {
+		double *coliiPtr = A + (col+1)*half_band - 1;
+		for (int j=0; j<idSize; j++) {
+		    int row = id(j);
+		    if (row <size && row >= 0) {
+			int diff = col - row;
+			if (diff >= 0 && diff < half_band) {
+			    double *APtr = coliiPtr - diff;
+			    *APtr += m(j,i) * fact;
+			}
+		    }
+		}  // for j
+	    } 
+	}  // for i
+    }    
+
+    return 0;
+}
+
+
+// the map holds for entry (j,i) of the matrix, in column order, its
+// location in A, or -1 if it is not assembled (below the diagonal)
+int 
+BandSPDLinSOE::formScatterMap(const ID &id, ID &map)
+{
+    int idSize = id.Size();
+    if (map.resize(idSize*idSize) < 0)
+	return -1;
+
+    int loc = 0;
+
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    int pos = -1;
+	    if (col < size && col >= 0 && row < size && row >= 0) {
+		int diff = col - row;
+		if (diff >= 0 && diff < half_band)
+		    pos = (col+1)*half_band - 1 - diff;
+	    }
+	    map(loc++) = pos;
+	}
+    }
+
+    return 0;
+}
+
+
+int 
+BandSPDLinSOE::addAScatter(const Matrix &m, const ID &map, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    int idSize = m.noRows();
+    if (idSize != m.noCols() || idSize*idSize != map.Size()) {
+	opserr << "BandSPDLinSOE::addAScatter()	- Matrix and map not of similar sizes\n";
+	return -1;
+    }
+
+    int loc = 0;
+
+    if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++)
+	    for (int j=0; j<idSize; j++) {
+		int pos = map(loc++);
+		if (pos >= 0)
+		    A[pos] += m(j,i);
+	    }
+    } else {
+	for (int i=0; i<idSize; i++)
+	    for (int j=0; j<idSize; j++) {
+		int pos = map(loc++);
+		if (pos >= 0)
+		    A[pos] += m(j,i) * fact;
+	    }
+    }
+
+    return 0;
+}
+
+    
+int 
+BandSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+
+    // check that m and id are of similar size
+    int idSize = id.Size();        
+    if (idSize != v.Size() ) {
+	opserr << "BandSPDLinSOE::addB()	- Vector and ID not of similar sizes\n";
+	return -1;
+    }    
+    
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }	
+    return 0;
+}
+
+
+int
+BandSPDLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+
+    if (v.Size() != size) {
+	opserr << "WARNING BandSPDLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+    
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }	
+    return 0;
+}
+
+
+void 
+BandSPDLinSOE::zeroA(void)
+{
+    double *Aptr = A;
+    int theSize = Asize;
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = 0;
+    
+    factored = false;
+}
+	
+void 
+BandSPDLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+const Vector &
+BandSPDLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL BandSPDLinSOE::getX - vectX == 0!";
+	exit(-1);
+    }    
+    
+    return *vectX;
+}
+
+
+const Vector &
+BandSPDLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL BandSPDLinSOE::getB - vectB == 0!";
+	exit(-1);
+    }    
+
+    return *vectB;
+}
+
+
+double 
+BandSPDLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    double *Bptr = B;
+    for (int i=0; i<size; i++) {
+	double Yi = *Bptr++;
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}    
+
+
+void 
+BandSPDLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >= 0)
+	X[loc] = value;
+}
+
+void 
+BandSPDLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+      *vectX = x;
+}
+
+
+int
+BandSPDLinSOE::setBandSPDSolver(BandSPDLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+    
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:BandSPDLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return solverOK;
+	}
+    }	
+    
+    return this->setSolver(newSolver);
+}
+
+
+int 
+BandSPDLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int 
+BandSPDLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
+
+
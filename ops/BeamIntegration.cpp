@@ -27,7 +27,7 @@
 
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theBeamIntegrationRuleObjects;
+static thread_local MapOfTaggedObjects theBeamIntegrationRuleObjects;
 
 bool OPS_addBeamIntegrationRule(BeamIntegrationRule *newComponent) {
   return theBeamIntegrationRuleObjects.addComponent(newComponent);
@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/BisectionLineSearch.cpp,v $
+
+
+// Description: This file contains the implementation for BisectionLineSearch.
+//
+// What: "@(#)BisectionLineSearch.C, revA"
+
+#include <BisectionLineSearch.h>
+#include <math.h>
+
+BisectionLineSearch::BisectionLineSearch(double tol, int mIter, double mnEta, double mxEta, int pFlag)
+:LineSearch(LINESEARCH_TAGS_BisectionLineSearch, tol, mIter, mnEta, mxEta, pFlag)
+{
+
+}
+
+BisectionLineSearch::~BisectionLineSearch()
+{
+
+}
+
+int
+BisectionLineSearch::findEta(double s0, double s1)
+{
+  // bracket the root: double eta while s keeps its sign
+  double etaL = 0.0, sL = s0;
+  double etaU = 1.0, sU = s1;
+
+  while (sU*sL > 0.0 && etaU < maxEta) {
+    etaL = etaU;
+    sL   = sU;
+    etaU = (2.0*etaU < maxEta) ? 2.0*etaU : maxEta;
+    sU   = this->moveTo(etaU);
+
+    if (fabs(sU) <= tolerance*fabs(s0) || error != 0)
+      return 0;
+  }
+
+  // no root within maxEta -- take the longest step tried
+  if (sU*sL > 0.0)
+    return 0;
+
+  for (int count = 0; count < maxIter; count++) {
+
+    double etaJ = 0.5*(etaL + etaU);
+    if (etaJ < minEta)
+      etaJ = minEta;
+
+    double s = this->moveTo(etaJ);
+
+    if (fabs(s) <= tolerance*fabs(s0) || error != 0)
+      break;
+
+    if (s*sL > 0.0) {
+      etaL = etaJ;
+      sL   = s;
+    } else {
+      etaU = etaJ;
+      sU   = s;
+    }
+
+    // the bracket is below minEta -- nothing left to search
+    if (etaU <= minEta)
+      break;
+  }
+
+  return 0;
+}
+
+void
+BisectionLineSearch::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "Bisection Line Search - tolerance: " << tolerance << endln;
+  }
+}
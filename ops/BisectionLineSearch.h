@@ -0,0 +1,52 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/BisectionLineSearch.h,v $
+
+
+#ifndef BisectionLineSearch_h
+#define BisectionLineSearch_h
+
+// Description: This file contains the class definition for BisectionLineSearch.
+// BisectionLineSearch brackets the root of s(eta) -- doubling eta while
+// s(eta) keeps the sign of s(0) -- and then bisects the bracket.
+//
+// What: "@(#)BisectionLineSearch.h, revA"
+
+#include <LineSearch.h>
+
+class BisectionLineSearch: public LineSearch
+{
+  public:
+    BisectionLineSearch(double tolerance = 0.8, int maxIter = 10,
+                        double minEta = 0.1, double maxEta = 10.0, int printFlag = 0);
+    ~BisectionLineSearch();
+
+    void Print(OPS_Stream &s, int flag =0);
+
+  protected:
+    int findEta(double s0, double s1);
+
+  private:
+};
+
+#endif
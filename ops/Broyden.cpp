@@ -0,0 +1,283 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/Broyden.cpp,v $
+
+
+// Description: This file contains the implementation for Broyden.
+//
+// With the unbalance R (the RHS of the LinearSOE) and an approximation H
+// of the inverse tangent, the increment is s(k) = H(k) R(k).  With
+// y(k) = R(k) - R(k+1) the good Broyden update of the inverse is
+//
+//   H(k+1) v = H(k) v + u(k) [s(k)^T H(k) v] / [s(k)^T H(k) y(k)]
+//   u(k)     = s(k) - H(k) y(k)
+//
+// and since H(k) R(k) = s(k), H(k) y(k) = s(k) - w with w = H(k) R(k+1).
+// w is all that needs a back substitution: u(k) = w, and the next
+// increment s(k+1) = H(k+1) R(k+1) is w scaled by s^T s / (s^T s - s^T w).
+//
+// What: "@(#)Broyden.C, revA"
+
+#include <Broyden.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+#include <ID.h>
+#include <math.h>
+
+// Constructor
+Broyden::Broyden(int theTangentToUse, int n)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_Broyden),
+ tangent(theTangentToUse), maxUpdates(n),
+ s(0), u(0), denom(0), sizeStorage(0),
+ numIterations(0), numFactorizations(0)
+{
+  if (maxUpdates < 1)
+    maxUpdates = 1;
+}
+
+// Destructor
+Broyden::~Broyden()
+{
+  this->clearStorage();
+}
+
+void
+Broyden::clearStorage(void)
+{
+  if (s != 0) {
+    for (int i=0; i<=maxUpdates; i++)
+      if (s[i] != 0)
+	delete s[i];
+    delete [] s;
+  }
+  if (u != 0) {
+    for (int i=0; i<maxUpdates; i++)
+      if (u[i] != 0)
+	delete u[i];
+    delete [] u;
+  }
+  if (denom != 0)
+    delete [] denom;
+
+  s = 0;
+  u = 0;
+  denom = 0;
+  sizeStorage = 0;
+}
+
+int
+Broyden::allocateStorage(int numEqn)
+{
+  if (s != 0 && sizeStorage == numEqn)
+    return 0;
+
+  this->clearStorage();
+
+  s = new Vector *[maxUpdates+1];
+  u = new Vector *[maxUpdates];
+  denom = new double[maxUpdates];
+
+  for (int i=0; i<=maxUpdates; i++)
+    s[i] = new Vector(numEqn);
+  for (int i=0; i<maxUpdates; i++)
+    u[i] = new Vector(numEqn);
+
+  sizeStorage = numEqn;
+
+  return 0;
+}
+
+int
+Broyden::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING Broyden::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    this->allocateStorage(theSOE->getNumEqn());
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING Broyden::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	return -2;
+    }
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "Broyden::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    int result = -1;
+    numIterations = 0;
+
+    do {
+	// a Newton iteration with a freshly formed tangent
+	SOLUTION_ALGORITHM_tangentFlag = tangent;
+	if (theIntegrator->formTangent(tangent) < 0){
+	    opserr << "WARNING Broyden::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formTangent()\n";
+	    return -1;
+	}
+	numFactorizations++;
+
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING Broyden::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";
+	    return -3;
+	}
+
+	*(s[0]) = theSOE->getX();
+
+	if (theIntegrator->update(*(s[0])) < 0) {
+	    opserr << "WARNING Broyden::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";
+	    return -4;
+	}
+
+	if (theIntegrator->formUnbalance() < 0) {
+	    opserr << "WARNING Broyden::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";
+	    return -2;
+	}
+
+	result = theTest->test();
+	numIterations++;
+	this->record(numIterations);
+
+	// quasi-Newton iterations with the same factorization
+	int k = 0;
+	while (result == -1 && k < maxUpdates) {
+
+	    // w = H(k) R(k+1)
+	    if (theSOE->solve() < 0) {
+		opserr << "WARNING Broyden::solveCurrentStep() -";
+		opserr << "the LinearSysOfEqn failed in solve()\n";
+		return -3;
+	    }
+
+	    Vector &w = *(u[k]);
+	    w = theSOE->getX();
+
+	    for (int i=0; i<k; i++) {
+		double sw = *(s[i]) ^ w;
+		w.addVector(1.0, *(u[i]), sw/denom[i]);
+	    }
+
+	    double ss = *(s[k]) ^ *(s[k]);
+	    double sw = *(s[k]) ^ w;
+	    denom[k] = ss - sw;
+
+	    // degenerate update -- start over with a new tangent
+	    if (fabs(denom[k]) <= 1.0e-12*ss)
+		break;
+
+	    s[k+1]->addVector(0.0, w, ss/denom[k]);
+	    k++;
+
+	    if (theIntegrator->update(*(s[k])) < 0) {
+		opserr << "WARNING Broyden::solveCurrentStep() -";
+		opserr << "the Integrator failed in update()\n";
+		return -4;
+	    }
+
+	    if (theIntegrator->formUnbalance() < 0) {
+		opserr << "WARNING Broyden::solveCurrentStep() -";
+		opserr << "the Integrator failed in formUnbalance()\n";
+		return -2;
+	    }
+
+	    result = theTest->test();
+	    numIterations++;
+	    this->record(numIterations);
+	}
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "Broyden::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+int
+Broyden::sendSelf(int cTag, Channel &theChannel)
+{
+  static ID data(2);
+  data(0) = tangent;
+  data(1) = maxUpdates;
+  return theChannel.sendID(this->getDbTag(), cTag, data);
+}
+
+int
+Broyden::recvSelf(int cTag,
+		  Channel &theChannel,
+		  FEM_ObjectBroker &theBroker)
+{
+  static ID data(2);
+  theChannel.recvID(this->getDbTag(), cTag, data);
+  this->clearStorage();
+  tangent = data(0);
+  maxUpdates = data(1);
+  return 0;
+}
+
+void
+Broyden::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "Broyden -count " << maxUpdates << endln;
+  }
+}
+
+int
+Broyden::getNumIterations(void)
+{
+  return numIterations;
+}
+
+int
+Broyden::getNumFactorizations(void)
+{
+  return numFactorizations;
+}
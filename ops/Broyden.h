@@ -0,0 +1,78 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/Broyden.h,v $
+
+
+#ifndef Broyden_h
+#define Broyden_h
+
+// Description: This file contains the class definition for Broyden.
+// Broyden forms and factors the tangent at the start of a step and then
+// improves the inverse of it with rank-one (good Broyden) updates built from
+// the displacement increments and the changes in the unbalance.  The
+// updates are applied to the back substitution with the factored tangent,
+// one solve per iteration.  After maxUpdates updates, or if an update
+// degenerates, the tangent is formed again.
+//
+// What: "@(#)Broyden.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class Vector;
+
+class Broyden: public EquiSolnAlgo
+{
+  public:
+    Broyden(int tangent = CURRENT_TANGENT, int maxUpdates = 10);
+    ~Broyden();
+
+    int solveCurrentStep(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    void clearStorage(void);
+    int  allocateStorage(int numEqn);
+
+    int tangent;
+    int maxUpdates;
+
+    Vector **s;        // displacement increments s(0..maxUpdates)
+    Vector **u;        // update vectors s(i) - H(i) y(i)
+    double  *denom;    // s(i)^T H(i) y(i)
+    int      sizeStorage;
+
+    int numIterations;
+    int numFactorizations;
+};
+
+#endif
@@ -37,7 +37,7 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theCrdTransfObjects;
+static thread_local MapOfTaggedObjects theCrdTransfObjects;
 
 bool 
 OPS_addCrdTransf(CrdTransf *newComponent) {
@@ -105,8 +105,9 @@ class DOF_Group: public TaggedObject
     virtual const Vector &getDampingBetaForce(int mode, double beta);
 
 	
-    // method added for TransformationDOF_Groups
+    // methods added for TransformationDOF_Groups
     virtual Matrix *getT(void);
+    virtual const Vector *getSP_DispIncr(void);
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addM_ForceSensitivity(const Vector &Udotdot, double fact = 1.0);        
@@ -144,9 +145,6 @@ class DOF_Group: public TaggedObject
     // static variables - single copy for all objects of the class	    
     static Matrix errMatrix;
     static Vector errVect;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;           // number of objects    
 };
 
 #endif
@@ -47,6 +47,8 @@
 #include <FEM_ObjectBroker.h>
 
 #include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
 
 #include <Domain.h>
 #include <MP_Constraint.h>
@@ -57,21 +59,24 @@
 
 DOF_Numberer::DOF_Numberer(int clsTag) 
 :MovableObject(clsTag),
- theAnalysisModel(0), theGraphNumberer(0)
+ theAnalysisModel(0), theGraphNumberer(0),
+ lastOrderedRefs(0), numberingReused(false)
 {
 
 }
 
 DOF_Numberer::DOF_Numberer(GraphNumberer &aGraphNumberer)
 :MovableObject(NUMBERER_TAG_DOF_Numberer),
- theAnalysisModel(0), theGraphNumberer(&aGraphNumberer)
+ theAnalysisModel(0), theGraphNumberer(&aGraphNumberer),
+ lastOrderedRefs(0), numberingReused(false)
 {
 
 }    
 
 DOF_Numberer::DOF_Numberer()
 :MovableObject(NUMBERER_TAG_DOF_Numberer),
- theAnalysisModel(0), theGraphNumberer(0)
+ theAnalysisModel(0), theGraphNumberer(0),
+ lastOrderedRefs(0), numberingReused(false)
 {
 
 }    
@@ -99,6 +104,8 @@ DOF_Numberer::setLinks(AnalysisModel &theModel)
 int 
 DOF_Numberer::numberDOF(int lastDOF_Group) 
 {
+    numberingReused = false;
+
     // check we have a model and a numberer
     Domain *theDomain = 0;
     if (theAnalysisModel != 0) theDomain = theAnalysisModel->getDomainPtr();
@@ -119,10 +126,16 @@ DOF_Numberer::numberDOF(int lastDOF_Group)
     if (theAnalysisModel->getNumDOF_Groups() == 0)
 	return 0;
 
-    // we first number the dofs using the dof group graph
+    // we first number the dofs using the dof group graph; if the graph
+    // is the one numbered last time the previous ordering is reused
 
-    const ID &orderedRefs = theGraphNumberer->
-      number(theAnalysisModel->getDOFGroupGraph(), lastDOF_Group);     
+    Graph &theGraph = theAnalysisModel->getDOFGroupGraph();
+
+    numberingReused = this->isSameGraph(theGraph, lastDOF_Group);
+    if (numberingReused == false)
+	lastOrderedRefs = theGraphNumberer->number(theGraph, lastDOF_Group);
+
+    const ID &orderedRefs = lastOrderedRefs;
 
     theAnalysisModel->clearDOFGroupGraph();
 
@@ -232,6 +245,10 @@ DOF_Numberer::numberDOF(int lastDOF_Group)
 int 
 DOF_Numberer::numberDOF(ID &lastDOFs) 
 {
+    // the cached numbering is only for numberDOF(int)
+    numberingReused = false;
+    graphKey.clear();
+
     // check we have a model and a numberer
     	Domain *theDomain = 0;
    if (theAnalysisModel != 0) theDomain = theAnalysisModel->getDomainPtr();
@@ -357,6 +374,53 @@ DOF_Numberer::numberDOF(ID &lastDOFs)
 
 
 
+bool
+DOF_Numberer::isNumberingReused(void) const
+{
+    return numberingReused;
+}
+
+
+// bool isSameGraph(Graph &theGraph, int lastDOF_Group)
+//	Method to compare the DOF_Group graph, and the free/constrained
+//	markers of the DOF_Groups, with the one numbered last; if they 
+//	differ the new one is stored for the next call.
+
+bool
+DOF_Numberer::isSameGraph(Graph &theGraph, int lastDOF_Group)
+{
+    newGraphKey.clear();
+    newGraphKey.push_back(lastDOF_Group);
+    newGraphKey.push_back(theGraph.getNumVertex());
+
+    DOF_GrpIter &theDOFs = theAnalysisModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+	const ID &theID = dofPtr->getID();
+	newGraphKey.push_back(dofPtr->getTag());
+	newGraphKey.push_back(theID.Size());
+	for (int i=0; i<theID.Size(); i++)
+	    newGraphKey.push_back(theID(i));
+    }
+
+    VertexIter &theVertices = theGraph.getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0) {
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	newGraphKey.push_back(vertexPtr->getTag());
+	newGraphKey.push_back(theAdjacency.Size());
+	for (int i=0; i<theAdjacency.Size(); i++)
+	    newGraphKey.push_back(theAdjacency(i));
+    }
+
+    if (newGraphKey == graphKey)
+	return true;
+
+    graphKey.swap(newGraphKey);
+    return false;
+}
+
+
 // AnalysisModel *getAnalysisModelPtr(void)
 // 	Method to return a pointer to theAnalysisModel for subclasses.
 
@@ -39,11 +39,13 @@
 #define DOF_Numberer_h
 
 #include <MovableObject.h>
+#include <ID.h>
+#include <vector>
 
 class AnalysisModel;
 class GraphNumberer;
 class FEM_ObjectBroker;
-class ID;
+class Graph;
 
 class DOF_Numberer: public MovableObject
 {
@@ -60,6 +62,10 @@ class DOF_Numberer: public MovableObject
     virtual int numberDOF(int lastDOF_Group = -1);
     virtual int numberDOF(ID &lastDOF_Groups);    
 
+    // true if the last numberDOF() found the DOF_Group graph unchanged
+    // and reused the previous numbering
+    virtual bool isNumberingReused(void) const;
+
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
 			 FEM_ObjectBroker &theBroker);
@@ -70,8 +76,15 @@ class DOF_Numberer: public MovableObject
     GraphNumberer *getGraphNumbererPtr(void) const;
     
   private:
+    bool isSameGraph(Graph &theGraph, int lastDOF_Group);
+
     AnalysisModel *theAnalysisModel;
     GraphNumberer *theGraphNumberer;
+
+    // the DOF_Group graph of the last numbering, and its result
+    std::vector<int> graphKey, newGraphKey;
+    ID lastOrderedRefs;
+    bool numberingReused;
 };
 
 #endif
@@ -0,0 +1,197 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-24 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/DenseArrayOfTaggedObjects.cpp,v $
+
+// Purpose: This file contains the implementation of the
+// DenseArrayOfTaggedObjects class.
+//
+// What: "@(#) DenseArrayOfTaggedObjects.cpp, revA"
+
+#include <TaggedObject.h>
+#include <DenseArrayOfTaggedObjects.h>
+
+#include <OPS_Globals.h>
+
+DenseArrayOfTaggedObjects::DenseArrayOfTaggedObjects(int size)
+:theComponents(), numComponents(0), firstTag(0), lastTag(-1), myIter(*this)
+{
+    if (size > 0)
+	theComponents.resize(size, 0);
+}
+
+DenseArrayOfTaggedObjects::~DenseArrayOfTaggedObjects()
+{
+    this->clearAll();
+}
+
+
+int
+DenseArrayOfTaggedObjects::setSize(int newSize)
+{
+    if (newSize < 0) {
+      opserr << "DenseArrayOfTaggedObjects::setSize - invalid size " << newSize << "\n";
+      return -1;
+    }
+
+    // the array is never made smaller, it may hold components
+    if (newSize > (int)theComponents.size())
+	theComponents.resize(newSize, 0);
+
+    return 0;
+}
+
+
+bool
+DenseArrayOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+    int tag = newComponent->getTag();
+
+    if (tag < 0) {
+      opserr << "DenseArrayOfTaggedObjects::addComponent - not adding as tag is negative, tag: " <<
+	tag << "\n";
+      return false;
+    }
+
+    // make room for the tag, doubling the array if it is not much larger
+    int size = theComponents.size();
+    if (tag >= size) {
+	int newSize = 2*size;
+	if (newSize < tag+1)
+	    newSize = tag+1;
+	theComponents.resize(newSize, 0);
+    }
+
+    if (theComponents[tag] != 0) {
+      opserr << "DenseArrayOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
+	tag << "\n";
+      return false;
+    }
+
+    theComponents[tag] = newComponent;
+
+    if (numComponents == 0) {
+	firstTag = tag;
+	lastTag = tag;
+    } else if (tag < firstTag)
+	firstTag = tag;
+    else if (tag > lastTag)
+	lastTag = tag;
+
+    numComponents++;
+
+    return true;  // o.k.
+}
+
+
+TaggedObject *
+DenseArrayOfTaggedObjects::removeComponent(int tag)
+{
+    if (tag < 0 || tag >= (int)theComponents.size())
+	return 0;
+
+    TaggedObject *removed = theComponents[tag];
+    if (removed == 0) // the object has not been added
+	return 0;
+
+    theComponents[tag] = 0;
+    numComponents--;
+
+    if (numComponents == 0) {
+	firstTag = 0;
+	lastTag = -1;
+    }
+
+    return removed;
+}
+
+
+int
+DenseArrayOfTaggedObjects::getNumComponents(void) const
+{
+    return numComponents;
+}
+
+
+TaggedObject *
+DenseArrayOfTaggedObjects::getComponentPtr(int tag)
+{
+    if (tag < 0 || tag >= (int)theComponents.size())
+	return 0;
+
+    return theComponents[tag];
+}
+
+
+TaggedObjectIter &
+DenseArrayOfTaggedObjects::getComponents()
+{
+    myIter.reset();
+    return myIter;
+}
+
+
+DenseArrayOfTaggedObjectsIter
+DenseArrayOfTaggedObjects::getIter()
+{
+    return DenseArrayOfTaggedObjectsIter(*this);
+}
+
+
+TaggedObjectStorage *
+DenseArrayOfTaggedObjects::getEmptyCopy(void)
+{
+    DenseArrayOfTaggedObjects *theCopy = new DenseArrayOfTaggedObjects(theComponents.size());
+
+    if (theCopy == 0) {
+      opserr << "DenseArrayOfTaggedObjects::getEmptyCopy-out of memory\n";
+    }
+
+    return theCopy;
+}
+
+void
+DenseArrayOfTaggedObjects::clearAll(bool invokeDestructor)
+{
+    // invoke the destructor on all the tagged objects stored; the array
+    // keeps its size for the components of the next mesh
+    for (int i = firstTag; i <= lastTag; i++) {
+	if (theComponents[i] != 0) {
+	    if (invokeDestructor == true)
+		delete theComponents[i];
+	    theComponents[i] = 0;
+	}
+    }
+
+    numComponents = 0;
+    firstTag = 0;
+    lastTag = -1;
+}
+
+void
+DenseArrayOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+    // go through the array invoking Print on non-zero entries
+    for (int i = firstTag; i <= lastTag; i++)
+	if (theComponents[i] != 0)
+	    theComponents[i]->Print(s, flag);
+}
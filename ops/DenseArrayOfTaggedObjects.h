@@ -0,0 +1,77 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-24 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/DenseArrayOfTaggedObjects.h,v $
+
+#ifndef DenseArrayOfTaggedObjects_h
+#define DenseArrayOfTaggedObjects_h
+
+// Description: This file contains the class definition for
+// DenseArrayOfTaggedObjects. DenseArrayOfTaggedObjects is a storage class
+// for objects whose tags lie in a dense range of non-negative integers,
+// as the tags a mesh generator assigns do.  The pointer to an object is
+// kept at the position given by its tag in a flat array, which grows as
+// larger tags are added, so finding an object is a single array access.
+// The iter returns the objects in the order of their tags, as the iter of
+// MapOfTaggedObjects does, skipping the unused positions.  A tag range
+// with large holes wastes memory and iteration time; MapOfTaggedObjects
+// should be used for such components.
+//
+// What: "@(#) DenseArrayOfTaggedObjects.h, revA"
+
+#include <TaggedObjectStorage.h>
+#include <DenseArrayOfTaggedObjectsIter.h>
+#include <vector>
+
+class DenseArrayOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    DenseArrayOfTaggedObjects(int size = 0);
+    ~DenseArrayOfTaggedObjects();
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);
+    int  getNumComponents(void) const;
+
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    DenseArrayOfTaggedObjectsIter getIter();
+
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+
+    void Print(OPS_Stream &s, int flag =0);
+    friend class DenseArrayOfTaggedObjectsIter;
+
+  protected:
+
+  private:
+    std::vector<TaggedObject *> theComponents;  // indexed by tag, 0 if unused
+    int numComponents;                          // num of components added
+    int firstTag, lastTag;                      // bounds of the tags added
+    DenseArrayOfTaggedObjectsIter myIter;       // the iter for this object
+};
+
+#endif
@@ -0,0 +1,62 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-24 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/DenseArrayOfTaggedObjectsIter.cpp,v $
+
+// Description: This file contains the implementation of
+// DenseArrayOfTaggedObjectsIter.
+//
+// What: "@(#) DenseArrayOfTaggedObjectsIter.cpp, revA"
+
+#include <DenseArrayOfTaggedObjectsIter.h>
+#include <DenseArrayOfTaggedObjects.h>
+
+DenseArrayOfTaggedObjectsIter::DenseArrayOfTaggedObjectsIter(DenseArrayOfTaggedObjects &theComponents)
+:myComponents(theComponents), currIndex(0)
+{
+
+}
+
+
+DenseArrayOfTaggedObjectsIter::~DenseArrayOfTaggedObjectsIter()
+{
+
+}
+
+void
+DenseArrayOfTaggedObjectsIter::reset(void)
+{
+    currIndex = myComponents.firstTag;
+}
+
+TaggedObject *
+DenseArrayOfTaggedObjectsIter::operator()(void)
+{
+    // the bounds are read each time as components may be removed on the way
+    while (currIndex <= myComponents.lastTag) {
+	TaggedObject *result = myComponents.theComponents[currIndex++];
+	if (result != 0)
+	    return result;
+    }
+
+    return 0;
+}
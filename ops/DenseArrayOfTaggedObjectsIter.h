@@ -0,0 +1,54 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-24 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/DenseArrayOfTaggedObjectsIter.h,v $
+
+#ifndef DenseArrayOfTaggedObjectsIter_h
+#define DenseArrayOfTaggedObjectsIter_h
+
+// Description: This file contains the class definition for
+// DenseArrayOfTaggedObjectsIter. A DenseArrayOfTaggedObjectsIter is an
+// iter for returning the TaggedObjects of a storage object of type
+// DenseArrayOfTaggedObjects in the order of their tags.  Only the
+// positions from the smallest to the largest tag added are visited.
+//
+// What: "@(#) DenseArrayOfTaggedObjectsIter.h, revA"
+
+#include <TaggedObjectIter.h>
+
+class DenseArrayOfTaggedObjects;
+
+class DenseArrayOfTaggedObjectsIter: public TaggedObjectIter
+{
+  public:
+    DenseArrayOfTaggedObjectsIter(DenseArrayOfTaggedObjects &theComponents);
+    virtual ~DenseArrayOfTaggedObjectsIter();
+
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);
+
+  private:
+    DenseArrayOfTaggedObjects &myComponents;
+    int currIndex;
+};
+
+#endif
@@ -39,6 +39,7 @@
 #include <Element.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <FixedMatrix.h>
 #include <ID.h>
 
 class Node;
@@ -119,11 +120,11 @@ class DispBeamColumn3d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local FixedMatrix<12,12> K;	// Element stiffness, damping, and mass Matrix
+    static thread_local FixedVector<12> P;	// Element resisting force vector
 
-    Vector Q;      // Applied nodal loads
-    Vector q;      // Basic force
+    FixedVector<12> Q;  // Applied nodal loads
+    FixedVector<6> q;   // Basic force
     double q0[5];  // Fixed end forces in basic system (no torsion)
     double p0[5];  // Reactions in basic system (no torsion)
 
@@ -134,7 +135,7 @@ class DispBeamColumn3d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[200];
 };
 
 #endif
@@ -34,6 +34,7 @@
 
 #include <stdlib.h>
 #include <math.h>
+#include <vector>
 
 #include <OPS_Globals.h>
 #include <Domain.h>
@@ -80,13 +81,13 @@
 // global variables
 //
 
-Domain       *ops_TheActiveDomain = 0;
-double        ops_Dt = 0.0;
-bool          ops_InitialStateAnalysis = false;
+thread_local Domain *ops_TheActiveDomain = 0;
+thread_local double  ops_Dt = 0.0;
+thread_local bool    ops_InitialStateAnalysis = false;
 
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
- currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
+ currentTime(0.0), committedTime(0.0), dT(0.0), numThreads(1), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
@@ -141,7 +142,7 @@ Domain::Domain()
 Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
 	       int numLoadPatterns)
 :theRecorders(0), numRecorders(0),
- currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
+ currentTime(0.0), committedTime(0.0), dT(0.0), numThreads(1), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
@@ -196,7 +197,7 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 	       TaggedObjectStorage &theSPsStorage,
 	       TaggedObjectStorage &theLoadPatternsStorage)
 :theRecorders(0), numRecorders(0),
- currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
+ currentTime(0.0), committedTime(0.0), dT(0.0), numThreads(1), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
@@ -259,7 +260,7 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 
 Domain::Domain(TaggedObjectStorage &theStorage)
 :theRecorders(0), numRecorders(0),
- currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
+ currentTime(0.0), committedTime(0.0), dT(0.0), numThreads(1), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
@@ -362,6 +363,9 @@ Domain::~Domain()
   
   if (theMP_Iter != 0)
     delete theMP_Iter;
+
+  if (theLoadPatternIter != 0)
+    delete theLoadPatternIter;
   
   if (allSP_Iter != 0)
     delete allSP_Iter;
@@ -374,6 +378,9 @@ Domain::~Domain()
 
   if (theModalDampingFactors != 0)
     delete theModalDampingFactors;
+
+  if (paramIndex != 0)
+    delete [] paramIndex;
   
   int i;
   for (i=0; i<numRecorders; i++) 
@@ -976,7 +983,8 @@ Domain::clearAll(void) {
   theBounds(4) = 0;    
   theBounds(5) = 0;        
   
-  currentGeoTag = 0;
+  // currentGeoTag keeps counting: an analysis that outlives the clear
+  // must see a new stamp once the domain has been repopulated
   lastGeoSendTag = -1;
   
   // rest the flag to be as initial
@@ -986,7 +994,6 @@ Domain::clearAll(void) {
   
   dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; dbMPs =0; dbLPs = 0; dbParam = 0;
 
-  currentGeoTag = 0;
   lastGeoSendTag = -1;
   lastChannel = 0;
 
@@ -1980,6 +1987,28 @@ Domain::update(void)
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
+#ifdef _OPENMP
+  if (numThreads > 1) {
+    // the elements are independent of each other during the update,
+    // their state is determined concurrently
+    std::vector<Element *> eles;
+    eles.reserve(theElements->getNumComponents());
+    while ((theEle = theEles()) != 0)
+      eles.push_back(theEle);
+
+    int numEles = (int)eles.size();
+    double deltaT = dT;
+
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 8) reduction(+:ok)
+    for (int i=0; i<numEles; i++) {
+      // the globals are per thread
+      ops_Dt = deltaT;
+      ops_TheActiveDomain = this;
+      ops_TheActiveElement = eles[i];
+      ok += eles[i]->update();
+    }
+  } else
+#endif
   while ((theEle = theEles()) != 0) {
     ops_TheActiveElement = theEle;
     ok += theEle->update();
@@ -2002,6 +2031,20 @@ Domain::update(double newTime, double dT)
 }
 
 
+void
+Domain::setNumThreads(int num)
+{
+  numThreads = (num > 0) ? num : 1;
+}
+
+
+int
+Domain::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+
 int
 Domain::updateParameter(int tag, int value)
 {
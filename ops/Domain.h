@@ -185,6 +185,8 @@ class Domain
     virtual  int  revertToStart(void);    
     virtual  int  update(void);
     virtual  int  update(double newTime, double dT);
+    virtual  void setNumThreads(int numThreads);
+    virtual  int  getNumThreads(void) const;
     virtual  int  updateParameter(int tag, int value);
     virtual  int  updateParameter(int tag, double value);    
     
@@ -244,6 +246,7 @@ class Domain
     double currentTime;               // current pseudo time
     double committedTime;             // the committed pseudo time
     double dT;                        // difference between committed and current time
+    int    numThreads;                // number of threads used to update the elements
     int	   currentGeoTag;             // an integer used to mark if domain has changed
     bool   hasDomainChangedFlag;      // a bool flag used to indicate if GeoTag needs to be ++
     int    theDbTag;                   // the Domains unique database tag == 0
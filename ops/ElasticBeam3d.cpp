@@ -0,0 +1,600 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-02 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/elasticBeamColumn/ElasticBeam3d.cpp,v $
+
+
+// Description: This file contains the implementation for the ElasticBeam3d class.
+//
+// What: "@(#) ElasticBeam3d.C, revA"
+
+#include <ElasticBeam3d.h>
+#include <CrdTransf.h>
+#include <Information.h>
+#include <ElementResponse.h>
+#include <ElementalLoad.h>
+#include <Parameter.h>
+
+#include <Domain.h>
+#include <Node.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <classTags.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+thread_local FixedMatrix<12,12> ElasticBeam3d::K;
+thread_local FixedVector<12> ElasticBeam3d::P;
+
+ElasticBeam3d::ElasticBeam3d(int tag, int nd1, int nd2,
+			     double e, double a, double iz, double iy, double g, double j,
+			     CrdTransf &coordTransf)
+ :Element(tag, ELE_TAG_ElasticBeam3d),
+  connectedExternalNodes(2),
+  E(e), A(a), Iz(iz), Iy(iy), G(g), J(j),
+  theCoordTransf(0), L(0.0)
+{
+    connectedExternalNodes(0) = nd1;
+    connectedExternalNodes(1) = nd2;
+    theNodes[0] = 0;
+    theNodes[1] = 0;
+
+    theCoordTransf = coordTransf.getCopy3d();
+    if (theCoordTransf == 0) {
+      opserr << "FATAL ElasticBeam3d::ElasticBeam3d - failed to copy coordinate transformation\n";
+      exit(-1);
+    }
+
+    for (int i=0; i<5; i++)
+      q0[i] = p0[i] = 0.0;
+}
+
+ElasticBeam3d::ElasticBeam3d()
+ :Element(0, ELE_TAG_ElasticBeam3d),
+  connectedExternalNodes(2),
+  E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0),
+  theCoordTransf(0), L(0.0)
+{
+    theNodes[0] = 0;
+    theNodes[1] = 0;
+
+    for (int i=0; i<5; i++)
+      q0[i] = p0[i] = 0.0;
+}
+
+ElasticBeam3d::~ElasticBeam3d()
+{
+    if (theCoordTransf != 0)
+      delete theCoordTransf;
+}
+
+int
+ElasticBeam3d::getNumExternalNodes(void) const
+{
+    return 2;
+}
+
+const ID &
+ElasticBeam3d::getExternalNodes(void)
+{
+    return connectedExternalNodes;
+}
+
+Node **
+ElasticBeam3d::getNodePtrs(void)
+{
+    return theNodes;
+}
+
+int
+ElasticBeam3d::getNumDOF(void)
+{
+    return 12;
+}
+
+void
+ElasticBeam3d::setDomain(Domain *theDomain)
+{
+    // check Domain is not null - invoked when object removed from a domain
+    if (theDomain == 0) {
+      theNodes[0] = 0;
+      theNodes[1] = 0;
+      return;
+    }
+
+    for (int i=0; i<2; i++) {
+      theNodes[i] = theDomain->getNode(connectedExternalNodes(i));
+      if (theNodes[i] == 0) {
+	opserr << "WARNING ElasticBeam3d::setDomain() - node " << connectedExternalNodes(i);
+	opserr << " does not exist in model for ElasticBeam3d ele: " << this->getTag() << endln;
+	return;
+      }
+      if (theNodes[i]->getNumberDOF() != 6) {
+	opserr << "WARNING ElasticBeam3d::setDomain() - node " << connectedExternalNodes(i);
+	opserr << " does not have 6 dof, ElasticBeam3d ele: " << this->getTag() << endln;
+	theNodes[i] = 0;
+	return;
+      }
+    }
+
+    if (theCoordTransf->initialize(theNodes[0], theNodes[1]) != 0) {
+      opserr << "WARNING ElasticBeam3d::setDomain() - failed to initialize the coordinate transformation of ele: "
+	     << this->getTag() << endln;
+      return;
+    }
+
+    L = theCoordTransf->getInitialLength();
+    if (L == 0.0) {
+      opserr << "WARNING ElasticBeam3d::setDomain() - element " << this->getTag() << " has zero length\n";
+      return;
+    }
+
+    this->formLocalStiffness();
+
+    // call the base class method
+    this->DomainComponent::setDomain(theDomain);
+
+    this->update();
+}
+
+void
+ElasticBeam3d::formLocalStiffness(void)
+{
+    // local dofs: u, v, w, theta_x, theta_y, theta_z at node I, then node J
+    kl.Zero();
+
+    if (L == 0.0)
+      return;
+
+    double oneOverL = 1.0/L;
+
+    double EAoverL = E*A*oneOverL;
+    double GJoverL = G*J*oneOverL;
+
+    kl(0,0) = kl(6,6) =  EAoverL;
+    kl(0,6) = kl(6,0) = -EAoverL;
+
+    kl(3,3) = kl(9,9) =  GJoverL;
+    kl(3,9) = kl(9,3) = -GJoverL;
+
+    // bending in the local x-y plane (v, theta_z)
+    double EIz = E*Iz;
+    double kz1 = 12.0*EIz*oneOverL*oneOverL*oneOverL;
+    double kz2 =  6.0*EIz*oneOverL*oneOverL;
+    double kz3 =  4.0*EIz*oneOverL;
+    double kz4 =  2.0*EIz*oneOverL;
+
+    kl(1,1)  = kl(7,7)   =  kz1;
+    kl(1,7)  = kl(7,1)   = -kz1;
+    kl(1,5)  = kl(5,1)   =  kz2;
+    kl(1,11) = kl(11,1)  =  kz2;
+    kl(5,7)  = kl(7,5)   = -kz2;
+    kl(7,11) = kl(11,7)  = -kz2;
+    kl(5,5)  = kl(11,11) =  kz3;
+    kl(5,11) = kl(11,5)  =  kz4;
+
+    // bending in the local x-z plane (w, theta_y)
+    double EIy = E*Iy;
+    double ky1 = 12.0*EIy*oneOverL*oneOverL*oneOverL;
+    double ky2 =  6.0*EIy*oneOverL*oneOverL;
+    double ky3 =  4.0*EIy*oneOverL;
+    double ky4 =  2.0*EIy*oneOverL;
+
+    kl(2,2)  = kl(8,8)   =  ky1;
+    kl(2,8)  = kl(8,2)   = -ky1;
+    kl(2,4)  = kl(4,2)   = -ky2;
+    kl(2,10) = kl(10,2)  = -ky2;
+    kl(4,8)  = kl(8,4)   =  ky2;
+    kl(8,10) = kl(10,8)  =  ky2;
+    kl(4,4)  = kl(10,10) =  ky3;
+    kl(4,10) = kl(10,4)  =  ky4;
+}
+
+int
+ElasticBeam3d::commitState(void)
+{
+    int retVal = 0;
+
+    // call element commitState to do any base class stuff
+    if ((retVal = this->Element::commitState()) != 0) {
+      opserr << "ElasticBeam3d::commitState () - failed in base class";
+    }
+
+    retVal += theCoordTransf->commitState();
+
+    return retVal;
+}
+
+int
+ElasticBeam3d::revertToLastCommit(void)
+{
+    return theCoordTransf->revertToLastCommit();
+}
+
+int
+ElasticBeam3d::revertToStart(void)
+{
+    return theCoordTransf->revertToStart();
+}
+
+int
+ElasticBeam3d::update(void)
+{
+    int res = theCoordTransf->update();
+
+    // the basic stiffness is a subset of the local one
+    const Vector &v = theCoordTransf->getBasicTrialDisp();
+
+    q(0) = kl(0,0)*v(0);
+    q(1) = kl(5,5)*v(1) + kl(5,11)*v(2);
+    q(2) = kl(5,11)*v(1) + kl(11,11)*v(2);
+    q(3) = kl(4,4)*v(3) + kl(4,10)*v(4);
+    q(4) = kl(4,10)*v(3) + kl(10,10)*v(4);
+    q(5) = kl(3,3)*v(5);
+
+    return res;
+}
+
+const Matrix &
+ElasticBeam3d::getTangentStiff(void)
+{
+    K = theCoordTransf->getGlobalMatrixFromLocal(kl);
+    return K;
+}
+
+const Matrix &
+ElasticBeam3d::getInitialStiff(void)
+{
+    return this->getTangentStiff();
+}
+
+const Matrix &
+ElasticBeam3d::getMass(void)
+{
+    // no mass
+    K.Zero();
+    return K;
+}
+
+void
+ElasticBeam3d::zeroLoad(void)
+{
+    for (int i=0; i<5; i++)
+      q0[i] = p0[i] = 0.0;
+}
+
+int
+ElasticBeam3d::addLoad(ElementalLoad *theLoad, double loadFactor)
+{
+    int type;
+    const Vector &data = theLoad->getData(type, loadFactor);
+
+    if (type != LOAD_TAG_Beam3dUniformLoad) {
+      opserr << "ElasticBeam3d::addLoad - load type unknown for element with tag: " << this->getTag() << endln;
+      return -1;
+    }
+
+    double wy = data(0)*loadFactor;  // Transverse
+    double wz = data(1)*loadFactor;  // Transverse
+    double wx = data(2)*loadFactor;  // Axial (+ve from node I to J)
+
+    double Vy = 0.5*wy*L;
+    double Mz = Vy*L/6.0; // wy*L*L/12
+    double Vz = 0.5*wz*L;
+    double My = Vz*L/6.0; // wz*L*L/12
+    double N  = wx*L;
+
+    // Reactions in basic system
+    p0[0] -= N;
+    p0[1] -= Vy;
+    p0[2] -= Vy;
+    p0[3] -= Vz;
+    p0[4] -= Vz;
+
+    // Fixed end forces in basic system
+    q0[0] -= 0.5*N;
+    q0[1] -= Mz;
+    q0[2] += Mz;
+    q0[3] += My;
+    q0[4] -= My;
+
+    return 0;
+}
+
+int
+ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
+{
+    // does nothing as element has no mass
+    return 0;
+}
+
+const Vector &
+ElasticBeam3d::getResistingForce(void)
+{
+    static thread_local FixedVector<6> qt;
+    qt = q;
+    for (int i=0; i<5; i++)
+      qt(i) += q0[i];
+
+    Vector p0Vec(p0, 5);
+    P = theCoordTransf->getGlobalResistingForce(qt, p0Vec);
+
+    return P;
+}
+
+const Vector &
+ElasticBeam3d::getResistingForceIncInertia(void)
+{
+    return this->getResistingForce();
+}
+
+int
+ElasticBeam3d::sendSelf(int commitTag, Channel &theChannel)
+{
+    int res = 0;
+    int dataTag = this->getDbTag();
+
+    int crdTransfDbTag = theCoordTransf->getDbTag();
+    if (crdTransfDbTag == 0) {
+      crdTransfDbTag = theChannel.getDbTag();
+      if (crdTransfDbTag != 0)
+	theCoordTransf->setDbTag(crdTransfDbTag);
+    }
+
+    static thread_local ID idData(5);
+    idData(0) = this->getTag();
+    idData(1) = connectedExternalNodes(0);
+    idData(2) = connectedExternalNodes(1);
+    idData(3) = theCoordTransf->getClassTag();
+    idData(4) = crdTransfDbTag;
+
+    res += theChannel.sendID(dataTag, commitTag, idData);
+    if (res < 0) {
+      opserr << "ElasticBeam3d::sendSelf -- failed to send ID data\n";
+      return res;
+    }
+
+    static thread_local Vector data(6);
+    data(0) = E;
+    data(1) = A;
+    data(2) = Iz;
+    data(3) = Iy;
+    data(4) = G;
+    data(5) = J;
+
+    res += theChannel.sendVector(dataTag, commitTag, data);
+    if (res < 0) {
+      opserr << "ElasticBeam3d::sendSelf -- failed to send Vector data\n";
+      return res;
+    }
+
+    res += theCoordTransf->sendSelf(commitTag, theChannel);
+    if (res < 0) {
+      opserr << "ElasticBeam3d::sendSelf -- failed to send coordinate transformation\n";
+      return res;
+    }
+
+    return res;
+}
+
+int
+ElasticBeam3d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    int res = 0;
+    int dataTag = this->getDbTag();
+
+    static thread_local ID idData(5);
+    res += theChannel.recvID(dataTag, commitTag, idData);
+    if (res < 0) {
+      opserr << "ElasticBeam3d::recvSelf -- failed to receive ID data\n";
+      return res;
+    }
+
+    this->setTag(idData(0));
+    connectedExternalNodes(0) = idData(1);
+    connectedExternalNodes(1) = idData(2);
+
+    static thread_local Vector data(6);
+    res += theChannel.recvVector(dataTag, commitTag, data);
+    if (res < 0) {
+      opserr << "ElasticBeam3d::recvSelf -- failed to receive Vector data\n";
+      return res;
+    }
+
+    E  = data(0);
+    A  = data(1);
+    Iz = data(2);
+    Iy = data(3);
+    G  = data(4);
+    J  = data(5);
+
+    // a new transformation from the broker if there is none, or one of the wrong type
+    int crdTransfClassTag = idData(3);
+    if (theCoordTransf != 0 && theCoordTransf->getClassTag() != crdTransfClassTag) {
+      delete theCoordTransf;
+      theCoordTransf = 0;
+    }
+    if (theCoordTransf == 0)
+      theCoordTransf = theBroker.getNewCrdTransf(crdTransfClassTag);
+
+    if (theCoordTransf == 0) {
+      opserr << "ElasticBeam3d::recvSelf -- failed to obtain a coordinate transformation\n";
+      return -1;
+    }
+
+    theCoordTransf->setDbTag(idData(4));
+    res += theCoordTransf->recvSelf(commitTag, theChannel, theBroker);
+    if (res < 0) {
+      opserr << "ElasticBeam3d::recvSelf -- failed to receive coordinate transformation\n";
+      return res;
+    }
+
+    // the local stiffness is formed again once the domain is set
+    L = 0.0;
+    kl.Zero();
+
+    return res;
+}
+
+void
+ElasticBeam3d::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+      s << "Element: " << this->getTag();
+      s << " type: ElasticBeam3d  iNode: " << connectedExternalNodes(0);
+      s << " jNode: " << connectedExternalNodes(1) << endln;
+      s << "\tE: " << E << " A: " << A << " Iz: " << Iz << " Iy: " << Iy;
+      s << " G: " << G << " J: " << J << endln;
+      s << "\tlength: " << L << endln;
+    } else if (flag == 1) {
+      s << this->getTag() << "  " << q;
+    }
+}
+
+Response *
+ElasticBeam3d::setResponse(const char **argv, int argc, OPS_Stream &output)
+{
+    Response *theResponse = 0;
+
+    output.tag("ElementOutput");
+    output.attr("eleType", "ElasticBeam3d");
+    output.attr("eleTag", this->getTag());
+    output.attr("node1", connectedExternalNodes[0]);
+    output.attr("node2", connectedExternalNodes[1]);
+
+    if (strcmp(argv[0],"force") == 0 || strcmp(argv[0],"forces") == 0 ||
+	strcmp(argv[0],"globalForce") == 0 || strcmp(argv[0],"globalForces") == 0) {
+
+      theResponse = new ElementResponse(this, 1, P);
+
+    } else if (strcmp(argv[0],"basicForce") == 0 || strcmp(argv[0],"basicForces") == 0) {
+
+      output.tag("ResponseType", "N");
+      output.tag("ResponseType", "Mz_1");
+      output.tag("ResponseType", "Mz_2");
+      output.tag("ResponseType", "My_1");
+      output.tag("ResponseType", "My_2");
+      output.tag("ResponseType", "T");
+      theResponse = new ElementResponse(this, 2, Vector(6));
+
+    } else if (strcmp(argv[0],"deformation") == 0 || strcmp(argv[0],"deformations") == 0 ||
+	       strcmp(argv[0],"basicDeformation") == 0) {
+
+      output.tag("ResponseType", "eps");
+      output.tag("ResponseType", "theta11");
+      output.tag("ResponseType", "theta12");
+      output.tag("ResponseType", "theta21");
+      output.tag("ResponseType", "theta22");
+      output.tag("ResponseType", "phi");
+      theResponse = new ElementResponse(this, 3, Vector(6));
+    }
+
+    output.endTag();
+
+    return theResponse;
+}
+
+int
+ElasticBeam3d::getResponse(int responseID, Information &eleInformation)
+{
+    switch (responseID) {
+    case 1:
+      return eleInformation.setVector(this->getResistingForce());
+
+    case 2:
+      return eleInformation.setVector(q);
+
+    case 3:
+      return eleInformation.setVector(theCoordTransf->getBasicTrialDisp());
+
+    default:
+      return -1;
+    }
+}
+
+int
+ElasticBeam3d::setParameter(const char **argv, int argc, Parameter &param)
+{
+    if (argc < 1)
+      return -1;
+
+    if (strcmp(argv[0],"E") == 0) {
+      param.setValue(E);
+      return param.addObject(1, this);
+    }
+    if (strcmp(argv[0],"A") == 0) {
+      param.setValue(A);
+      return param.addObject(2, this);
+    }
+    if (strcmp(argv[0],"Iz") == 0) {
+      param.setValue(Iz);
+      return param.addObject(3, this);
+    }
+    if (strcmp(argv[0],"Iy") == 0) {
+      param.setValue(Iy);
+      return param.addObject(4, this);
+    }
+    if (strcmp(argv[0],"G") == 0) {
+      param.setValue(G);
+      return param.addObject(5, this);
+    }
+    if (strcmp(argv[0],"J") == 0) {
+      param.setValue(J);
+      return param.addObject(6, this);
+    }
+
+    return -1;
+}
+
+int
+ElasticBeam3d::updateParameter(int parameterID, Information &info)
+{
+    switch (parameterID) {
+    case 1:
+      E = info.theDouble;
+      break;
+    case 2:
+      A = info.theDouble;
+      break;
+    case 3:
+      Iz = info.theDouble;
+      break;
+    case 4:
+      Iy = info.theDouble;
+      break;
+    case 5:
+      G = info.theDouble;
+      break;
+    case 6:
+      J = info.theDouble;
+      break;
+    default:
+      return -1;
+    }
+
+    // the only place the cached stiffness changes
+    this->formLocalStiffness();
+
+    return 0;
+}
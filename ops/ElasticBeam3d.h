@@ -0,0 +1,121 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-02 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/elasticBeamColumn/ElasticBeam3d.h,v $
+
+
+#ifndef ElasticBeam3d_h
+#define ElasticBeam3d_h
+
+// Description: This file contains the class definition for ElasticBeam3d.
+// An ElasticBeam3d is a linear elastic 3d beam-column between two 6 dof
+// nodes.  Its 12x12 stiffness matrix in the local system is formed in
+// closed form from E, A, Iz, Iy, G and J and kept until one of these
+// parameters changes, so a state determination involves no section
+// integration; only the coordinate transformation remains.  The element
+// takes the same parameter names as ElasticSection3d.
+//
+// What: "@(#) ElasticBeam3d.h, revA"
+
+#include <Element.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <FixedMatrix.h>
+#include <ID.h>
+
+class Node;
+class Channel;
+class CrdTransf;
+class Response;
+
+class ElasticBeam3d : public Element
+{
+  public:
+    ElasticBeam3d(int tag, int nd1, int nd2,
+		  double E, double A, double Iz, double Iy, double G, double J,
+		  CrdTransf &coordTransf);
+    ElasticBeam3d();
+    ~ElasticBeam3d();
+
+    const char *getClassType(void) const {return "ElasticBeam3d";};
+
+    // public methods to obtain inforrmation about dof & connectivity
+    int getNumExternalNodes(void) const;
+    const ID &getExternalNodes(void);
+    Node **getNodePtrs(void);
+
+    int getNumDOF(void);
+    void setDomain(Domain *theDomain);
+
+    // public methods to set the state of the element
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+    int update(void);
+
+    // public methods to obtain stiffness, mass, damping and residual information
+    const Matrix &getTangentStiff(void);
+    const Matrix &getInitialStiff(void);
+    const Matrix &getMass(void);
+
+    void zeroLoad(void);
+    int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int addInertiaLoadToUnbalance(const Vector &accel);
+
+    const Vector &getResistingForce(void);
+    const Vector &getResistingForceIncInertia(void);
+
+    // public methods for element output
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+    Response *setResponse(const char **argv, int argc, OPS_Stream &s);
+    int getResponse(int responseID, Information &eleInformation);
+
+    int setParameter(const char **argv, int argc, Parameter &param);
+    int updateParameter(int parameterID, Information &info);
+
+  protected:
+
+  private:
+    void formLocalStiffness(void);
+
+    ID  connectedExternalNodes;         // contains the tags of the end nodes
+    Node *theNodes[2];
+
+    double E, A, Iz, Iy, G, J;          // section properties
+
+    CrdTransf *theCoordTransf;          // coordinate transformation
+    double L;                           // element length, 0 until the domain is set
+
+    FixedMatrix<12,12> kl;              // closed-form stiffness in the local system
+    FixedVector<6> q;                   // basic forces at the last update(), without element loads
+
+    double q0[5];                       // fixed end forces in basic system
+    double p0[5];                       // reactions in basic system
+
+    static thread_local FixedMatrix<12,12> K;   // global stiffness matrix
+    static thread_local FixedVector<12> P;      // global resisting force vector
+};
+
+#endif
@@ -35,9 +35,9 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection3d::s(4);
-Matrix ElasticSection3d::ks(4,4);
-ID ElasticSection3d::code(4);
+thread_local FixedVector<4> ElasticSection3d::s;
+thread_local FixedMatrix<4,4> ElasticSection3d::ks;
+thread_local ID ElasticSection3d::code(4);
 
 void* OPS_ElasticSection3d()
 {
@@ -63,7 +63,7 @@ void* OPS_ElasticSection3d()
 
 ElasticSection3d::ElasticSection3d(void)
 :SectionForceDeformation(0, SEC_TAG_Elastic3d),
- E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0), e(4)
+ E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0)
 {
   if (code(0) != SECTION_RESPONSE_P) {
     code(0) = SECTION_RESPONSE_P;	// P is the first quantity
@@ -76,7 +76,7 @@ ElasticSection3d::ElasticSection3d(void)
 ElasticSection3d::ElasticSection3d
 (int tag, double E_in, double A_in, double Iz_in, double Iy_in, double G_in, double J_in)
 :SectionForceDeformation(tag, SEC_TAG_Elastic3d),
- E(E_in), A(A_in), Iz(Iz_in), Iy(Iy_in), G(G_in), J(J_in), e(4)
+ E(E_in), A(A_in), Iz(Iz_in), Iy(Iy_in), G(G_in), J(J_in)
 {
   if (E <= 0.0)  {
     //opserr << "ElasticSection3d::ElasticSection3d -- Input E <= 0.0\n";
@@ -217,6 +217,14 @@ ElasticSection3d::getCopy ()
 const ID&
 ElasticSection3d::getType ()
 {
+    // code is per thread, the constructor only set it for its own
+    if (code(0) != SECTION_RESPONSE_P) {
+      code(0) = SECTION_RESPONSE_P;
+      code(1) = SECTION_RESPONSE_MZ;
+      code(2) = SECTION_RESPONSE_MY;
+      code(3) = SECTION_RESPONSE_T;
+    }
+
     return code;
 }
 
@@ -231,7 +239,7 @@ ElasticSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
     
@@ -258,7 +266,7 @@ ElasticSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
     
-	static Vector data(7);
+	static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -28,6 +28,7 @@
 #include <SectionForceDeformation.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <FixedMatrix.h>
 
 class Channel;
 class FEM_ObjectBroker;
@@ -80,11 +81,11 @@ class ElasticSection3d : public SectionForceDeformation
   
   double E, A, Iz, Iy, G, J;
   
-  Vector e;			// section trial deformations
+  FixedVector<4> e;		// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
-  static ID code;
+  static thread_local FixedVector<4> s;
+  static thread_local FixedMatrix<4,4> ks;
+  static thread_local ID code;
 
   int parameterID;
 };
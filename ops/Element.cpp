@@ -44,12 +44,12 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+thread_local Matrix **Element::theMatrices(0); 
+thread_local Vector **Element::theVectors1(0); 
+thread_local Vector **Element::theVectors2(0); 
+thread_local int  Element::numMatrices(0);
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -58,7 +58,7 @@ int  Element::numMatrices(0);
 Element::Element(int tag, int cTag) 
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
-   Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1)
+   Kc(0), previousK(0), numPreviousK(0), nodeIndex(-1)
 {
   // does nothing
   ops_TheActiveElement = this;
@@ -119,68 +119,6 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
-
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
     if (Kc == 0) 
@@ -199,12 +137,76 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   return 0;
 }
 
+// getWorkAreaIndex()
+//	returns the location in the work area registry of the calling thread
+//	of the matrix and vectors sized for this element; the registry is
+//	per thread so element methods may be invoked concurrently.
+
+int
+Element::getWorkAreaIndex(void)
+{
+  int numDOF = this->getNumDOF();
+
+  for (int i=0; i<numMatrices; i++) {
+    Matrix *aMatrix = theMatrices[i];
+    if (aMatrix->noRows() == numDOF)
+      return i;
+  }
+
+  Matrix **nextMatrices = new Matrix *[numMatrices+1];
+  if (nextMatrices == 0) {
+    opserr << "Element::getTheMatrix - out of memory\n";
+  }
+  int j;
+  for (j=0; j<numMatrices; j++)
+    nextMatrices[j] = theMatrices[j];
+  Matrix *theMatrix = new Matrix(numDOF, numDOF);
+  if (theMatrix == 0) {
+    opserr << "Element::getTheMatrix - out of memory\n";
+    exit(-1);
+  }
+  nextMatrices[numMatrices] = theMatrix;
+
+  Vector **nextVectors1 = new Vector *[numMatrices+1];
+  Vector **nextVectors2 = new Vector *[numMatrices+1];
+  if (nextVectors1 == 0 || nextVectors2 == 0) {
+    opserr << "Element::getTheVector - out of memory\n";
+    exit(-1);
+  }
+
+  for (j=0; j<numMatrices; j++) {
+    nextVectors1[j] = theVectors1[j];
+    nextVectors2[j] = theVectors2[j];
+  }
+
+  Vector *theVector1 = new Vector(numDOF);
+  Vector *theVector2 = new Vector(numDOF);
+  if (theVector1 == 0 || theVector2 == 0) {
+    opserr << "Element::getTheVector - out of memory\n";
+    exit(-1);
+  }
+
+  nextVectors1[numMatrices] = theVector1;
+  nextVectors2[numMatrices] = theVector2;
+
+  if (numMatrices != 0) {
+    delete [] theMatrices;
+    delete [] theVectors1;
+    delete [] theVectors2;
+  }
+  int index = numMatrices;
+  numMatrices++;
+  theMatrices = nextMatrices;
+  theVectors1 = nextVectors1;
+  theVectors2 = nextVectors2;
+
+  return index;
+}
+
 const Matrix &
 Element::getDamp(void) 
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   // now compute the damping matrix
   Matrix *theMatrix = theMatrices[index]; 
@@ -227,9 +229,7 @@ Element::getDamp(void)
 const Matrix &
 Element::getMass(void)
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   // zero the matrix & return it
   Matrix *theMatrix = theMatrices[index]; 
@@ -240,9 +240,7 @@ Element::getMass(void)
 const Vector &
 Element::getResistingForceIncInertia(void) 
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   Matrix *theMatrix = theMatrices[index]; 
   Vector *theVector = theVectors2[index];
@@ -307,9 +305,7 @@ const Vector &
 Element::getRayleighDampingForces(void) 
 {
 
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   Matrix *theMatrix = theMatrices[index]; 
   Vector *theVector = theVectors2[index];
@@ -485,9 +481,7 @@ Element::getResponseSensitivity(int responseID, int gradIndex,
 const Vector &
 Element::getResistingForceSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   Vector *theVector = theVectors1[index];
   theVector->Zero();
@@ -498,9 +492,7 @@ Element::getResistingForceSensitivity(int gradIndex)
 const Matrix &
 Element::getInitialStiffSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   Matrix *theMatrix = theMatrices[index];
   theMatrix->Zero();
@@ -511,9 +503,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
 const Matrix &
 Element::getMassSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   Matrix *theMatrix = theMatrices[index];
   theMatrix->Zero();
@@ -541,9 +531,7 @@ Element::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool tag)
 const Matrix &
 Element::getDampSensitivity(int gradIndex) 
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = this->getWorkAreaIndex();
 
   // now compute the damping matrix
   Matrix *theMatrix = theMatrices[index]; 
@@ -575,7 +563,7 @@ Element::addResistingForceToNodalReaction(int flag)
   int numNodes = this->getNumExternalNodes();
   Node **theNodes = this->getNodePtrs();
 
-  static Vector theVector(48);
+  static thread_local Vector theVector(48);
 
   //
   // now determine the resisting force
@@ -703,9 +691,7 @@ Element::displaySelf(Renderer &, int mode, float fact, const char **displayModes
 const Matrix &
 Element::getGeometricTangentStiff()
 {
-    if (index == -1) {
-	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-    }
+    int index = this->getWorkAreaIndex();
     
     Matrix *theMatrix = theMatrices[index];
     theMatrix->Zero();
@@ -118,12 +118,14 @@ class Element : public DomainComponent
     Matrix **previousK;
     int numPreviousK;
 
-    int index, nodeIndex;
-
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    int getWorkAreaIndex(void);
+    int nodeIndex;
+
+    // work areas shared by all elements of one size, one set per thread
+    static thread_local Matrix ** theMatrices; 
+    static thread_local Vector ** theVectors1; 
+    static thread_local Vector ** theVectors2; 
+    static thread_local int numMatrices;
 
   private:
 };
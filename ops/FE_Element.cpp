@@ -40,17 +40,14 @@
 #include <Integrator.h>
 #include <Subdomain.h>
 #include <AnalysisModel.h>
+#include <LinearSOE.h>
 #include <Matrix.h>
 #include <Vector.h>
 
-#define MAX_NUM_DOF 64
 
 // static variables initialisation
 Matrix FE_Element::errMatrix(1,1);
 Vector FE_Element::errVector(1);
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
@@ -58,7 +55,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0),
+   theScatterMap(0), mapSOE(0), mapStamp(0)
 {
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
@@ -96,59 +94,23 @@ FE_Element::FE_Element(int tag, Element *ele)
 	}
     }
 
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-
     if (ele->isSubdomain() == false) {
 	
 	// if Elements are not subdomains, set up pointers to
 	// objects to return tangent Matrix and residual Vector.
 
-	if (numDOF <= MAX_NUM_DOF) {
-	    // use class wide objects
-	    if (theVectors[numDOF] == 0) {
-		theVectors[numDOF] = new Vector(numDOF);
-		theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-		if (theResidual == 0 || theResidual->Size() != numDOF ||	
-		    theTangent == 0 || theTangent->noCols() != numDOF)	{  
-		    opserr << "FE_Element::FE_Element(Element *) ";
-		    opserr << " ran out of memory for vector/Matrix of size :";
-		    opserr << numDOF << endln;
-		    exit(-1);
-		}
-	    } else {
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-	    }
-	} else {
-	    // create matrices and vectors for each object instance
-	    theResidual = new Vector(numDOF);
-	    theTangent = new Matrix(numDOF, numDOF);
-	    if (theResidual == 0 || theTangent ==0 ||
-		theTangent ==0 || theTangent->noRows() ==0) {
+	// each object has its own matrix and vector so that the tangent
+	// and residual of different elements can be formed concurrently
+	theResidual = new Vector(numDOF);
+	theTangent = new Matrix(numDOF, numDOF);
+	if (theResidual == 0 || theResidual->Size() != numDOF ||
+	    theTangent == 0 || theTangent->noRows() != numDOF) {
 	    
-		opserr << "FE_Element::FE_Element(Element *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} 
+	    opserr << "FE_Element::FE_Element(Element *) ";
+	    opserr << " ran out of memory for vector/Matrix of size :";
+	    opserr << numDOF << endln;
+	    exit(-1);
+	}
     } else {
 
 	// as subdomains have own matrix for tangent and residual don't need
@@ -158,37 +120,16 @@ FE_Element::FE_Element(int tag, Element *ele)
 	Subdomain *theSub = (Subdomain *)ele;
 	theSub->setFE_ElementPtr(this);
     }
- 
-    // increment number of FE_Elements by 1
-    numFEs++;
 }
 
 
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0),
+   theScatterMap(0), mapSOE(0), mapStamp(0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
-    numFEs++;
-
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-    
     // as subtypes have no access to the tangent or residual we don't set them
     // this way we can detect if subclass does not provide all methods it should
 }
@@ -199,28 +140,9 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
 //	destructor.
 FE_Element::~FE_Element()
 {
-
-    // decrement number of FE_Elements
-    numFEs--;
-
-    // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
-	if (theTangent != 0) delete theTangent;
-	if (theResidual != 0) delete theResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numFEs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
-    }
+    if (theTangent != 0) delete theTangent;
+    if (theResidual != 0) delete theResidual;
+    if (theScatterMap != 0) delete theScatterMap;
 }    
 
 
@@ -284,6 +206,36 @@ FE_Element::setID(void)
 }
 
 
+// const ID *getScatterMap(LinearSOE &theSOE);
+//	Method to return the map of the entries of the tangent into the
+//	storage of theSOE. The map is formed on the first call after the
+//	SOE has changed its storage; the ID is set before that happens.
+
+const ID *
+FE_Element::getScatterMap(LinearSOE &theSOE)
+{
+    int stamp = theSOE.getStorageStamp();
+    if (stamp == 0)
+	return 0;
+
+    if (mapSOE == &theSOE && mapStamp == stamp)
+	return theScatterMap;
+
+    if (theScatterMap == 0)
+	theScatterMap = new ID(1);
+
+    if (theSOE.formScatterMap(this->getID(), *theScatterMap) < 0) {
+	delete theScatterMap;
+	theScatterMap = 0;
+    }
+
+    mapSOE = &theSOE;
+    mapStamp = stamp;
+
+    return theScatterMap;
+}
+
+
 const Matrix &
 FE_Element::getTangent(Integrator *theNewIntegrator)
 {
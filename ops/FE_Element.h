@@ -43,6 +43,7 @@ class TransientIntegrator;
 class Element;
 class Integrator;
 class AnalysisModel;
+class LinearSOE;
 
 class FE_Element: public TaggedObject
 {
@@ -56,6 +57,10 @@ class FE_Element: public TaggedObject
     virtual const ID &getID(void) const;
     void setAnalysisModel(AnalysisModel &theModel);
     virtual int  setID(void);
+
+    // scatter map of getID() into the storage of A of theSOE, formed
+    // again when that storage changes; 0 if theSOE provides none
+    const ID *getScatterMap(LinearSOE &theSOE);
     
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
@@ -122,13 +127,14 @@ class FE_Element: public TaggedObject
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
 
+    ID *theScatterMap;
+    LinearSOE *mapSOE;         // SOE and storage stamp theScatterMap is for
+    int mapStamp;
+
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
     
 
 };
@@ -0,0 +1,360 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-16 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/FixedMatrix.h,v $
+
+// Description: This file contains the class templates FixedMatrix and
+// FixedVector.  They are a Matrix and a Vector whose size is a template
+// parameter and whose storage is an array inside the object, so they
+// are never allocated on the heap and never resized.  The Matrix or
+// Vector base is constructed as a view on that array (fromFree is set),
+// so either object can be passed to any method taking a Matrix& or a
+// Vector& without a copy.  The element access, Zero() and the
+// operations below are inlined with loop bounds that are known at
+// compile time, which lets the compiler unroll them, and they perform
+// no bounds or size checks.
+//
+// What: "@(#) FixedMatrix.h, revA"
+
+#ifndef FixedMatrix_h
+#define FixedMatrix_h
+
+#include <Matrix.h>
+#include <Vector.h>
+
+template <int R, int C>
+class FixedMatrix : public Matrix
+{
+  public:
+    FixedMatrix();
+    FixedMatrix(const FixedMatrix &other);
+
+    FixedMatrix &operator=(const FixedMatrix &other);
+    FixedMatrix &operator=(const Matrix &other);
+
+    inline double &operator()(int row, int col) {return values[col*R + row];}
+    inline double operator()(int row, int col) const {return values[col*R + row];}
+
+    inline double *getData(void) {return values;}
+    inline const double *getData(void) const {return values;}
+
+    void Zero(void);
+
+    // the general Matrix versions remain available for other arguments
+    using Matrix::operator();
+    using Matrix::addMatrix;
+    using Matrix::addMatrixProduct;
+    using Matrix::addMatrixTripleProduct;
+
+    // this = thisFact*this + otherFact*other
+    void addMatrix(double thisFact, const FixedMatrix &other, double otherFact);
+    // this = thisFact*this + otherFact*A*B
+    template <int N>
+    void addMatrixProduct(double thisFact, const FixedMatrix<R,N> &A,
+			  const FixedMatrix<N,C> &B, double otherFact);
+    // this = thisFact*this + otherFact*T'*B*T
+    template <int N>
+    void addMatrixTripleProduct(double thisFact, const FixedMatrix<N,R> &T,
+				const FixedMatrix<N,N> &B, double otherFact);
+
+  private:
+    double values[R*C];
+};
+
+template <int N>
+class FixedVector : public Vector
+{
+  public:
+    FixedVector();
+    FixedVector(const FixedVector &other);
+
+    FixedVector &operator=(const FixedVector &other);
+    FixedVector &operator=(const Vector &other);
+
+    inline double &operator()(int x) {return values[x];}
+    inline double operator()(int x) const {return values[x];}
+
+    inline double *getData(void) {return values;}
+    inline const double *getData(void) const {return values;}
+
+    void Zero(void);
+
+    // the general Vector versions remain available for other arguments
+    using Vector::operator();
+    using Vector::addVector;
+    using Vector::addMatrixVector;
+    using Vector::addMatrixTransposeVector;
+
+    // this = thisFact*this + otherFact*other
+    void addVector(double thisFact, const FixedVector &other, double otherFact);
+    // this = thisFact*this + otherFact*m*v
+    template <int M>
+    void addMatrixVector(double thisFact, const FixedMatrix<N,M> &m,
+			 const FixedVector<M> &v, double otherFact);
+    // this = thisFact*this + otherFact*m'*v
+    template <int M>
+    void addMatrixTransposeVector(double thisFact, const FixedMatrix<M,N> &m,
+				  const FixedVector<M> &v, double otherFact);
+
+  private:
+    double values[N];
+};
+
+
+/********* INLINED FIXEDMATRIX FUNCTIONS ***********/
+template <int R, int C>
+inline
+FixedMatrix<R,C>::FixedMatrix()
+:Matrix(values, R, C)
+{
+  for (int i = 0; i < R*C; i++)
+    values[i] = 0.0;
+}
+
+template <int R, int C>
+inline
+FixedMatrix<R,C>::FixedMatrix(const FixedMatrix &other)
+:Matrix(values, R, C)
+{
+  for (int i = 0; i < R*C; i++)
+    values[i] = other.values[i];
+}
+
+template <int R, int C>
+inline FixedMatrix<R,C> &
+FixedMatrix<R,C>::operator=(const FixedMatrix &other)
+{
+  for (int i = 0; i < R*C; i++)
+    values[i] = other.values[i];
+
+  return *this;
+}
+
+template <int R, int C>
+inline FixedMatrix<R,C> &
+FixedMatrix<R,C>::operator=(const Matrix &other)
+{
+  // Matrix::operator=() would reallocate the storage on a size mismatch
+  if (other.noRows() != R || other.noCols() != C) {
+    opserr << "FixedMatrix::operator=() - matrix dimensions do not match\n";
+    return *this;
+  }
+
+  Matrix::operator=(other);
+
+  return *this;
+}
+
+template <int R, int C>
+inline void
+FixedMatrix<R,C>::Zero(void)
+{
+  for (int i = 0; i < R*C; i++)
+    values[i] = 0.0;
+}
+
+template <int R, int C>
+inline void
+FixedMatrix<R,C>::addMatrix(double thisFact, const FixedMatrix &other, double otherFact)
+{
+  if (thisFact == 1.0)
+    for (int i = 0; i < R*C; i++)
+      values[i] += otherFact*other.values[i];
+  else if (thisFact == 0.0)
+    for (int i = 0; i < R*C; i++)
+      values[i] = otherFact*other.values[i];
+  else
+    for (int i = 0; i < R*C; i++)
+      values[i] = thisFact*values[i] + otherFact*other.values[i];
+}
+
+template <int R, int C>
+template <int N>
+inline void
+FixedMatrix<R,C>::addMatrixProduct(double thisFact, const FixedMatrix<R,N> &A,
+				   const FixedMatrix<N,C> &B, double otherFact)
+{
+  if (thisFact == 0.0)
+    this->Zero();
+  else if (thisFact != 1.0)
+    for (int i = 0; i < R*C; i++)
+      values[i] *= thisFact;
+
+  const double *a = A.getData();
+  const double *b = B.getData();
+
+  for (int j = 0; j < C; j++)
+    for (int k = 0; k < N; k++) {
+      double bkj = otherFact*b[j*N + k];
+      for (int i = 0; i < R; i++)
+	values[j*R + i] += a[k*R + i]*bkj;
+    }
+}
+
+template <int R, int C>
+template <int N>
+inline void
+FixedMatrix<R,C>::addMatrixTripleProduct(double thisFact, const FixedMatrix<N,R> &T,
+					 const FixedMatrix<N,N> &B, double otherFact)
+{
+  if (thisFact == 0.0)
+    this->Zero();
+  else if (thisFact != 1.0)
+    for (int i = 0; i < R*C; i++)
+      values[i] *= thisFact;
+
+  const double *t = T.getData();
+  const double *b = B.getData();
+
+  // BT = B*T, then this += otherFact*T'*BT
+  double bt[N*R];
+  for (int i = 0; i < N*R; i++)
+    bt[i] = 0.0;
+
+  for (int j = 0; j < R; j++)
+    for (int k = 0; k < N; k++) {
+      double tkj = t[j*N + k];
+      for (int i = 0; i < N; i++)
+	bt[j*N + i] += b[k*N + i]*tkj;
+    }
+
+  for (int j = 0; j < C; j++)
+    for (int i = 0; i < R; i++) {
+      double sum = 0.0;
+      for (int k = 0; k < N; k++)
+	sum += t[i*N + k]*bt[j*N + k];
+      values[j*R + i] += otherFact*sum;
+    }
+}
+
+
+/********* INLINED FIXEDVECTOR FUNCTIONS ***********/
+template <int N>
+inline
+FixedVector<N>::FixedVector()
+:Vector(values, N)
+{
+  for (int i = 0; i < N; i++)
+    values[i] = 0.0;
+}
+
+template <int N>
+inline
+FixedVector<N>::FixedVector(const FixedVector &other)
+:Vector(values, N)
+{
+  for (int i = 0; i < N; i++)
+    values[i] = other.values[i];
+}
+
+template <int N>
+inline FixedVector<N> &
+FixedVector<N>::operator=(const FixedVector &other)
+{
+  for (int i = 0; i < N; i++)
+    values[i] = other.values[i];
+
+  return *this;
+}
+
+template <int N>
+inline FixedVector<N> &
+FixedVector<N>::operator=(const Vector &other)
+{
+  // Vector::operator=() would reallocate the storage on a size mismatch
+  if (other.Size() != N) {
+    opserr << "FixedVector::operator=() - vector sizes do not match\n";
+    return *this;
+  }
+
+  Vector::operator=(other);
+
+  return *this;
+}
+
+template <int N>
+inline void
+FixedVector<N>::Zero(void)
+{
+  for (int i = 0; i < N; i++)
+    values[i] = 0.0;
+}
+
+template <int N>
+inline void
+FixedVector<N>::addVector(double thisFact, const FixedVector &other, double otherFact)
+{
+  if (thisFact == 1.0)
+    for (int i = 0; i < N; i++)
+      values[i] += otherFact*other.values[i];
+  else if (thisFact == 0.0)
+    for (int i = 0; i < N; i++)
+      values[i] = otherFact*other.values[i];
+  else
+    for (int i = 0; i < N; i++)
+      values[i] = thisFact*values[i] + otherFact*other.values[i];
+}
+
+template <int N>
+template <int M>
+inline void
+FixedVector<N>::addMatrixVector(double thisFact, const FixedMatrix<N,M> &m,
+				const FixedVector<M> &v, double otherFact)
+{
+  if (thisFact == 0.0)
+    this->Zero();
+  else if (thisFact != 1.0)
+    for (int i = 0; i < N; i++)
+      values[i] *= thisFact;
+
+  const double *a = m.getData();
+
+  for (int j = 0; j < M; j++) {
+    double vj = otherFact*v(j);
+    for (int i = 0; i < N; i++)
+      values[i] += a[j*N + i]*vj;
+  }
+}
+
+template <int N>
+template <int M>
+inline void
+FixedVector<N>::addMatrixTransposeVector(double thisFact, const FixedMatrix<M,N> &m,
+					 const FixedVector<M> &v, double otherFact)
+{
+  if (thisFact == 0.0)
+    this->Zero();
+  else if (thisFact != 1.0)
+    for (int i = 0; i < N; i++)
+      values[i] *= thisFact;
+
+  const double *a = m.getData();
+
+  for (int i = 0; i < N; i++) {
+    double sum = 0.0;
+    for (int j = 0; j < M; j++)
+      sum += a[i*M + j]*v(j);
+    values[i] += otherFact*sum;
+  }
+}
+
+#endif
@@ -39,9 +39,9 @@ class Element;
 #define MAX_FILENAMELENGTH 50
 
 //extern ErrorHandler *g3ErrorHandler;   // error handler for sending warning & fatal error messages
-extern double   ops_Dt;                // current delta T for current domain doing an update
+extern thread_local double   ops_Dt;                // current delta T for current domain doing an update
 // extern double  *ops_Gravity;        // gravity factors for current domain undergoing an update
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+extern thread_local Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern thread_local Element *ops_TheActiveElement;  // current element undergoing an update
 
 #endif
@@ -0,0 +1,116 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/load/GroundDisplacement.cpp,v $
+
+
+// Description: This file contains the implementation for the GroundDisplacement class.
+//
+// What: "@(#) GroundDisplacement.C, revA"
+
+#include <GroundDisplacement.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <classTags.h>
+
+GroundDisplacement::GroundDisplacement(int tag, const Vector &disp, int theElementTag)
+  :ElementalLoad(tag, LOAD_TAG_GroundDisplacement, theElementTag),
+   data(disp)
+{
+
+}
+
+GroundDisplacement::GroundDisplacement()
+  :ElementalLoad(LOAD_TAG_GroundDisplacement),
+   data(0)
+{
+
+}
+
+GroundDisplacement::~GroundDisplacement()
+{
+
+}
+
+const Vector &
+GroundDisplacement::getData(int &type, double loadFactor)
+{
+  // the element scales the reference displacement by the load factor
+  type = LOAD_TAG_GroundDisplacement;
+  return data;
+}
+
+int
+GroundDisplacement::sendSelf(int commitTag, Channel &theChannel)
+{
+  int dbTag = this->getDbTag();
+
+  static thread_local ID idData(3);
+  idData(0) = this->getTag();
+  idData(1) = eleTag;
+  idData(2) = data.Size();
+  if (theChannel.sendID(dbTag, commitTag, idData) < 0) {
+    opserr << "GroundDisplacement::sendSelf - failed to send ID data\n";
+    return -1;
+  }
+
+  if (theChannel.sendVector(dbTag, commitTag, data) < 0) {
+    opserr << "GroundDisplacement::sendSelf - failed to send the Vector\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+GroundDisplacement::recvSelf(int commitTag, Channel &theChannel,
+			     FEM_ObjectBroker &theBroker)
+{
+  int dbTag = this->getDbTag();
+
+  static thread_local ID idData(3);
+  if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
+    opserr << "GroundDisplacement::recvSelf - failed to receive ID data\n";
+    return -1;
+  }
+
+  this->setTag(idData(0));
+  eleTag = idData(1);
+  data.resize(idData(2));
+
+  if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
+    opserr << "GroundDisplacement::recvSelf - failed to receive the Vector\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+void
+GroundDisplacement::Print(OPS_Stream &s, int flag)
+{
+  s << "GroundDisplacement - Reference load" << endln;
+  s << "  Ground displacement: " << data;
+  s << "  Element: " << eleTag << endln;
+}
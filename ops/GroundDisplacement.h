@@ -0,0 +1,59 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/load/GroundDisplacement.h,v $
+
+
+#ifndef GroundDisplacement_h
+#define GroundDisplacement_h
+
+// Description: This file contains the class definition for GroundDisplacement.
+// GroundDisplacement is an ElementalLoad prescribing the displacement of the
+// ground a GroundedSpring element is attached to, one value for each of the
+// materials of the element.  The values are scaled by the load factor of the
+// load pattern, like the value of an SP_Constraint.
+//
+// What: "@(#) GroundDisplacement.h, revA"
+
+#include <ElementalLoad.h>
+
+class GroundDisplacement : public ElementalLoad
+{
+  public:
+    GroundDisplacement(int tag, const Vector &disp, int eleTag);
+    GroundDisplacement();
+    ~GroundDisplacement();
+
+    const Vector &getData(int &type, double loadFactor);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+  protected:
+
+  private:
+    Vector data;    // reference ground displacement for each material
+};
+
+#endif
@@ -0,0 +1,526 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/zeroLength/GroundedSpring.cpp,v $
+
+
+// Description: This file contains the implementation for the GroundedSpring class.
+//
+// What: "@(#) GroundedSpring.C, revA"
+
+#include <GroundedSpring.h>
+#include <GroundDisplacement.h>
+#include <Information.h>
+#include <ElementResponse.h>
+
+#include <Domain.h>
+#include <Node.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <UniaxialMaterial.h>
+#include <classTags.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+GroundedSpring::GroundedSpring(int tag, int node,
+			       int numMat, UniaxialMaterial **theMat,
+			       const ID &dir)
+ :Element(tag, ELE_TAG_GroundedSpring),
+  connectedExternalNodes(1), numDOF(0),
+  theMatrix(0), theVector(0),
+  numMaterials(numMat), theMaterials(0), direction(dir),
+  groundDisp(numMat), trialDeformation(numMat)
+{
+    connectedExternalNodes(0) = node;
+    theNodes[0] = 0;
+
+    if (direction.Size() != numMaterials) {
+      opserr << "FATAL GroundedSpring::GroundedSpring - " << numMaterials;
+      opserr << " materials but " << direction.Size() << " directions\n";
+      exit(-1);
+    }
+
+    // get a copy of the material objects and check we obtained a valid copy
+    theMaterials = new UniaxialMaterial *[numMaterials];
+    for (int i=0; i<numMaterials; i++) {
+      theMaterials[i] = theMat[i]->getCopy();
+      if (theMaterials[i] == 0) {
+	opserr << "FATAL GroundedSpring::GroundedSpring - failed to get a copy of material " << theMat[i]->getTag() << endln;
+	exit(-1);
+      }
+    }
+}
+
+GroundedSpring::GroundedSpring()
+ :Element(0, ELE_TAG_GroundedSpring),
+  connectedExternalNodes(1), numDOF(0),
+  theMatrix(0), theVector(0),
+  numMaterials(0), theMaterials(0), direction(0),
+  groundDisp(0), trialDeformation(0)
+{
+    theNodes[0] = 0;
+}
+
+GroundedSpring::~GroundedSpring()
+{
+    for (int i=0; i<numMaterials; i++)
+      if (theMaterials[i] != 0)
+	delete theMaterials[i];
+
+    if (theMaterials != 0)
+      delete [] theMaterials;
+
+    if (theMatrix != 0)
+      delete theMatrix;
+    if (theVector != 0)
+      delete theVector;
+}
+
+int
+GroundedSpring::getNumExternalNodes(void) const
+{
+    return 1;
+}
+
+const ID &
+GroundedSpring::getExternalNodes(void)
+{
+    return connectedExternalNodes;
+}
+
+Node **
+GroundedSpring::getNodePtrs(void)
+{
+    return theNodes;
+}
+
+int
+GroundedSpring::getNumDOF(void)
+{
+    return numDOF;
+}
+
+void
+GroundedSpring::setDomain(Domain *theDomain)
+{
+    // check Domain is not null - invoked when object removed from a domain
+    if (theDomain == 0) {
+      theNodes[0] = 0;
+      return;
+    }
+
+    theNodes[0] = theDomain->getNode(connectedExternalNodes(0));
+    if (theNodes[0] == 0) {
+      opserr << "WARNING GroundedSpring::setDomain() - node " << connectedExternalNodes(0);
+      opserr << " does not exist in model for GroundedSpring ele: " << this->getTag() << endln;
+      return;
+    }
+
+    numDOF = theNodes[0]->getNumberDOF();
+
+    for (int i=0; i<numMaterials; i++) {
+      if (direction(i) < 0 || direction(i) >= numDOF) {
+	opserr << "WARNING GroundedSpring::setDomain() - direction " << direction(i);
+	opserr << " outside the " << numDOF << " dof of node " << connectedExternalNodes(0) << endln;
+	numDOF = 0;
+	return;
+      }
+    }
+
+    // each element owns its matrix and vector so that the state of
+    // several elements may be determined concurrently
+    if (theMatrix == 0 || theMatrix->noRows() != numDOF) {
+      if (theMatrix != 0)
+	delete theMatrix;
+      if (theVector != 0)
+	delete theVector;
+      theMatrix = new Matrix(numDOF, numDOF);
+      theVector = new Vector(numDOF);
+    }
+
+    // call the base class method
+    this->DomainComponent::setDomain(theDomain);
+}
+
+int
+GroundedSpring::commitState(void)
+{
+    int code = 0;
+
+    // call element commitState to do any base class stuff
+    if ((code = this->Element::commitState()) != 0) {
+      opserr << "GroundedSpring::commitState () - failed in base class";
+    }
+
+    for (int i=0; i<numMaterials; i++)
+      code += theMaterials[i]->commitState();
+
+    return code;
+}
+
+int
+GroundedSpring::revertToLastCommit(void)
+{
+    int code = 0;
+
+    for (int i=0; i<numMaterials; i++)
+      code += theMaterials[i]->revertToLastCommit();
+
+    return code;
+}
+
+int
+GroundedSpring::revertToStart(void)
+{
+    int code = 0;
+
+    for (int i=0; i<numMaterials; i++)
+      code += theMaterials[i]->revertToStart();
+
+    trialDeformation.Zero();
+
+    return code;
+}
+
+int
+GroundedSpring::update(void)
+{
+    const Vector &disp = theNodes[0]->getTrialDisp();
+    const Vector &vel  = theNodes[0]->getTrialVel();
+
+    int ret = 0;
+    for (int i=0; i<numMaterials; i++) {
+      trialDeformation(i) = disp(direction(i)) - groundDisp(i);
+      ret += theMaterials[i]->setTrialStrain(trialDeformation(i), vel(direction(i)));
+    }
+
+    return ret;
+}
+
+const Matrix &
+GroundedSpring::getTangentStiff(void)
+{
+    theMatrix->Zero();
+
+    for (int i=0; i<numMaterials; i++)
+      (*theMatrix)(direction(i), direction(i)) += theMaterials[i]->getTangent();
+
+    return *theMatrix;
+}
+
+const Matrix &
+GroundedSpring::getInitialStiff(void)
+{
+    theMatrix->Zero();
+
+    for (int i=0; i<numMaterials; i++)
+      (*theMatrix)(direction(i), direction(i)) += theMaterials[i]->getInitialTangent();
+
+    return *theMatrix;
+}
+
+const Matrix &
+GroundedSpring::getMass(void)
+{
+    // no mass
+    theMatrix->Zero();
+    return *theMatrix;
+}
+
+void
+GroundedSpring::zeroLoad(void)
+{
+    groundDisp.Zero();
+}
+
+int
+GroundedSpring::addLoad(ElementalLoad *theLoad, double loadFactor)
+{
+    int type;
+    const Vector &data = theLoad->getData(type, loadFactor);
+
+    if (type != LOAD_TAG_GroundDisplacement || data.Size() != numMaterials) {
+      opserr << "GroundedSpring::addLoad - load type unknown for element with tag: " << this->getTag() << endln;
+      return -1;
+    }
+
+    groundDisp.addVector(1.0, data, loadFactor);
+
+    return 0;
+}
+
+int
+GroundedSpring::addInertiaLoadToUnbalance(const Vector &accel)
+{
+    // does nothing as element has no mass
+    return 0;
+}
+
+const Vector &
+GroundedSpring::getResistingForce(void)
+{
+    theVector->Zero();
+
+    const Vector &disp = theNodes[0]->getTrialDisp();
+
+    // the materials hold the state at trialDeformation; a ground displacement
+    // applied since then is added with the tangent until the next update()
+    for (int i=0; i<numMaterials; i++) {
+      double du = disp(direction(i)) - groundDisp(i) - trialDeformation(i);
+      (*theVector)(direction(i)) += theMaterials[i]->getStress() + theMaterials[i]->getTangent()*du;
+    }
+
+    return *theVector;
+}
+
+const Vector &
+GroundedSpring::getResistingForceIncInertia(void)
+{
+    return this->getResistingForce();
+}
+
+int
+GroundedSpring::sendSelf(int commitTag, Channel &theChannel)
+{
+    int res = 0;
+    int dataTag = this->getDbTag();
+
+    static thread_local ID idData(3);
+    idData(0) = this->getTag();
+    idData(1) = connectedExternalNodes(0);
+    idData(2) = numMaterials;
+
+    res += theChannel.sendID(dataTag, commitTag, idData);
+    if (res < 0) {
+      opserr << "GroundedSpring::sendSelf -- failed to send ID data\n";
+      return res;
+    }
+
+    ID classTags(3*numMaterials);
+    for (int i=0; i<numMaterials; i++) {
+      int matDbTag = theMaterials[i]->getDbTag();
+      if (matDbTag == 0) {
+	matDbTag = theChannel.getDbTag();
+	if (matDbTag != 0)
+	  theMaterials[i]->setDbTag(matDbTag);
+      }
+      classTags(i) = matDbTag;
+      classTags(numMaterials+i) = theMaterials[i]->getClassTag();
+      classTags(2*numMaterials+i) = direction(i);
+    }
+
+    res += theChannel.sendID(dataTag, commitTag, classTags);
+    if (res < 0) {
+      opserr << "GroundedSpring::sendSelf -- failed to send classTags ID\n";
+      return res;
+    }
+
+    for (int i=0; i<numMaterials; i++) {
+      res += theMaterials[i]->sendSelf(commitTag, theChannel);
+      if (res < 0) {
+	opserr << "GroundedSpring::sendSelf -- failed to send material " << i << endln;
+	return res;
+      }
+    }
+
+    return res;
+}
+
+int
+GroundedSpring::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    int res = 0;
+    int dataTag = this->getDbTag();
+
+    static thread_local ID idData(3);
+    res += theChannel.recvID(dataTag, commitTag, idData);
+    if (res < 0) {
+      opserr << "GroundedSpring::recvSelf -- failed to receive ID data\n";
+      return res;
+    }
+
+    this->setTag(idData(0));
+    connectedExternalNodes(0) = idData(1);
+
+    if (numMaterials != idData(2)) {
+      for (int i=0; i<numMaterials; i++)
+	if (theMaterials[i] != 0)
+	  delete theMaterials[i];
+      if (theMaterials != 0)
+	delete [] theMaterials;
+
+      numMaterials = idData(2);
+      theMaterials = new UniaxialMaterial *[numMaterials];
+      for (int i=0; i<numMaterials; i++)
+	theMaterials[i] = 0;
+
+      direction.resize(numMaterials);
+      groundDisp.resize(numMaterials);
+      trialDeformation.resize(numMaterials);
+    }
+
+    ID classTags(3*numMaterials);
+    res += theChannel.recvID(dataTag, commitTag, classTags);
+    if (res < 0) {
+      opserr << "GroundedSpring::recvSelf -- failed to receive classTags ID\n";
+      return res;
+    }
+
+    for (int i=0; i<numMaterials; i++) {
+      int matClassTag = classTags(numMaterials+i);
+
+      // a new material from the broker if there is none, or one of the wrong type
+      if (theMaterials[i] != 0 && theMaterials[i]->getClassTag() != matClassTag) {
+	delete theMaterials[i];
+	theMaterials[i] = 0;
+      }
+      if (theMaterials[i] == 0)
+	theMaterials[i] = theBroker.getNewUniaxialMaterial(matClassTag);
+
+      if (theMaterials[i] == 0) {
+	opserr << "GroundedSpring::recvSelf -- failed to allocate new material " << i << endln;
+	return -1;
+      }
+
+      theMaterials[i]->setDbTag(classTags(i));
+      res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
+      if (res < 0) {
+	opserr << "GroundedSpring::recvSelf -- failed to receive material " << i << endln;
+	return res;
+      }
+
+      direction(i) = classTags(2*numMaterials+i);
+    }
+
+    return res;
+}
+
+void
+GroundedSpring::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+      s << "Element: " << this->getTag();
+      s << " type: GroundedSpring  Node: " << connectedExternalNodes(0) << endln;
+      for (int i=0; i<numMaterials; i++) {
+	s << "\tMaterial, tag: " << theMaterials[i]->getTag()
+	  << ", dir: " << direction(i)
+	  << ", ground displacement: " << groundDisp(i) << endln;
+	s << *(theMaterials[i]);
+      }
+    } else if (flag == 1) {
+      s << this->getTag() << "  " << trialDeformation;
+    }
+}
+
+Response *
+GroundedSpring::setResponse(const char **argv, int argc, OPS_Stream &output)
+{
+    Response *theResponse = 0;
+
+    output.tag("ElementOutput");
+    output.attr("eleType", "GroundedSpring");
+    output.attr("eleTag", this->getTag());
+    output.attr("node1", connectedExternalNodes[0]);
+
+    char outputData[16];   // a letter and any int
+
+    if (strcmp(argv[0],"force") == 0 || strcmp(argv[0],"forces") == 0 ||
+	strcmp(argv[0],"basicForce") == 0 || strcmp(argv[0],"basicForces") == 0) {
+
+      for (int i=0; i<numMaterials; i++) {
+	snprintf(outputData, sizeof(outputData), "P%d", i+1);
+	output.tag("ResponseType", outputData);
+      }
+      theResponse = new ElementResponse(this, 1, Vector(numMaterials));
+
+    } else if (strcmp(argv[0],"deformation") == 0 || strcmp(argv[0],"deformations") == 0 ||
+	       strcmp(argv[0],"basicDeformation") == 0) {
+
+      for (int i=0; i<numMaterials; i++) {
+	snprintf(outputData, sizeof(outputData), "e%d", i+1);
+	output.tag("ResponseType", outputData);
+      }
+      theResponse = new ElementResponse(this, 2, Vector(numMaterials));
+
+    } else if (strcmp(argv[0],"material") == 0) {
+      if (argc > 2) {
+	int matNum = atoi(argv[1]);
+	if (matNum >= 1 && matNum <= numMaterials)
+	  theResponse = theMaterials[matNum-1]->setResponse(&argv[2], argc-2, output);
+      }
+    }
+
+    output.endTag();
+
+    return theResponse;
+}
+
+int
+GroundedSpring::getResponse(int responseID, Information &eleInformation)
+{
+    switch (responseID) {
+    case 1:
+      if (eleInformation.theVector != 0) {
+	for (int i=0; i<numMaterials; i++)
+	  (*(eleInformation.theVector))(i) = theMaterials[i]->getStress();
+      }
+      return 0;
+
+    case 2:
+      if (eleInformation.theVector != 0) {
+	for (int i=0; i<numMaterials; i++)
+	  (*(eleInformation.theVector))(i) = theMaterials[i]->getStrain();
+      }
+      return 0;
+
+    default:
+      return -1;
+    }
+}
+
+int
+GroundedSpring::setParameter(const char **argv, int argc, Parameter &param)
+{
+    int result = -1;
+
+    if (argc < 1)
+      return -1;
+
+    if (strcmp(argv[0], "material") == 0) {
+      if (argc > 2) {
+	int matNum = atoi(argv[1]);
+	if (matNum >= 1 && matNum <= numMaterials)
+	  return theMaterials[matNum-1]->setParameter(&argv[2], argc-2, param);
+      }
+      return -1;
+    }
+
+    // p-y, t-z and q-z parameters go to whichever material knows them
+    for (int i=0; i<numMaterials; i++) {
+      int res = theMaterials[i]->setParameter(argv, argc, param);
+      if (res != -1)
+	result = res;
+    }
+
+    return result;
+}
@@ -0,0 +1,119 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/zeroLength/GroundedSpring.h,v $
+
+
+#ifndef GroundedSpring_h
+#define GroundedSpring_h
+
+// Description: This file contains the class definition for GroundedSpring.
+// A GroundedSpring element connects a single node to the ground through one
+// or more uniaxial materials, each acting along one dof of the node.  The
+// deformation of a material is the nodal displacement less the displacement
+// of the ground, which is zero unless prescribed by GroundDisplacement loads
+// of the active load patterns.  It replaces a ZeroLength element between the
+// node and a fixed (or moving) ground node, together with the constraints
+// tying that ground node and the spring node to the structure.
+//
+// A change of the ground displacement enters the resisting force linearised
+// about the last trial state until the next update(); the materials thus only
+// see deformations the structure has followed.
+//
+// What: "@(#) GroundedSpring.h, revA"
+
+#include <Element.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+class Node;
+class Channel;
+class UniaxialMaterial;
+class Response;
+
+class GroundedSpring : public Element
+{
+  public:
+    GroundedSpring(int tag, int node,
+		   int numMaterials, UniaxialMaterial **theMaterials,
+		   const ID &direction);
+    GroundedSpring();
+    ~GroundedSpring();
+
+    const char *getClassType(void) const {return "GroundedSpring";};
+
+    // public methods to obtain inforrmation about dof & connectivity
+    int getNumExternalNodes(void) const;
+    const ID &getExternalNodes(void);
+    Node **getNodePtrs(void);
+
+    int getNumDOF(void);
+    void setDomain(Domain *theDomain);
+
+    // public methods to set the state of the element
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+    int update(void);
+
+    // public methods to obtain stiffness, mass, damping and residual information
+    const Matrix &getTangentStiff(void);
+    const Matrix &getInitialStiff(void);
+    const Matrix &getMass(void);
+
+    void zeroLoad(void);
+    int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int addInertiaLoadToUnbalance(const Vector &accel);
+
+    const Vector &getResistingForce(void);
+    const Vector &getResistingForceIncInertia(void);
+
+    // public methods for element output
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+    Response *setResponse(const char **argv, int argc, OPS_Stream &s);
+    int getResponse(int responseID, Information &eleInformation);
+
+    int setParameter(const char **argv, int argc, Parameter &param);
+
+  protected:
+
+  private:
+    ID  connectedExternalNodes;         // contains the tag of the node
+    int numDOF;                         // number of dof of the node
+    Node *theNodes[1];
+
+    Matrix *theMatrix;                  // objects own matrix, sized for numDOF
+    Vector *theVector;                  // objects own vector, sized for numDOF
+
+    int numMaterials;                   // number of uniaxial materials
+    UniaxialMaterial **theMaterials;    // array of pointers to the materials
+    ID  direction;                      // node dof each material acts along
+
+    Vector groundDisp;                  // ground displacement along each direction
+    Vector trialDeformation;            // deformation the materials were last set to
+};
+
+#endif
@@ -35,18 +35,20 @@
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
 #include <Vector.h>
+#include <Matrix.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
 #include <cmath>
+#include <vector>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0), numThreads(1)
 {
   
 }
@@ -100,16 +102,112 @@ IncrementalIntegrator::formTangent(int statFlag)
     // efficiency when performing parallel computations - CHANGE
 
     // loop through the FE_Elements adding their contributions to the tangent
+    if (this->formElementTangent() < 0)
+	result = -3;
+
+    return result;
+}
+
+void
+IncrementalIntegrator::setNumThreads(int num)
+{
+    numThreads = (num > 0) ? num : 1;
+}
+
+int
+IncrementalIntegrator::getNumThreads(void) const
+{
+    return numThreads;
+}
+
+int
+IncrementalIntegrator::domainChanged(void)
+{
+    // the FE_Elements may have been replaced, the colors are formed again
+    colorFEs.clear();
+    colorStart.clear();
+
+    return this->Integrator::domainChanged();
+}
+
+// the FE_Elements are colored greedily in element order: each gets the
+// smallest color not taken by an earlier element with an equation in
+// common. The elements of a color then share no equations; every entry
+// of A and B receives the contributions of its elements in color order,
+// and in element order within a color, whatever the number of threads.
+int
+IncrementalIntegrator::formElementColors(void)
+{
+    int numEqn = theSOE->getNumEqn();
+    std::vector<std::vector<int> > eqnColors(numEqn);
+    std::vector<int> takenBy;
+
+    std::vector<FE_Element *> theFEs;
+    std::vector<int> theColors;
+    int numColors = 0;
+
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
     FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "WARNING IncrementalIntegrator::formTangent -";
-	    opserr << " failed in addA for ID " << elePtr->getID();	    
-	    result = -3;
+
+    while ((elePtr = theEles()) != 0) {
+	const ID &id = elePtr->getID();
+	int ele = (int)theFEs.size();
+	for (int i=0; i<id.Size(); i++) {
+	    int eq = id(i);
+	    if (eq >= 0 && eq < numEqn)
+		for (int k=0; k<(int)eqnColors[eq].size(); k++)
+		    takenBy[eqnColors[eq][k]] = ele;
 	}
 
-    return result;
+	int color = 0;
+	while (color < numColors && takenBy[color] == ele)
+	    color++;
+	if (color == numColors)
+	    takenBy.push_back(-1);
+
+	for (int i=0; i<id.Size(); i++) {
+	    int eq = id(i);
+	    if (eq >= 0 && eq < numEqn)
+		eqnColors[eq].push_back(color);
+	}
+
+	theFEs.push_back(elePtr);
+	theColors.push_back(color);
+	if (color >= numColors)
+	    numColors = color+1;
+    }
+
+    // order by color, keeping the element order within a color
+    colorStart.assign(numColors+1, 0);
+    for (int i=0; i<(int)theColors.size(); i++)
+	colorStart[theColors[i]+1]++;
+    for (int c=0; c<numColors; c++)
+	colorStart[c+1] += colorStart[c];
+
+    std::vector<int> next(colorStart.begin(), colorStart.end()-1);
+    colorFEs.resize(theFEs.size());
+    for (int i=0; i<(int)theFEs.size(); i++)
+	colorFEs[next[theColors[i]]++] = theFEs[i];
+
+    return numColors;
+}
+
+// the elements of a color are added concurrently if there are enough of
+// them to be worth the wait at its end; a run of colors with fewer is
+// added by one thread, in color order, up to the returned color
+int
+IncrementalIntegrator::lastColorOfStage(int color) const
+{
+    int minSize = 4*numThreads;
+    int numColors = (int)colorStart.size() - 1;
+
+    if (colorStart[color+1] - colorStart[color] >= minSize)
+	return color;
+
+    while (color+1 < numColors && colorStart[color+2] - colorStart[color+1] < minSize)
+	color++;
+
+    return color;
 }
 
 int
@@ -255,6 +353,119 @@ IncrementalIntegrator::formNodalUnbalance(void)
     return res;
 }
 
+// adds the tangent of an FE_Element through its scatter map if the SOE
+// provides one, the map stays valid between iterations
+static int
+addElementTangent(LinearSOE &theSOE, FE_Element &theFE, const Matrix &theTangent)
+{
+    const ID *theMap = theFE.getScatterMap(theSOE);
+    if (theMap != 0)
+	return theSOE.addAScatter(theTangent, *theMap);
+
+    return theSOE.addA(theTangent, theFE.getID());
+}
+
+int 
+IncrementalIntegrator::formElementTangent(void)
+{
+    // loop through the FE_Elements and add the tangent
+    FE_Element *elePtr;
+
+    int res = 0;
+
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+
+    if (theSOE->getStorageStamp() != 0) {
+	// the element tangents are added color by color, in the same order
+	// whatever the number of threads
+	if (colorStart.empty())
+	    this->formElementColors();
+
+	int numFEs = (int)colorFEs.size();
+	std::vector<char> failed(numFEs, 0);
+
+#ifdef _OPENMP
+	if (numThreads > 1) {
+	    // formed concurrently, as below, then the elements of a color are
+	    // added concurrently
+	    int numColors = (int)colorStart.size() - 1;
+	    std::vector<const Matrix *> theTangents(numFEs);
+
+#pragma omp parallel num_threads(numThreads)
+	    {
+#pragma omp for schedule(dynamic, 8)
+		for (int i=0; i<numFEs; i++)
+		    theTangents[i] = &(colorFEs[i]->getTangent(this));
+
+		for (int c=0; c<numColors; ) {
+		    int last = lastColorOfStage(c);
+		    if (last == c) {
+#pragma omp for schedule(dynamic, 4)
+			for (int i=colorStart[c]; i<colorStart[c+1]; i++)
+			    if (addElementTangent(*theSOE, *colorFEs[i], *theTangents[i]) < 0)
+				failed[i] = 1;
+		    } else {
+#pragma omp single
+			for (int i=colorStart[c]; i<colorStart[last+1]; i++)
+			    if (addElementTangent(*theSOE, *colorFEs[i], *theTangents[i]) < 0)
+				failed[i] = 1;
+		    }
+		    c = last+1;
+		}
+	    }
+	} else
+#endif
+	for (int i=0; i<numFEs; i++)
+	    if (addElementTangent(*theSOE, *colorFEs[i], colorFEs[i]->getTangent(this)) < 0)
+		failed[i] = 1;
+
+	for (int i=0; i<numFEs; i++)
+	    if (failed[i] != 0) {
+		opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+		opserr << " failed in addA for ID " << colorFEs[i]->getID();
+		res = -2;
+	    }
+
+	return res;
+    }
+
+#ifdef _OPENMP
+    if (numThreads > 1) {
+	// the element tangents are formed concurrently, each FE_Element
+	// into its own matrix; they are then added in element order so
+	// that A does not depend on the number of threads
+	std::vector<FE_Element *> theFEs;
+	while((elePtr = theEles2()) != 0)
+	    theFEs.push_back(elePtr);
+
+	int numFEs = (int)theFEs.size();
+	std::vector<const Matrix *> theTangents(numFEs);
+
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 8)
+	for (int i=0; i<numFEs; i++)
+	    theTangents[i] = &(theFEs[i]->getTangent(this));
+
+	for (int i=0; i<numFEs; i++)
+	    if (addElementTangent(*theSOE, *theFEs[i], *theTangents[i]) < 0) {
+		opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+		opserr << " failed in addA for ID " << theFEs[i]->getID();
+		res = -2;
+	    }
+
+	return res;
+    }
+#endif
+
+    while((elePtr = theEles2()) != 0)     
+	if (addElementTangent(*theSOE, *elePtr, elePtr->getTangent(this)) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+	    opserr << " failed in addA for ID " << elePtr->getID();	    
+	    res = -2;
+	}
+
+    return res;
+}
+
 int 
 IncrementalIntegrator::formElementResidual(void)
 {
@@ -264,6 +475,83 @@ IncrementalIntegrator::formElementResidual(void)
     int res = 0;    
 
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+
+    if (theSOE->getStorageStamp() != 0) {
+	// as for the tangent: added color by color
+	if (colorStart.empty())
+	    this->formElementColors();
+
+	int numFEs = (int)colorFEs.size();
+	std::vector<char> failed(numFEs, 0);
+
+#ifdef _OPENMP
+	if (numThreads > 1) {
+	    int numColors = (int)colorStart.size() - 1;
+	    std::vector<const Vector *> theResiduals(numFEs);
+
+#pragma omp parallel num_threads(numThreads)
+	    {
+#pragma omp for schedule(dynamic, 8)
+		for (int i=0; i<numFEs; i++)
+		    theResiduals[i] = &(colorFEs[i]->getResidual(this));
+
+		for (int c=0; c<numColors; ) {
+		    int last = lastColorOfStage(c);
+		    if (last == c) {
+#pragma omp for schedule(dynamic, 4)
+			for (int i=colorStart[c]; i<colorStart[c+1]; i++)
+			    if (theSOE->addB(*theResiduals[i], colorFEs[i]->getID()) < 0)
+				failed[i] = 1;
+		    } else {
+#pragma omp single
+			for (int i=colorStart[c]; i<colorStart[last+1]; i++)
+			    if (theSOE->addB(*theResiduals[i], colorFEs[i]->getID()) < 0)
+				failed[i] = 1;
+		    }
+		    c = last+1;
+		}
+	    }
+	} else
+#endif
+	for (int i=0; i<numFEs; i++)
+	    if (theSOE->addB(colorFEs[i]->getResidual(this), colorFEs[i]->getID()) < 0)
+		failed[i] = 1;
+
+	for (int i=0; i<numFEs; i++)
+	    if (failed[i] != 0) {
+		opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+		opserr << " failed in addB for ID " << colorFEs[i]->getID();
+		res = -2;
+	    }
+
+	return res;
+    }
+
+#ifdef _OPENMP
+    if (numThreads > 1) {
+	// as for the tangent: formed concurrently, added in element order
+	std::vector<FE_Element *> theFEs;
+	while((elePtr = theEles2()) != 0)
+	    theFEs.push_back(elePtr);
+
+	int numFEs = (int)theFEs.size();
+	std::vector<const Vector *> theResiduals(numFEs);
+
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 8)
+	for (int i=0; i<numFEs; i++)
+	    theResiduals[i] = &(theFEs[i]->getResidual(this));
+
+	for (int i=0; i<numFEs; i++)
+	    if (theSOE->addB(*theResiduals[i],theFEs[i]->getID()) < 0) {
+		opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+		opserr << " failed in addB for ID " << theFEs[i]->getID();
+		res = -2;
+	    }
+
+	return res;
+    }
+#endif
+
     while((elePtr = theEles2()) != 0) {
 
 	if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0) {
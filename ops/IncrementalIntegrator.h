@@ -37,6 +37,7 @@
 // What: "@(#) IncrementalIntegrator.h, revA"
 
 #include <Integrator.h>
+#include <vector>
 
 class LinearSOE;
 class EigenSOE;
@@ -65,6 +66,7 @@ class IncrementalIntegrator : public Integrator
 
     virtual void setEigenSOE(EigenSOE *theSOE);
 
+    virtual int domainChanged(void);
 
     // methods to set up the system of equations
     virtual int  formTangent(int statusFlag = CURRENT_TANGENT);    
@@ -76,6 +78,13 @@ class IncrementalIntegrator : public Integrator
     virtual int formEleResidual(FE_Element *theEle) =0;
     virtual int formNodUnbalance(DOF_Group *theDof) =0;    
 
+    // number of threads used to form the element contributions; only
+    // valid if each FE_Element returns its own tangent and residual. If
+    // the LinearSOE has scatter maps, the contributions are added color
+    // by color, the elements of a color concurrently
+    void setNumThreads(int numThreads);
+    int getNumThreads(void) const;
+
     // methods to update the domain
     virtual int newStep(double deltaT);
     virtual int update(const Vector &deltaU) =0;
@@ -107,6 +116,7 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    virtual int  formElementTangent(void);
     int statusFlag;
 
     //    Vector *modalDampingValues;
@@ -121,10 +131,19 @@ class IncrementalIntegrator : public Integrator
     Vector *tmpV2;
     
   private:
+    int formElementColors(void);
+    int lastColorOfStage(int color) const;
+
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
+    int numThreads;
 
+    // the FE_Elements in order of color, the elements of color c are 
+    // colorFEs[colorStart[c]] to colorFEs[colorStart[c+1]-1]; formed on
+    // first use after domainChanged()
+    std::vector<FE_Element *> colorFEs;
+    std::vector<int> colorStart;
 };
 
 #endif
@@ -0,0 +1,311 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/KrylovNewton.cpp,v $
+
+
+// Description: This file contains the implementation for KrylovNewton.
+//
+// With the factored tangent K, r(k) = K^-1 R(k) is the modified Newton
+// increment.  Av(i) = r(i) - r(i+1) approximates K^-1 K_t v(i) for the
+// increments v(i) taken, so the increment
+//
+//   v(k) = r(k) + sum_i c(i) [v(i) - Av(i)]
+//
+// with c minimizing | r(k) - sum_i c(i) Av(i) | removes the part of the
+// error in the subspace spanned by the previous increments.
+//
+// Reference: Carlson, N.N. and Miller, K. "Design and Application of a
+// Gradient-Weighted Moving Finite Element Code I: in One Dimension",
+// SIAM J. Sci. Comput., 19(3), 1998.
+//
+// What: "@(#)KrylovNewton.C, revA"
+
+#include <KrylovNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+#include <ID.h>
+#include <math.h>
+
+// Constructor
+KrylovNewton::KrylovNewton(int theTangentToUse, int n)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_KrylovNewton),
+ tangent(theTangentToUse), maxDim(n),
+ v(0), Av(0), Q(0), R(0), c(0), sizeStorage(0),
+ numIterations(0), numFactorizations(0)
+{
+  if (maxDim < 1)
+    maxDim = 1;
+}
+
+// Destructor
+KrylovNewton::~KrylovNewton()
+{
+  this->clearStorage();
+}
+
+void
+KrylovNewton::clearStorage(void)
+{
+  if (v != 0) {
+    for (int i=0; i<=maxDim; i++) {
+      if (v[i] != 0)
+	delete v[i];
+      if (Av[i] != 0)
+	delete Av[i];
+    }
+    delete [] v;
+    delete [] Av;
+  }
+  if (Q != 0) {
+    for (int i=0; i<maxDim; i++)
+      if (Q[i] != 0)
+	delete Q[i];
+    delete [] Q;
+  }
+  if (R != 0)
+    delete [] R;
+  if (c != 0)
+    delete [] c;
+
+  v = 0;
+  Av = 0;
+  Q = 0;
+  R = 0;
+  c = 0;
+  sizeStorage = 0;
+}
+
+int
+KrylovNewton::allocateStorage(int numEqn)
+{
+  if (v != 0 && sizeStorage == numEqn)
+    return 0;
+
+  this->clearStorage();
+
+  v  = new Vector *[maxDim+1];
+  Av = new Vector *[maxDim+1];
+  Q  = new Vector *[maxDim];
+  R  = new double[maxDim*maxDim];
+  c  = new double[maxDim];
+
+  for (int i=0; i<=maxDim; i++) {
+    v[i]  = new Vector(numEqn);
+    Av[i] = new Vector(numEqn);
+  }
+  for (int i=0; i<maxDim; i++)
+    Q[i] = new Vector(numEqn);
+
+  sizeStorage = numEqn;
+
+  return 0;
+}
+
+int
+KrylovNewton::leastSquares(int k, const Vector &r)
+{
+  // modified Gram-Schmidt QR of Av(0..k-1); dependent columns get c = 0
+  for (int j=0; j<k; j++) {
+    Vector &qj = *(Q[j]);
+    qj = *(Av[j]);
+    double norm0 = qj.Norm();
+
+    for (int i=0; i<j; i++) {
+      R[i*maxDim+j] = (*(Q[i]) ^ qj);
+      qj.addVector(1.0, *(Q[i]), -R[i*maxDim+j]);
+    }
+
+    double norm = qj.Norm();
+    if (norm <= 1.0e-12*norm0 || norm == 0.0) {
+      R[j*maxDim+j] = 0.0;
+      qj.Zero();
+    } else {
+      R[j*maxDim+j] = norm;
+      qj *= 1.0/norm;
+    }
+  }
+
+  // R c = Q^T r
+  for (int j=k-1; j>=0; j--) {
+    if (R[j*maxDim+j] == 0.0) {
+      c[j] = 0.0;
+      continue;
+    }
+    double sum = *(Q[j]) ^ r;
+    for (int i=j+1; i<k; i++)
+      sum -= R[j*maxDim+i]*c[i];
+    c[j] = sum/R[j*maxDim+j];
+  }
+
+  return 0;
+}
+
+int
+KrylovNewton::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING KrylovNewton::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    this->allocateStorage(theSOE->getNumEqn());
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	return -2;
+    }
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "KrylovNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    int result = -1;
+    numIterations = 0;
+
+    do {
+	// a Newton iteration with a freshly formed tangent
+	SOLUTION_ALGORITHM_tangentFlag = tangent;
+	if (theIntegrator->formTangent(tangent) < 0){
+	    opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formTangent()\n";
+	    return -1;
+	}
+	numFactorizations++;
+
+	int k = 0;
+
+	do {
+	    if (theSOE->solve() < 0) {
+		opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+		opserr << "the LinearSysOfEqn failed in solve()\n";
+		return -3;
+	    }
+
+	    const Vector &r = theSOE->getX();
+
+	    // Av(k-1) = r(k-1) - r(k), then accelerate
+	    Vector &vk = *(v[k]);
+	    vk = r;
+
+	    if (k > 0) {
+		*(Av[k-1]) -= r;
+		this->leastSquares(k, r);
+		for (int i=0; i<k; i++) {
+		    vk.addVector(1.0, *(v[i]), c[i]);
+		    vk.addVector(1.0, *(Av[i]), -c[i]);
+		}
+	    }
+
+	    *(Av[k]) = r;
+
+	    if (theIntegrator->update(vk) < 0) {
+		opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+		opserr << "the Integrator failed in update()\n";
+		return -4;
+	    }
+
+	    if (theIntegrator->formUnbalance() < 0) {
+		opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+		opserr << "the Integrator failed in formUnbalance()\n";
+		return -2;
+	    }
+
+	    result = theTest->test();
+	    numIterations++;
+	    this->record(numIterations);
+
+	    k++;
+
+	} while (result == -1 && k <= maxDim);
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "KrylovNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+int
+KrylovNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static ID data(2);
+  data(0) = tangent;
+  data(1) = maxDim;
+  return theChannel.sendID(this->getDbTag(), cTag, data);
+}
+
+int
+KrylovNewton::recvSelf(int cTag,
+		       Channel &theChannel,
+		       FEM_ObjectBroker &theBroker)
+{
+  static ID data(2);
+  theChannel.recvID(this->getDbTag(), cTag, data);
+  this->clearStorage();
+  tangent = data(0);
+  maxDim = data(1);
+  return 0;
+}
+
+void
+KrylovNewton::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "KrylovNewton -maxDim " << maxDim << endln;
+  }
+}
+
+int
+KrylovNewton::getNumIterations(void)
+{
+  return numIterations;
+}
+
+int
+KrylovNewton::getNumFactorizations(void)
+{
+  return numFactorizations;
+}
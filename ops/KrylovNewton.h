@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/KrylovNewton.h,v $
+
+
+#ifndef KrylovNewton_h
+#define KrylovNewton_h
+
+// Description: This file contains the class definition for KrylovNewton.
+// KrylovNewton forms and factors the tangent at the start of a step and
+// accelerates the modified Newton iterations that follow with the Krylov
+// subspace method of Carlson and Miller: each new increment is corrected
+// by a least squares combination of up to maxDim previous increments.
+// Each iteration costs one back substitution.  After maxDim accelerated
+// iterations the tangent is formed again.
+//
+// What: "@(#)KrylovNewton.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class Vector;
+
+class KrylovNewton: public EquiSolnAlgo
+{
+  public:
+    KrylovNewton(int tangent = CURRENT_TANGENT, int maxDim = 3);
+    ~KrylovNewton();
+
+    int solveCurrentStep(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    void clearStorage(void);
+    int  allocateStorage(int numEqn);
+    int  leastSquares(int k, const Vector &r);
+
+    int tangent;
+    int maxDim;
+
+    Vector **v;        // increments of the subspace
+    Vector **Av;       // corresponding changes of the solved unbalance
+    Vector **Q;        // orthonormal basis of the Av (least squares)
+    double  *R;        // triangular factor of the Av, maxDim x maxDim
+    double  *c;        // least squares coefficients
+    int      sizeStorage;
+
+    int numIterations;
+    int numFactorizations;
+};
+
+#endif
@@ -0,0 +1,149 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/LineSearch.cpp,v $
+
+
+// Description: This file contains the implementation for LineSearch.
+//
+// What: "@(#)LineSearch.C, revA"
+
+#include <LineSearch.h>
+#include <LinearSOE.h>
+#include <IncrementalIntegrator.h>
+#include <Vector.h>
+#include <Channel.h>
+#include <math.h>
+
+LineSearch::LineSearch(int clsTag, double tol, int mIter,
+		       double mnEta, double mxEta, int pFlag)
+:MovableObject(clsTag),
+ tolerance(tol), maxIter(mIter), minEta(mnEta), maxEta(mxEta), printFlag(pFlag),
+ eta(1.0), error(0),
+ theSOE(0), theIntegrator(0), dU(0), x(0), numSearches(0)
+{
+
+}
+
+LineSearch::~LineSearch()
+{
+  if (dU != 0)
+    delete dU;
+  if (x != 0)
+    delete x;
+}
+
+int
+LineSearch::search(double s0, double s1,
+		   LinearSOE &theLinSOE,
+		   IncrementalIntegrator &theIncrIntegrator)
+{
+  // the full step is acceptable
+  if (s0 == 0.0 || fabs(s1) <= tolerance*fabs(s0))
+    return 0;
+
+  theSOE = &theLinSOE;
+  theIntegrator = &theIncrIntegrator;
+
+  // X is overwritten by every update() -- keep the increment
+  const Vector &theX = theSOE->getX();
+  if (dU == 0 || dU->Size() != theX.Size()) {
+    if (dU != 0)
+      delete dU;
+    if (x != 0)
+      delete x;
+    dU = new Vector(theX.Size());
+    x  = new Vector(theX.Size());
+  }
+  *dU = theX;
+
+  eta = 1.0;
+  error = 0;
+  numSearches++;
+
+  int result = this->findEta(s0, s1);
+
+  if (printFlag != 0) {
+    opserr << "LineSearch::search() - eta: " << eta;
+    opserr << " r: " << fabs(s1/s0) << endln;
+  }
+
+  // the increment actually taken
+  x->addVector(0.0, *dU, eta);
+  theSOE->setX(*x);
+
+  if (error != 0)
+    return -1;
+
+  return result;
+}
+
+double
+LineSearch::moveTo(double newEta)
+{
+  x->addVector(0.0, *dU, newEta - eta);
+
+  // a trial is not an iteration: an integrator that sizes the steps by the
+  // iterations takes them from the convergence test (AdaptiveLoadControl)
+  if (theIntegrator->update(*x) < 0) {
+    opserr << "WARNING LineSearch::moveTo() -";
+    opserr << "the Integrator failed in update()\n";
+    error = -1;
+  }
+
+  if (theIntegrator->formUnbalance() < 0) {
+    opserr << "WARNING LineSearch::moveTo() -";
+    opserr << "the Integrator failed in formUnbalance()\n";
+    error = -2;
+  }
+
+  eta = newEta;
+
+  return (*dU) ^ theSOE->getB();
+}
+
+int
+LineSearch::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector data(5);
+  data(0) = tolerance;
+  data(1) = maxIter;
+  data(2) = minEta;
+  data(3) = maxEta;
+  data(4) = printFlag;
+  return theChannel.sendVector(this->getDbTag(), cTag, data);
+}
+
+int
+LineSearch::recvSelf(int cTag,
+		     Channel &theChannel,
+		     FEM_ObjectBroker &theBroker)
+{
+  static Vector data(5);
+  theChannel.recvVector(this->getDbTag(), cTag, data);
+  tolerance = data(0);
+  maxIter = int(data(1));
+  minEta = data(2);
+  maxEta = data(3);
+  printFlag = int(data(4));
+  return 0;
+}
@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/LineSearch.h,v $
+
+
+#ifndef LineSearch_h
+#define LineSearch_h
+
+// Description: This file contains the class definition for LineSearch.
+// LineSearch is an abstract base class for scaling the increment dU of a
+// Newton iteration by a factor eta such that the unbalance R along the
+// increment becomes (nearly) orthogonal to it:
+//
+//   s(eta) = dU^T R(U + eta dU),   |s(eta)| <= tolerance |s(0)|
+//
+// The algorithm has already formed R(U) and R(U + dU), so search() is
+// given s(0) and s(1) and costs nothing if the full step is acceptable.
+// Otherwise the subclass tries other values of eta within [minEta, maxEta];
+// each trial is one update() and formUnbalance() of the integrator.  On
+// return the domain is at U + eta dU and the X of the LinearSOE holds
+// eta dU, the increment actually taken.
+//
+// What: "@(#)LineSearch.h, revA"
+
+#include <MovableObject.h>
+#include <OPS_Globals.h>
+
+class LinearSOE;
+class IncrementalIntegrator;
+class Vector;
+
+class LineSearch: public MovableObject
+{
+  public:
+    LineSearch(int classTag, double tolerance = 0.8, int maxIter = 10,
+	       double minEta = 0.1, double maxEta = 10.0, int printFlag = 0);
+    virtual ~LineSearch();
+
+    virtual int search(double s0, double s1,
+		       LinearSOE &theSOE,
+		       IncrementalIntegrator &theIntegrator);
+
+    int getNumSearches(void) {return numSearches;}
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+
+    virtual void Print(OPS_Stream &s, int flag =0) =0;
+
+  protected:
+    // determine eta, given s(0) and s(1) -- the domain is at eta = 1
+    virtual int findEta(double s0, double s1) =0;
+
+    // moves the domain to U + eta dU and returns s(eta)
+    double moveTo(double eta);
+
+    double tolerance;
+    int    maxIter;
+    double minEta;
+    double maxEta;
+    int    printFlag;
+
+    double eta;           // current position along dU
+    int    error;         // set if moveTo() failed
+
+  private:
+    LinearSOE             *theSOE;
+    IncrementalIntegrator *theIntegrator;
+    Vector *dU;
+    Vector *x;
+    int     numSearches;
+};
+
+#endif
@@ -39,6 +39,7 @@
 #include <CrdTransf.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <FixedMatrix.h>
 
 class LinearCrdTransf3d: public CrdTransf
 {
@@ -94,6 +95,7 @@ public:
 private:
     int computeElemtLengthAndOrient(void);
     void compTransfMatrixLocalGlobal(Matrix &Tlg);
+    const Matrix &formGlobalMatrixFromLocal(double kl[][12]);
     
     // internal data
     Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
@@ -103,8 +105,8 @@ private:
     double R[3][3];	 // rotation matrix
     double L;        // undeformed element length
 
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
+    static thread_local FixedMatrix<12,12> Tlg;  // matrix that transforms from global to local coordinates
+    static thread_local FixedMatrix<12,12> kg;   // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
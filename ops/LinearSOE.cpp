@@ -33,14 +33,18 @@
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
 
+// the stamps are unique within the thread that owns the SOE and its model
+static thread_local int lastStorageStamp = 0;
+
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
-    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
+    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver),
+     storageStamp(0)
 {
 
 }
 
 LinearSOE::LinearSOE(int classtag)
-:MovableObject(classtag), theModel(0), theSolver(0)
+:MovableObject(classtag), theModel(0), theSolver(0), storageStamp(0)
 {
 
 }
@@ -108,3 +112,25 @@ int
 LinearSOE::addColA(const Vector &col, int colIndex, double fact) {
   return -1;
 }
+
+int
+LinearSOE::formScatterMap(const ID &id, ID &map) {
+  return -1;
+}
+
+int
+LinearSOE::addAScatter(const Matrix &, const ID &map, double fact) {
+  return -1;
+}
+
+int
+LinearSOE::getStorageStamp(void) const
+{
+    return storageStamp;
+}
+
+void
+LinearSOE::newStorageStamp(void)
+{
+    storageStamp = ++lastStorageStamp;
+}
@@ -69,6 +69,15 @@ class LinearSOE : public MovableObject
     virtual int addA(const Matrix &);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
 
+    // scatter maps: the location in the storage of A of every entry of
+    // a matrix assembled with a given ID, formed once and valid while
+    // getStorageStamp() is unchanged. The default has none (returns -1).
+    // An SOE with scatter maps has fixed storage: addAScatter() and addB()
+    // may be invoked concurrently for IDs without common equations.
+    virtual int formScatterMap(const ID &id, ID &map);
+    virtual int addAScatter(const Matrix &, const ID &map, double fact = 1.0);
+    int getStorageStamp(void) const;
+
     virtual void zeroA(void) =0;
     virtual void zeroB(void) =0;
 
@@ -87,10 +96,12 @@ class LinearSOE : public MovableObject
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
+    void newStorageStamp(void);  // to be called when the storage of A changes
     AnalysisModel* theModel;
     
   private:
     LinearSOESolver *theSolver;    
+    int storageStamp;            // 0 until the first newStorageStamp()
 };
 
 
@@ -42,8 +42,8 @@
 #include <elementAPI.h>
 #include <Domain.h>
 
-static int numMPs = 0;
-static int nextTag = 0;
+static thread_local int numMPs = 0;
+static thread_local int nextTag = 0;
 
 int OPS_EqualDOF()
 {
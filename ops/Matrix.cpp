@@ -34,12 +34,14 @@
 #include "Matrix.h"
 #include "Vector.h"
 #include "ID.h"
+#include "MatrixUtil.h"
 
 #include <stdlib.h>
 #include <iostream>
+#include <utility>
 using std::nothrow;
 
-#define MATRIX_WORK_AREA 400
+#define MATRIX_WORK_AREA 1200
 #define INT_WORK_AREA 20
 
 #ifdef _WIN32
@@ -50,11 +52,12 @@ using std::nothrow;
 
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
+// the work areas are per thread, allocated by the first matrix a thread creates
+thread_local int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
+thread_local int Matrix::sizeIntWork = INT_WORK_AREA;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
+thread_local double *Matrix::matrixWork = 0;
+thread_local int    *Matrix::intWork =0;
 
 //double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
 
@@ -186,6 +189,40 @@ Matrix::Matrix(const Matrix &other)
 }
 
 
+// Matrix(Matrix &&):
+//	constructor to take over the data of a temporary matrix, which is
+//	left empty. The data of a matrix that does not own it, one created
+//	with Matrix(double *, int, int), is copied instead.
+
+Matrix::Matrix(Matrix &&other)
+:numRows(other.numRows), numCols(other.numCols), dataSize(other.dataSize), 
+ data(other.data), fromFree(0)
+{
+  if (other.fromFree == 0) {
+    other.numRows = 0;
+    other.numCols = 0;
+    other.dataSize = 0;
+    other.data = 0;
+    return;
+  }
+
+  data = 0;
+  if (dataSize != 0) {
+    data = new (nothrow) double[dataSize];
+    if (data == 0) {
+      opserr << "WARNING:Matrix::Matrix(Matrix &&): ";
+      opserr << "Ran out of memory on init of size " << dataSize << endln; 
+      numRows = 0; numCols =0; dataSize = 0;
+    } else {
+      double *dataPtr = data;
+      double *otherDataPtr = other.data;
+      for (int i=0; i<dataSize; i++)
+	*dataPtr++ = *otherDataPtr++;
+    }
+  }
+}
+
+
 //
 // DESTRUCTOR
 //
@@ -374,7 +411,7 @@ Matrix::Solve(const Vector &b, Vector &x) const
 #endif
     
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
+    if (dataSize > sizeDoubleWork || matrixWork == 0) {
 
       if (matrixWork != 0) {
 	delete [] matrixWork;
@@ -390,7 +427,7 @@ Matrix::Solve(const Vector &b, Vector &x) const
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
+    if (n > sizeIntWork || intWork == 0) {
 
       if (intWork != 0) {
 	delete [] intWork;
@@ -469,7 +506,7 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
+    if (dataSize > sizeDoubleWork || matrixWork == 0) {
 
       if (matrixWork != 0) {
 	delete [] matrixWork;
@@ -485,7 +522,7 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
+    if (n > sizeIntWork || intWork == 0) {
 
       if (intWork != 0) {
 	delete [] intWork;
@@ -568,7 +605,7 @@ Matrix::Invert(Matrix &theInverse) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
+    if (dataSize > sizeDoubleWork || matrixWork == 0) {
 
       if (matrixWork != 0) {
 	delete [] matrixWork;
@@ -584,7 +621,7 @@ Matrix::Invert(Matrix &theInverse) const
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
+    if (n > sizeIntWork || intWork == 0) {
 
       if (intWork != 0) {
 	delete [] intWork;
@@ -805,62 +842,19 @@ Matrix::addMatrixProduct(double thisFact,
       return -1;
     }
 #endif
-    // NOTE: looping as per blas3 dgemm_: j,k,i
-    if (thisFact == 1.0) {
-
-      // want: this += B * C  otherFact
-      int numColB = B.numCols;
-      double *ckjPtr  = &(C.data)[0];
-      for (int j=0; j<numCols; j++) {
-	double *aijPtrA = &data[j*numRows];
-	for (int k=0; k<numColB; k++) {
-	  double tmp = *ckjPtr++ * otherFact;
-	  double *aijPtr = aijPtrA;
-	  double *bikPtr = &(B.data)[k*numRows];
-	  for (int i=0; i<numRows; i++)
-	    *aijPtr++ += *bikPtr++ * tmp;
-	}
-      }
-    }
-
-    else if (thisFact == 0.0) {
-
-      // want: this = B * C  otherFact
+    // want: this = this * thisFact + B * C  otherFact
+    if (thisFact == 0.0) {
       double *dataPtr = data;
       for (int i=0; i<dataSize; i++)
 	  *dataPtr++ = 0.0;
-      int numColB = B.numCols;
-      double *ckjPtr  = &(C.data)[0];
-      for (int j=0; j<numCols; j++) {
-	double *aijPtrA = &data[j*numRows];
-	for (int k=0; k<numColB; k++) {
-	  double tmp = *ckjPtr++ * otherFact;
-	  double *aijPtr = aijPtrA;
-	  double *bikPtr = &(B.data)[k*numRows];
-	  for (int i=0; i<numRows; i++)
-	    *aijPtr++ += *bikPtr++ * tmp;
-	}
-      }
-    } 
-
-    else {
-      // want: this = B * C  otherFact
+    } else if (thisFact != 1.0) {
       double *dataPtr = data;
       for (int i=0; i<dataSize; i++)
 	  *dataPtr++ *= thisFact;
-      int numColB = B.numCols;
-      double *ckjPtr  = &(C.data)[0];
-      for (int j=0; j<numCols; j++) {
-	double *aijPtrA = &data[j*numRows];
-	for (int k=0; k<numColB; k++) {
-	  double tmp = *ckjPtr++ * otherFact;
-	  double *aijPtr = aijPtrA;
-	  double *bikPtr = &(B.data)[k*numRows];
-	  for (int i=0; i<numRows; i++)
-	    *aijPtr++ += *bikPtr++ * tmp;
-	}
-      }
-    } 
+    }
+
+    // NOTE: looping as per blas3 dgemm_: j,k,i
+    denseMultAdd(numRows, numCols, B.numCols, B.data, C.data, data, otherFact);
 
     return 0;
 }
@@ -881,8 +875,35 @@ Matrix::addMatrixTransposeProduct(double thisFact,
   }
 #endif
 
+  int numMults = C.numRows;
+
+  // if the work area can hold B' and B' * C, form them there; the sums
+  // are then accumulated column by column in the same order as below
+  if (matrixWork != 0 && numRows*numMults + dataSize <= sizeDoubleWork) {
+    double *btPtr = matrixWork;
+    double *sumPtr = &matrixWork[numRows*numMults];
+    for (int k=0; k<numMults; k++)
+      for (int i=0; i<numRows; i++)
+	btPtr[k*numRows + i] = B.data[i*numMults + k];
+    for (int l=0; l<dataSize; l++)
+      sumPtr[l] = 0.0;
+
+    denseMultAdd(numRows, numCols, numMults, btPtr, C.data, sumPtr, 1.0);
+
+    if (thisFact == 1.0) {
+      for (int l=0; l<dataSize; l++)
+	data[l] += sumPtr[l] * otherFact;
+    } else if (thisFact == 0.0) {
+      for (int l=0; l<dataSize; l++)
+	data[l] = sumPtr[l] * otherFact;
+    } else {
+      for (int l=0; l<dataSize; l++)
+	data[l] = data[l] * thisFact + sumPtr[l] * otherFact;
+    }
+    return 0;
+  }
+
   if (thisFact == 1.0) {
-    int numMults = C.numRows;
     double *aijPtr = data;
     for (int j=0; j<numCols; j++) {
       for (int i=0; i<numRows; i++) {
@@ -896,7 +917,6 @@ Matrix::addMatrixTransposeProduct(double thisFact,
       }
     } 
   } else if (thisFact == 0.0) {
-    int numMults = C.numRows;
     double *aijPtr = data;
     for (int j=0; j<numCols; j++) {
       for (int i=0; i<numRows; i++) {
@@ -910,7 +930,6 @@ Matrix::addMatrixTransposeProduct(double thisFact,
       }
     } 
   } else {
-    int numMults = C.numRows;
     double *aijPtr = data;
     for (int j=0; j<numCols; j++) {
       for (int i=0; i<numRows; i++) {
@@ -930,6 +949,35 @@ Matrix::addMatrixTransposeProduct(double thisFact,
 }
 
 
+// to perform this = this * thisFact + A' * W, where A (dimA x numRows) is
+// given by its data and W (dimA x numCols) is at the start of matrixWork;
+// A' and A' * W are formed in the work area after the first sizeWork
+void
+Matrix::addTransposeWorkProduct(double thisFact, const double *A, int dimA, int sizeWork)
+{
+    double *atPtr = &matrixWork[sizeWork];
+    double *sumPtr = &matrixWork[sizeWork + numRows*dimA];
+    for (int k=0; k<dimA; k++)
+      for (int i=0; i<numRows; i++)
+	atPtr[k*numRows + i] = A[i*dimA + k];
+    for (int l=0; l<dataSize; l++)
+      sumPtr[l] = 0.0;
+
+    denseMultAdd(numRows, numCols, dimA, atPtr, matrixWork, sumPtr, 1.0);
+
+    if (thisFact == 1.0) {
+      for (int l=0; l<dataSize; l++)
+	data[l] += sumPtr[l];
+    } else if (thisFact == 0.0) {
+      for (int l=0; l<dataSize; l++)
+	data[l] = sumPtr[l];
+    } else {
+      for (int l=0; l<dataSize; l++)
+	data[l] = data[l] * thisFact + sumPtr[l];
+    }
+}
+
+
 // to perform this += T' * B * T
 int
 Matrix::addMatrixTripleProduct(double thisFact, 
@@ -947,6 +995,16 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 #endif
 
+    // allocate the work areas if this thread has not created a matrix yet
+    if (matrixWork == 0) {
+      matrixWork = new (nothrow) double[sizeDoubleWork];
+      intWork = new (nothrow) int[sizeIntWork];
+      if (matrixWork == 0 || intWork == 0) {
+	opserr << "WARNING: Matrix::addMatrixTripleProduct() - out of memory creating work area's\n";
+	exit(-1);
+      }
+    }
+
     // cheack work area can hold the temporary matrix
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
@@ -963,17 +1021,13 @@ Matrix::addMatrixTripleProduct(double thisFact,
     
     // now form B * T * fact store in matrixWork == A area
     // NOTE: looping as per blas3 dgemm_: j,k,i
+    denseMultAdd(dimB, numCols, dimB, B.data, T.data, matrixWork, otherFact);
 
-    double *tkjPtr  = &(T.data)[0];
-    for (int j=0; j<numCols; j++) {
-      double *aijPtrA = &matrixWork[j*dimB];
-      for (int k=0; k<dimB; k++) {
-	double tmp = *tkjPtr++ * otherFact;
-	double *aijPtr = aijPtrA;
-	double *bikPtr = &(B.data)[k*dimB];
-	for (int i=0; i<dimB; i++) 
-	  *aijPtr++ += *bikPtr++ * tmp;
-      }
+    // if the work area can also hold T' and T' * matrixWork, form them
+    // after it; the sums are accumulated in the same order as below
+    if (sizeWork + numRows*dimB + dataSize <= sizeDoubleWork) {
+      addTransposeWorkProduct(thisFact, T.data, dimB, sizeWork);
+      return 0;
     }
 
     // now form T' * matrixWork
@@ -1046,6 +1100,16 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 #endif
 
+    // allocate the work areas if this thread has not created a matrix yet
+    if (matrixWork == 0) {
+      matrixWork = new (nothrow) double[sizeDoubleWork];
+      intWork = new (nothrow) int[sizeIntWork];
+      if (matrixWork == 0 || intWork == 0) {
+	opserr << "WARNING: Matrix::addMatrixTripleProduct() - out of memory creating work area's\n";
+	exit(-1);
+      }
+    }
+
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
@@ -1061,23 +1125,19 @@ Matrix::addMatrixTripleProduct(double thisFact,
 
     // now form B * C * fact store in matrixWork == A area
     // NOTE: looping as per blas3 dgemm_: j,k,i
-    
     int rowsB = B.numRows;
-    double *ckjPtr  = &(C.data)[0];
-    for (int j=0; j<numCols; j++) {
-      double *aijPtrA = &matrixWork[j*rowsB];
-      for (int k=0; k<rowsB; k++) {
-	double tmp = *ckjPtr++ * otherFact;
-	double *aijPtr = aijPtrA;
-	double *bikPtr = &(B.data)[k*rowsB];
-	for (int i=0; i<rowsB; i++) 
-	  *aijPtr++ += *bikPtr++ * tmp;
-      }
+    denseMultAdd(rowsB, numCols, rowsB, B.data, C.data, matrixWork, otherFact);
+
+    // if the work area can also hold A' and A' * matrixWork, form them
+    // after it; the sums are accumulated in the same order as below
+    int dimB = rowsB;
+    if (sizeWork + numRows*dimB + dataSize <= sizeDoubleWork) {
+      addTransposeWorkProduct(thisFact, A.data, dimB, sizeWork);
+      return 0;
     }
 
     // now form A' * matrixWork
     // NOTE: looping as per blas3 dgemm_: j,i,k
-    int dimB = rowsB;
     if (thisFact == 1.0) {
       double *dataPtr = &data[0];
       for (int j=0; j< numCols; j++) {
@@ -1198,6 +1258,36 @@ Matrix::operator=(const Matrix &other)
 }
 
 
+// Matrix &operator=(Matrix &&other):
+//	the move assignment operator, this takes over the data of other,
+//	which is left empty. If either matrix does not own its data the data
+//	is copied as in operator=(const Matrix &).
+
+Matrix &
+Matrix::operator=(Matrix &&other)
+{
+  if (fromFree != 0 || other.fromFree != 0)
+    return *this = static_cast<const Matrix &>(other);
+
+  if (this != &other) {
+    if (data != 0)
+      delete [] data;
+
+    numRows = other.numRows;
+    numCols = other.numCols;
+    dataSize = other.dataSize;
+    data = other.data;
+
+    other.numRows = 0;
+    other.numCols = 0;
+    other.dataSize = 0;
+    other.data = 0;
+  }
+
+  return *this;
+}
+
+
 
 
 // virtual Matrix &operator+=(double fact);
@@ -1289,7 +1379,7 @@ Matrix::operator/=(double fact)
 //	The above methods all return a new full general matrix.
 
 Matrix
-Matrix::operator+(double fact) const
+Matrix::operator+(double fact) const &
 {
     Matrix result(*this);
     result += fact;
@@ -1297,7 +1387,7 @@ Matrix::operator+(double fact) const
 }
 
 Matrix
-Matrix::operator-(double fact) const
+Matrix::operator-(double fact) const &
 {
     Matrix result(*this);
     result -= fact;
@@ -1305,7 +1395,7 @@ Matrix::operator-(double fact) const
 }
 
 Matrix
-Matrix::operator*(double fact) const
+Matrix::operator*(double fact) const &
 {
     Matrix result(*this);
     result *= fact;
@@ -1313,7 +1403,7 @@ Matrix::operator*(double fact) const
 }
 
 Matrix
-Matrix::operator/(double fact) const
+Matrix::operator/(double fact) const &
 {
     if (fact == 0.0) {
 	opserr << "Matrix::operator/(const double &fact): ERROR divide-by-zero\n";
@@ -1324,6 +1414,48 @@ Matrix::operator/(double fact) const
     return result;
 }
 
+//    Matrix operator+(double fact) &&;
+//    Matrix operator-(double fact) &&;
+//    Matrix operator*(double fact) &&;
+//    Matrix operator/(double fact) &&;
+//	As above, but the result is formed in the data of the temporary.
+
+Matrix
+Matrix::operator+(double fact) &&
+{
+    Matrix result(std::move(*this));
+    result += fact;
+    return result;
+}
+
+Matrix
+Matrix::operator-(double fact) &&
+{
+    Matrix result(std::move(*this));
+    result -= fact;
+    return result;
+}
+
+Matrix
+Matrix::operator*(double fact) &&
+{
+    Matrix result(std::move(*this));
+    result *= fact;
+    return result;
+}
+
+Matrix
+Matrix::operator/(double fact) &&
+{
+    if (fact == 0.0) {
+	opserr << "Matrix::operator/(const double &fact): ERROR divide-by-zero\n";
+	exit(0);
+    }
+    Matrix result(std::move(*this));
+    result /= fact;
+    return result;
+}
+
 
 //
 // MATRIX_VECTOR OPERATIONS
@@ -1387,7 +1519,7 @@ Matrix::operator^(const Vector &V) const
 	    
 
 Matrix
-Matrix::operator+(const Matrix &M) const
+Matrix::operator+(const Matrix &M) const &
 {
     Matrix result(*this);
     result.addMatrix(1.0,M,1.0);    
@@ -1395,12 +1527,64 @@ Matrix::operator+(const Matrix &M) const
 }
 	    
 Matrix
-Matrix::operator-(const Matrix &M) const
+Matrix::operator-(const Matrix &M) const &
 {
     Matrix result(*this);
     result.addMatrix(1.0,M,-1.0);    
     return result;
 }
+
+//    Matrix operator+(const Matrix &M) &&;
+//    Matrix operator-(const Matrix &M) &&;
+//    Matrix operator+(Matrix &&M) const &;
+//    Matrix operator-(Matrix &&M) const &;
+//    Matrix operator+(Matrix &&M) &&;
+//    Matrix operator-(Matrix &&M) &&;
+//	As above, but the result is formed in the data of a temporary operand.
+
+Matrix
+Matrix::operator+(const Matrix &M) &&
+{
+    Matrix result(std::move(*this));
+    result.addMatrix(1.0,M,1.0);    
+    return result;
+}
+
+Matrix
+Matrix::operator-(const Matrix &M) &&
+{
+    Matrix result(std::move(*this));
+    result.addMatrix(1.0,M,-1.0);    
+    return result;
+}
+
+Matrix
+Matrix::operator+(Matrix &&M) const &
+{
+    Matrix result(std::move(M));
+    result.addMatrix(1.0,*this,1.0);    
+    return result;
+}
+
+Matrix
+Matrix::operator-(Matrix &&M) const &
+{
+    Matrix result(std::move(M));
+    result.addMatrix(-1.0,*this,1.0);    
+    return result;
+}
+
+Matrix
+Matrix::operator+(Matrix &&M) &&
+{
+    return std::move(*this) + static_cast<const Matrix &>(M);
+}
+
+Matrix
+Matrix::operator-(Matrix &&M) &&
+{
+    return std::move(*this) - static_cast<const Matrix &>(M);
+}
 	    
     
 Matrix
@@ -1748,6 +1932,11 @@ Matrix operator*(double a, const Matrix &V)
   return V * a;
 }
 
+Matrix operator*(double a, Matrix &&V)
+{
+  return std::move(V) * a;
+}
+
 
 
 
@@ -1780,11 +1969,11 @@ Matrix::Eigen3(const Matrix &M)
   int     rot, its, i, j , k ;
   double  g, h, aij, sm, thresh, t, c, s, tau ;
 
-  static Matrix  v(3,3) ;
-  static Vector  d(3) ;
-  static Vector  a(3) ;
-  static Vector  b(3) ; 
-  static Vector  z(3) ;
+  static thread_local Matrix  v(3,3) ;
+  static thread_local Vector  d(3) ;
+  static thread_local Vector  a(3) ;
+  static thread_local Vector  b(3) ; 
+  static thread_local Vector  z(3) ;
 
   static const double tol = 1.0e-08 ;
 
@@ -1904,7 +2093,7 @@ Matrix::Eigen3(const Matrix &M)
     sm = fabs(a(0)) + fabs(a(1)) + fabs(a(2)) ;
 
   } //end while sm
-  static Vector  dd(3) ;
+  static thread_local Vector  dd(3) ;
   if (d(0)>d(1))
     {
       if (d(0)>d(2))
@@ -53,6 +53,7 @@ class Matrix
     Matrix(int nrows, int ncols);
     Matrix(double *data, int nrows, int ncols);    
     Matrix(const Matrix &M);    
+    Matrix(Matrix &&M);
     ~Matrix();
 
     // utility methods
@@ -82,6 +83,7 @@ class Matrix
     Matrix operator()(const ID &rows, const ID & cols) const;
     
     Matrix &operator=(const Matrix &M);
+    Matrix &operator=(Matrix &&M);
     
     // matrix operations which will preserve the derived type and
     // which can be implemented efficiently without many constructor calls.
@@ -96,11 +98,16 @@ class Matrix
     // most efficient to use, as constructors must be called twice. They
     // however are usefull for matlab like expressions involving Matrices.
 
-    // matrix-scalar operations
-    Matrix operator+(double fact) const;
-    Matrix operator-(double fact) const;
-    Matrix operator*(double fact) const;
-    Matrix operator/(double fact) const;
+    // matrix-scalar operations, the && versions work in the storage
+    // of a temporary operand instead of allocating a new Matrix
+    Matrix operator+(double fact) const &;
+    Matrix operator-(double fact) const &;
+    Matrix operator*(double fact) const &;
+    Matrix operator/(double fact) const &;
+    Matrix operator+(double fact) &&;
+    Matrix operator-(double fact) &&;
+    Matrix operator*(double fact) &&;
+    Matrix operator/(double fact) &&;
     
     // matrix-vector operations
     Vector operator*(const Vector &V) const;
@@ -108,8 +115,14 @@ class Matrix
 
     
     // matrix-matrix operations
-    Matrix operator+(const Matrix &M) const;
-    Matrix operator-(const Matrix &M) const;
+    Matrix operator+(const Matrix &M) const &;
+    Matrix operator-(const Matrix &M) const &;
+    Matrix operator+(const Matrix &M) &&;
+    Matrix operator-(const Matrix &M) &&;
+    Matrix operator+(Matrix &&M) const &;
+    Matrix operator-(Matrix &&M) const &;
+    Matrix operator+(Matrix &&M) &&;
+    Matrix operator-(Matrix &&M) &&;
     Matrix operator*(const Matrix &M) const;
 //     Matrix operator/(const Matrix &M) const;    
     Matrix operator^(const Matrix &M) const;
@@ -132,6 +145,7 @@ class Matrix
     friend OPS_Stream &operator<<(OPS_Stream &s, const Matrix &M);
     //    friend istream &operator>>(istream &s, Matrix &M);    
     friend Matrix operator*(double a, const Matrix &M);
+    friend Matrix operator*(double a, Matrix &&M);
     
     
     friend class Vector;    
@@ -147,11 +161,13 @@ class Matrix
   protected:
 
   private:
+    void addTransposeWorkProduct(double thisFact, const double *A, int dimA, int sizeWork);
+
     static double MATRIX_NOT_VALID_ENTRY;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    static thread_local double *matrixWork;
+    static thread_local int *intWork;
+    static thread_local int sizeDoubleWork;
+    static thread_local int sizeIntWork;
 
     int numRows;
     int numCols;
@@ -25,9 +25,36 @@
 #include <math.h>
                                                                         
 #include <stdlib.h>
+#include <string.h>
 #include <Vector.h>
 #include <MatrixUtil.h>
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define _DENSE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#if defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1910)
+#define _DENSE_AVX512
+#endif
+#endif
+
+// every path must round as the plain C++ one, so multiply-adds are not
+// contracted into fma instructions; gcc and clang also need the
+// instruction set enabled function by function
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#define DENSE_NO_FMA
+#define DENSE_TARGET(isa) __attribute__((target(isa)))
+#elif defined(__GNUC__)
+#define DENSE_NO_FMA __attribute__((optimize("fp-contract=off")))
+#define DENSE_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+#else
+#define DENSE_NO_FMA
+#define DENSE_TARGET(isa)
+#endif
+
 
 double invert2by2Matrix(const Matrix &a, Matrix &b)
 {
@@ -162,5 +189,273 @@ void getCBDIinfluenceMatrix(int nIntegrPts, double *pts, double L, Matrix &ls)
 
 
 
+//
+// DENSE KERNELS
+//
+// Each path updates an element of the result with the same sequence of
+// multiplies and adds as the plain C++ one: the products are formed
+// column by column (looping as per blas3 dgemm_: j,k,i) and vectorized
+// over the rows.  The results therefore do not depend on the cpu.
+
+static DENSE_NO_FMA void
+axpyCpp(int n, double a, const double *x, double *y)
+{
+  for (int i=0; i<n; i++)
+    y[i] += x[i] * a;
+}
+
+static DENSE_NO_FMA void
+multAddCpp(int m, int n, int l, const double *A, const double *B, double *C, double fact)
+{
+  for (int j=0; j<n; j++) {
+    const double *bPtr = B + j*l;
+    for (int k=0; k<l; k++)
+      axpyCpp(m, bPtr[k] * fact, A + k*m, C + j*m);
+  }
+}
+
+#ifdef _DENSE_X86
+
+static DENSE_TARGET("sse2") void
+axpySSE2(int n, double a, const double *x, double *y)
+{
+  __m128d va = _mm_set1_pd(a);
+  int i = 0;
+  for ( ; i+2 <= n; i += 2)
+    _mm_storeu_pd(y+i, _mm_add_pd(_mm_loadu_pd(y+i), _mm_mul_pd(_mm_loadu_pd(x+i), va)));
+  for ( ; i < n; i++)
+    y[i] += x[i] * a;
+}
+
+static DENSE_TARGET("sse2") void
+multAddSSE2(int m, int n, int l, const double *A, const double *B, double *C, double fact)
+{
+  for (int j=0; j<n; j++) {
+    const double *bPtr = B + j*l;
+    for (int k=0; k<l; k++)
+      axpySSE2(m, bPtr[k] * fact, A + k*m, C + j*m);
+  }
+}
+
+static DENSE_TARGET("avx") void
+axpyAVX(int n, double a, const double *x, double *y)
+{
+  __m256d va = _mm256_set1_pd(a);
+  int i = 0;
+  for ( ; i+4 <= n; i += 4)
+    _mm256_storeu_pd(y+i, _mm256_add_pd(_mm256_loadu_pd(y+i), _mm256_mul_pd(_mm256_loadu_pd(x+i), va)));
+  for ( ; i < n; i++)
+    y[i] += x[i] * a;
+}
+
+static DENSE_TARGET("avx") void
+multAddAVX(int m, int n, int l, const double *A, const double *B, double *C, double fact)
+{
+  for (int j=0; j<n; j++) {
+    const double *bPtr = B + j*l;
+    for (int k=0; k<l; k++)
+      axpyAVX(m, bPtr[k] * fact, A + k*m, C + j*m);
+  }
+}
+
+#ifdef _DENSE_AVX512
+
+static DENSE_TARGET("avx512f") void
+axpyAVX512(int n, double a, const double *x, double *y)
+{
+  __m512d va = _mm512_set1_pd(a);
+  int i = 0;
+  for ( ; i+8 <= n; i += 8)
+    _mm512_storeu_pd(y+i, _mm512_add_pd(_mm512_loadu_pd(y+i), _mm512_mul_pd(_mm512_loadu_pd(x+i), va)));
+  if (i+4 <= n) {
+    __m256d va4 = _mm256_set1_pd(a);
+    _mm256_storeu_pd(y+i, _mm256_add_pd(_mm256_loadu_pd(y+i), _mm256_mul_pd(_mm256_loadu_pd(x+i), va4)));
+    i += 4;
+  }
+  if (i < n) {
+    __mmask8 mask = (__mmask8)((1u << (n-i)) - 1);
+    __m512d xi = _mm512_maskz_loadu_pd(mask, x+i);
+    __m512d yi = _mm512_maskz_loadu_pd(mask, y+i);
+    _mm512_mask_storeu_pd(y+i, mask, _mm512_add_pd(yi, _mm512_mul_pd(xi, va)));
+  }
+}
+
+static DENSE_TARGET("avx512f") void
+multAddAVX512(int m, int n, int l, const double *A, const double *B, double *C, double fact)
+{
+  for (int j=0; j<n; j++) {
+    const double *bPtr = B + j*l;
+    for (int k=0; k<l; k++)
+      axpyAVX512(m, bPtr[k] * fact, A + k*m, C + j*m);
+  }
+}
+
+#endif
+#endif
+
+struct DenseKernels {
+  const char *isa;
+  int level;			// cpu level required, see getCpuLevel()
+  void (*multAdd)(int m, int n, int l, const double *A, const double *B, double *C, double fact);
+  void (*axpy)(int n, double a, const double *x, double *y);
+};
+
+// in order of preference, the plain C++ path last
+static const DenseKernels denseKernels[] = {
+#ifdef _DENSE_X86
+#ifdef _DENSE_AVX512
+  {"AVX-512", 3, multAddAVX512, axpyAVX512},
+#endif
+  {"AVX",     2, multAddAVX,    axpyAVX},
+  {"SSE2",    1, multAddSSE2,   axpySSE2},
+#endif
+  {"C++",     0, multAddCpp,    axpyCpp}
+};
 
+static const int numDenseKernels = sizeof(denseKernels)/sizeof(DenseKernels);
 
+// 3 with AVX-512, 2 with AVX, 1 with SSE2, 0 otherwise; the wide
+// registers count only if the operating system saves them
+static int
+getCpuLevel(void)
+{
+#if defined(_DENSE_X86) && defined(__GNUC__)
+  __builtin_cpu_init();
+#ifdef _DENSE_AVX512
+  if (__builtin_cpu_supports("avx512f"))
+    return 3;
+#endif
+  if (__builtin_cpu_supports("avx"))
+    return 2;
+  if (__builtin_cpu_supports("sse2"))
+    return 1;
+  return 0;
+#elif defined(_DENSE_X86) && defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  int maxLeaf = info[0];
+  __cpuid(info, 1);
+  bool sse2 = (info[3] & (1 << 26)) != 0;
+  bool avx = (info[2] & (1 << 28)) != 0 && (info[2] & (1 << 27)) != 0;
+  unsigned long long xcr0 = avx ? _xgetbv(0) : 0;
+  avx = avx && (xcr0 & 0x6) == 0x6;
+  if (avx && maxLeaf >= 7) {
+    __cpuidex(info, 7, 0);
+    if ((info[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6)
+      return 3;
+  }
+  if (avx)
+    return 2;
+  return sse2 ? 1 : 0;
+#else
+  return 0;
+#endif
+}
+
+// returns 0 if the path reproduces the plain C++ one bit for bit on
+// sizes covering every register width and remainder; reports the first
+// routine and size that do not
+static int
+checkDenseKernels(const DenseKernels &theKernels)
+{
+  const char *routine = 0;
+  int m = 1;
+
+  const DenseKernels &cpp = denseKernels[numDenseKernels-1];
+
+  const int maxSize = 19;
+  double A[maxSize*maxSize], B[maxSize*maxSize];
+  double C1[maxSize*maxSize], C2[maxSize*maxSize];
+  for (int i=0; i<maxSize*maxSize; i++) {
+    A[i] = sin(1.0 + i) * 3.7;
+    B[i] = cos(0.5 * i) / 1.3;
+  }
+
+  for ( ; m<=maxSize; m++) {
+    int n = 1 + m%4;
+    int l = 1 + (7*m)%maxSize;
+    for (int i=0; i<m*n; i++)
+      C1[i] = C2[i] = B[maxSize*maxSize-1-i];
+    cpp.multAdd(m, n, l, A, B, C1, -0.75);
+    theKernels.multAdd(m, n, l, A, B, C2, -0.75);
+    if (memcmp(C1, C2, m*n*sizeof(double)) != 0) {
+      routine = "multAdd";
+      break;
+    }
+
+    cpp.axpy(m, 1.25, A+m, C1);
+    theKernels.axpy(m, 1.25, A+m, C2);
+    if (memcmp(C1, C2, m*sizeof(double)) != 0) {
+      routine = "axpy";
+      break;
+    }
+  }
+
+  if (routine == 0)
+    return 0;
+
+  opserr << "WARNING checkDenseKernels() - " << theKernels.isa << " " << routine;
+  opserr << " differs from the C++ one for size " << m << "\n";
+  return -1;
+}
+
+static const DenseKernels *
+selectDenseKernels(void)
+{
+  int level = getCpuLevel();
+  for (int i=0; i<numDenseKernels-1; i++) {
+    const DenseKernels &theKernels = denseKernels[i];
+    if (theKernels.level > level)
+      continue;
+    if (checkDenseKernels(theKernels) == 0)
+      return &theKernels;
+    opserr << "WARNING selectDenseKernels() - the " << theKernels.isa;
+    opserr << " kernels do not reproduce the C++ ones, not used\n";
+  }
+  return &denseKernels[numDenseKernels-1];
+}
+
+// selected once, on first use, by whichever thread gets there first
+static const DenseKernels *&
+theDenseKernels(void)
+{
+  static const DenseKernels *theKernels = selectDenseKernels();
+  return theKernels;
+}
+
+void
+denseMultAdd(int m, int n, int l, const double *A, const double *B, double *C, double fact)
+{
+  theDenseKernels()->multAdd(m, n, l, A, B, C, fact);
+}
+
+void
+denseAxpy(int n, double a, const double *x, double *y)
+{
+  theDenseKernels()->axpy(n, a, x, y);
+}
+
+const char *
+getDenseKernelISA(void)
+{
+  return theDenseKernels()->isa;
+}
+
+// not to be called while other threads are using the kernels
+int
+setDenseKernelISA(const char *isa)
+{
+  int level = getCpuLevel();
+  for (int i=0; i<numDenseKernels; i++) {
+    const DenseKernels &theKernels = denseKernels[i];
+    if (strcmp(theKernels.isa, isa) != 0)
+      continue;
+    if (theKernels.level > level)
+      return -1;
+    if (checkDenseKernels(theKernels) != 0)
+      return -2;
+    theDenseKernels() = &theKernels;
+    return 0;
+  }
+  return -1;
+}
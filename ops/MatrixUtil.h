@@ -34,4 +34,16 @@ void   invertMatrix(int n, const Matrix &a, Matrix &b);
 void   getCBDIinfluenceMatrix(int nIntegrPts, const Matrix &xi_pt, double L, Matrix &ls);
 void   getCBDIinfluenceMatrix(int nIntegrPts, double *pts, double L, Matrix &ls);
 
+// Dense kernels behind Matrix and Vector on column-major data.  The
+// implementation is chosen on first use from the instruction sets of
+// the cpu (AVX-512, AVX, SSE2, or plain C++).  All of them give the same
+// result bit for bit; a path that fails a check against the plain C++
+// one at selection is not used.
+void   denseMultAdd(int m, int n, int l, const double *A, const double *B,
+		    double *C, double fact);	// C(m x n) += A(m x l) * B(l x n) * fact
+void   denseAxpy(int n, double a, const double *x, double *y);	// y += x * a
+
+const char *getDenseKernelISA(void);
+int    setDenseKernelISA(const char *isa);	// -1 if isa is not supported, -2 if it fails the check
+
 #endif
@@ -0,0 +1,220 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/ModifiedNewton.cpp,v $
+
+
+// Description: This file contains the implementation for ModifiedNewton.
+// The solver of the LinearSOE only refactors after the tangent has been
+// formed, so every iteration without formTangent() is a back substitution.
+//
+// What: "@(#)ModifiedNewton.C, revA"
+
+#include <ModifiedNewton.h>
+#include <LineSearch.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+
+// Constructor
+ModifiedNewton::ModifiedNewton(int theTangentToUse, int factor, double ratio,
+			       LineSearch *theSearch)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_ModifiedNewton),
+ theLineSearch(theSearch),
+ tangent(theTangentToUse), factorOnce(factor), refreshRatio(ratio),
+ tangentFormed(false), numIterations(0), numFactorizations(0)
+{
+
+}
+
+// Destructor
+ModifiedNewton::~ModifiedNewton()
+{
+  if (theLineSearch != 0)
+    delete theLineSearch;
+}
+
+int
+ModifiedNewton::domainChanged(void)
+{
+    // the SOE has been resized or zeroed
+    tangentFormed = false;
+    return 0;
+}
+
+int
+ModifiedNewton::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING ModifiedNewton::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	return -2;
+    }
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "ModifiedNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    bool refresh = (factorOnce == 0 || tangentFormed == false);
+    double lastNorm = 0.0;
+
+    int result = -1;
+    numIterations = 0;
+
+    do {
+	if (refresh) {
+	    SOLUTION_ALGORITHM_tangentFlag = tangent;
+	    if (theIntegrator->formTangent(tangent) < 0){
+		opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+		opserr << "the Integrator failed in formTangent()\n";
+		tangentFormed = false;
+		return -1;
+	    }
+	    tangentFormed = true;
+	    numFactorizations++;
+	    refresh = false;
+	}
+
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";
+	    return -3;
+	}
+
+	double s0 = theSOE->getX() ^ theSOE->getB();
+
+	if (theIntegrator->update(theSOE->getX()) < 0) {
+	    opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";
+	    return -4;
+	}
+
+	if (theIntegrator->formUnbalance() < 0) {
+	    opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";
+	    return -2;
+	}
+
+	if (theLineSearch != 0) {
+	    double s1 = theSOE->getX() ^ theSOE->getB();
+	    if (theLineSearch->search(s0, s1, *theSOE, *theIntegrator) < 0) {
+		opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+		opserr << "the LineSearch failed in search()\n";
+		return -4;
+	    }
+	}
+
+	result = theTest->test();
+	numIterations++;
+	this->record(numIterations);
+
+	// slow contraction -- the tangent is too far off
+	if (refreshRatio > 0.0) {
+	    double norm = theSOE->getX().Norm();
+	    if (numIterations > 1 && norm > refreshRatio*lastNorm)
+		refresh = true;
+	    lastNorm = norm;
+	}
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "ModifiedNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+int
+ModifiedNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector data(3);
+  data(0) = tangent;
+  data(1) = factorOnce;
+  data(2) = refreshRatio;
+  return theChannel.sendVector(this->getDbTag(), cTag, data);
+}
+
+int
+ModifiedNewton::recvSelf(int cTag,
+			 Channel &theChannel,
+			 FEM_ObjectBroker &theBroker)
+{
+  static Vector data(3);
+  theChannel.recvVector(this->getDbTag(), cTag, data);
+  tangent = int(data(0));
+  factorOnce = int(data(1));
+  refreshRatio = data(2);
+  tangentFormed = false;
+  return 0;
+}
+
+void
+ModifiedNewton::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "ModifiedNewton";
+    if (factorOnce != 0)
+      s << " -factorOnce";
+    if (refreshRatio > 0.0)
+      s << " -refreshRatio " << refreshRatio;
+    s << endln;
+    if (theLineSearch != 0)
+      theLineSearch->Print(s, flag);
+  }
+}
+
+int
+ModifiedNewton::getNumIterations(void)
+{
+  return numIterations;
+}
+
+int
+ModifiedNewton::getNumFactorizations(void)
+{
+  return numFactorizations;
+}
@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/ModifiedNewton.h,v $
+
+
+#ifndef ModifiedNewton_h
+#define ModifiedNewton_h
+
+// Description: This file contains the class definition for ModifiedNewton.
+// ModifiedNewton performs Newton iterations with a tangent that is formed
+// (and factored) once at the start of each step, or only once for the whole
+// analysis if factorOnce is set, and then reused.  If refreshRatio > 0 the
+// tangent is formed again whenever the norm of the displacement increment
+// fails to drop below refreshRatio times that of the previous iteration.
+// An optional LineSearch (owned by the algorithm) scales every increment.
+//
+// What: "@(#)ModifiedNewton.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class LineSearch;
+
+class ModifiedNewton: public EquiSolnAlgo
+{
+  public:
+    ModifiedNewton(int tangent = CURRENT_TANGENT, int factorOnce = 0,
+		   double refreshRatio = 0.0, LineSearch *theLineSearch = 0);
+    ~ModifiedNewton();
+
+    int solveCurrentStep(void);
+    int domainChanged(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    LineSearch *theLineSearch;
+    int tangent;
+    int factorOnce;
+    double refreshRatio;
+
+    bool tangentFormed;     // the SOE holds a tangent of the current model
+    int numIterations;
+    int numFactorizations;
+};
+
+#endif
@@ -52,7 +52,7 @@
 Matrix NDMaterial::errMatrix(1,1);
 Vector NDMaterial::errVector(1);
 
-static MapOfTaggedObjects theNDMaterialObjects;
+static thread_local MapOfTaggedObjects theNDMaterialObjects;
 
 bool OPS_addNDMaterial(NDMaterial *newComponent)
 {
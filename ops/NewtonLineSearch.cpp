@@ -0,0 +1,185 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/NewtonLineSearch.cpp,v $
+
+
+// Description: This file contains the implementation for NewtonLineSearch.
+//
+// What: "@(#)NewtonLineSearch.C, revA"
+
+#include <NewtonLineSearch.h>
+#include <LineSearch.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+#include <ID.h>
+
+// Constructor
+NewtonLineSearch::NewtonLineSearch(LineSearch *theSearch, int theTangentToUse)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_NewtonLineSearch),
+ theLineSearch(theSearch), tangent(theTangentToUse),
+ numIterations(0), numFactorizations(0)
+{
+
+}
+
+// Destructor
+NewtonLineSearch::~NewtonLineSearch()
+{
+  if (theLineSearch != 0)
+    delete theLineSearch;
+}
+
+int
+NewtonLineSearch::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING NewtonLineSearch::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	return -2;
+    }
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "NewtonLineSearch::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    int result = -1;
+    numIterations = 0;
+
+    do {
+	SOLUTION_ALGORITHM_tangentFlag = tangent;
+	if (theIntegrator->formTangent(tangent) < 0){
+	    opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formTangent()\n";
+	    return -1;
+	}
+	numFactorizations++;
+
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";
+	    return -3;
+	}
+
+	// s(0) from the unbalance the increment was solved for
+	double s0 = theSOE->getX() ^ theSOE->getB();
+
+	if (theIntegrator->update(theSOE->getX()) < 0) {
+	    opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";
+	    return -4;
+	}
+
+	if (theIntegrator->formUnbalance() < 0) {
+	    opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";
+	    return -2;
+	}
+
+	// s(1) from the unbalance after the full increment
+	double s1 = theSOE->getX() ^ theSOE->getB();
+
+	if (theLineSearch != 0 &&
+	    theLineSearch->search(s0, s1, *theSOE, *theIntegrator) < 0) {
+	    opserr << "WARNING NewtonLineSearch::solveCurrentStep() -";
+	    opserr << "the LineSearch failed in search()\n";
+	    return -4;
+	}
+
+	result = theTest->test();
+	numIterations++;
+	this->record(numIterations);
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "NewtonLineSearch::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+int
+NewtonLineSearch::sendSelf(int cTag, Channel &theChannel)
+{
+  static ID data(1);
+  data(0) = tangent;
+  return theChannel.sendID(this->getDbTag(), cTag, data);
+}
+
+int
+NewtonLineSearch::recvSelf(int cTag,
+			   Channel &theChannel,
+			   FEM_ObjectBroker &theBroker)
+{
+  static ID data(1);
+  theChannel.recvID(this->getDbTag(), cTag, data);
+  tangent = data(0);
+  return 0;
+}
+
+void
+NewtonLineSearch::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "NewtonLineSearch" << endln;
+    if (theLineSearch != 0)
+      theLineSearch->Print(s, flag);
+  }
+}
+
+int
+NewtonLineSearch::getNumIterations(void)
+{
+  return numIterations;
+}
+
+int
+NewtonLineSearch::getNumFactorizations(void)
+{
+  return numFactorizations;
+}
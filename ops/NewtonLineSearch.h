@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/NewtonLineSearch.h,v $
+
+
+#ifndef NewtonLineSearch_h
+#define NewtonLineSearch_h
+
+// Description: This file contains the class definition for NewtonLineSearch.
+// NewtonLineSearch performs Newton-Raphson iterations in which every
+// increment is scaled by a LineSearch.  The LineSearch object is owned by
+// the algorithm.
+//
+// What: "@(#)NewtonLineSearch.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class LineSearch;
+
+class NewtonLineSearch: public EquiSolnAlgo
+{
+  public:
+    NewtonLineSearch(LineSearch *theLineSearch, int tangent = CURRENT_TANGENT);
+    ~NewtonLineSearch();
+
+    int solveCurrentStep(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    LineSearch *theLineSearch;
+    int tangent;
+
+    int numIterations;
+    int numFactorizations;
+};
+
+#endif
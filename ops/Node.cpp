@@ -56,8 +56,8 @@
 #include <OPS_Globals.h>
 #include <elementAPI.h>
 
-Matrix **Node::theMatrices = 0;
-int Node::numMatrices = 0;
+thread_local Matrix **Node::theMatrices = 0;
+thread_local int Node::numMatrices = 0;
 
 int OPS_Node()
 {
@@ -189,7 +189,7 @@ Node::Node(int theClassTag)
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // for FEM_ObjectBroker, recvSelf() must be invoked on object
 
@@ -210,7 +210,7 @@ Node::Node(int tag, int theClassTag)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // for subclasses - they must implement all the methods with
   // their own data structures.
@@ -231,7 +231,7 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -246,35 +246,6 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
   if (dLoc != 0) {
     displayLocation = new Vector(*dLoc);
   }
-  
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 }
 
 
@@ -304,35 +275,6 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
   if (dLoc != 0) {
     displayLocation = new Vector(*dLoc);
   }
-  
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 }
 
 
@@ -364,35 +306,6 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
   if (dLoc != 0) {
     displayLocation = new Vector(*dLoc);
   }
-  
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 }
 
 
@@ -478,35 +391,6 @@ Node::Node(const Node &otherNode, bool copyMass)
       exit(-1);
     }
   }
-
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }  
 }
 
 
@@ -1222,9 +1106,35 @@ Node::revertToStart()
 }
 
 
+// getWorkAreaIndex()
+//	returns the location in the work area registry of the calling thread
+//	of the matrix sized for this node; the registry is per thread so
+//	node methods may be invoked concurrently.
+
+int
+Node::getWorkAreaIndex(void)
+{
+  for (int i=0; i<numMatrices; i++)
+    if (theMatrices[i]->noRows() == numberDOF)
+      return i;
+
+  Matrix **nextMatrices = new Matrix *[numMatrices+1];
+  for (int j=0; j<numMatrices; j++)
+    nextMatrices[j] = theMatrices[j];
+  nextMatrices[numMatrices] = new Matrix(numberDOF, numberDOF);
+
+  if (numMatrices != 0)
+    delete [] theMatrices;
+  theMatrices = nextMatrices;
+
+  return numMatrices++;
+}
+
 const Matrix &
 Node::getMass(void) 
 {
+    int index = this->getWorkAreaIndex();
+
     // make sure it was created before we return it
     if (mass == 0) {
       theMatrices[index]->Zero();
@@ -1244,6 +1154,8 @@ Node::setRayleighDampingFactor(double alpham) {
 const Matrix &
 Node::getDamp(void) 
 {
+    int index = this->getWorkAreaIndex();
+
     // make sure it was created before we return it
     if (mass == 0 || alphaM == 0.0) {
       theMatrices[index]->Zero();
@@ -1260,6 +1172,8 @@ Node::getDamp(void)
 const Matrix &
 Node::getDampSensitivity(void) 
 {
+    int index = this->getWorkAreaIndex();
+
     // make sure it was created before we return it
     if (mass == 0 || alphaM == 0.0) {
       theMatrices[index]->Zero();
@@ -1700,35 +1614,6 @@ Node::recvSelf(int cTag, Channel &theChannel,
     }        
 
 
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
-
   return 0;
 }
 
@@ -1881,6 +1766,8 @@ Node::createAccel(void)
 Matrix
 Node::getMassSensitivity(void)
 {
+	int index = this->getWorkAreaIndex();
+
 	if (mass == 0) {
 		theMatrices[index]->Zero();
 		return *theMatrices[index];
@@ -2141,7 +2028,7 @@ Node::addReactionForce(const Vector &add, double factor){
   else if (factor == -1.0)
     *reaction -= add;
   else
-    *reaction = add * factor;
+    reaction->addVector(0.0, add, factor);
 
   return 0;
 }
@@ -195,11 +195,10 @@ class Node : public DomainComponent
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static Matrix **theMatrices;
-    static int numMatrices;
-    static Matrix **theVectors;
-    static int numVectors;
-    int index;
+    // work matrices shared by all nodes of one size, one set per thread
+    int getWorkAreaIndex(void);
+    static thread_local Matrix **theMatrices;
+    static thread_local int numMatrices;
 
     Vector *reaction;
     Vector *displayLocation;
@@ -39,7 +39,11 @@
 #define _USING_OpenSees_STREAMS
 #include <OPS_Stream.h>
 //extern OPS_Stream &opserr;
-extern OPS_Stream *opserrPtr;
+//
+// the globals below are kept per thread: each thread may run its own
+// Domain (and redirect its own error stream) without affecting others
+//
+extern thread_local OPS_Stream *opserrPtr;
 #define opserr (*opserrPtr)
 #define endln "\n"
 
@@ -61,14 +65,14 @@ class Element;
 
 #define MAX_FILENAMELENGTH 50
 
-extern double   ops_Dt;                // current delta T for current domain doing an update
+extern thread_local double   ops_Dt;                // current delta T for current domain doing an update
 // extern double  *ops_Gravity;        // gravity factors for current domain undergoing an update
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+extern thread_local Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern thread_local Element *ops_TheActiveElement;  // current element undergoing an update
 
 // global variable for initial state analysis
 // added: Chris McGann, University of Washington
-extern bool  ops_InitialStateAnalysis;
+extern thread_local bool  ops_InitialStateAnalysis;
 
 #define OPS_DISPLAYMODE_MATERIAL_TAG 2
 #define OPS_DISPLAYMODE_ELEMENT_CLASS 3
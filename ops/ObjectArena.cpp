@@ -0,0 +1,167 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-23 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/ObjectArena.cpp,v $
+
+// Description: This file contains the class implementation for ObjectArena.
+//
+// What: "@(#) ObjectArena.cpp, revA"
+
+#include <ObjectArena.h>
+#include <OPS_Globals.h>
+
+// every block returned by allocateObject() is preceded by a header that
+// holds its arena (0 for a heap block); its size keeps the blocks aligned
+// as the blocks of operator new are
+#define ARENA_ALIGNMENT 16
+
+union ArenaBlockHeader {
+  ObjectArena *theArena;
+  char align[ARENA_ALIGNMENT];
+};
+
+thread_local ObjectArena *ObjectArena::theCurrentArena = 0;
+
+ObjectArena::ObjectArena(size_t size)
+  :chunks(), chunkSize(size), currentChunk(0), used(0), numObjects(0), numBytes(0)
+{
+  if (chunkSize < 16*ARENA_ALIGNMENT)
+    chunkSize = 16*ARENA_ALIGNMENT;
+}
+
+ObjectArena::~ObjectArena()
+{
+  if (theCurrentArena == this)
+    theCurrentArena = 0;
+
+  // the memory of blocks still in use cannot be freed
+  if (numObjects != 0) {
+    opserr << "ObjectArena::~ObjectArena() - " << numObjects << " blocks still in use\n";
+    return;
+  }
+
+  for (size_t i = 0; i < chunks.size(); i++)
+    delete [] chunks[i];
+}
+
+void *
+ObjectArena::allocate(size_t size)
+{
+  size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+  // blocks that would waste much of a chunk are not taken from the arena
+  if (size > chunkSize/4)
+    return 0;
+
+  if (chunks.empty() || used + size > chunkSize) {
+    if (!chunks.empty())
+      currentChunk++;
+    if (currentChunk == (int)chunks.size())
+      chunks.push_back(new char[chunkSize]);
+    used = 0;
+  }
+
+  void *block = chunks[currentChunk] + used;
+  used += size;
+  numBytes += size;
+  numObjects++;
+
+  return block;
+}
+
+void
+ObjectArena::release(void)
+{
+  numObjects--;
+}
+
+int
+ObjectArena::reset(void)
+{
+  if (numObjects != 0)
+    return -1;
+
+  // the chunks are kept for the blocks to come
+  currentChunk = 0;
+  used = 0;
+  numBytes = 0;
+
+  return 0;
+}
+
+int
+ObjectArena::getNumObjects(void) const
+{
+  return numObjects;
+}
+
+size_t
+ObjectArena::getNumBytes(void) const
+{
+  return numBytes;
+}
+
+ObjectArena *
+ObjectArena::getCurrent(void)
+{
+  return theCurrentArena;
+}
+
+ObjectArena *
+ObjectArena::setCurrent(ObjectArena *theArena)
+{
+  ObjectArena *previous = theCurrentArena;
+  theCurrentArena = theArena;
+  return previous;
+}
+
+void *
+ObjectArena::allocateObject(size_t size)
+{
+  ArenaBlockHeader *header = 0;
+
+  if (theCurrentArena != 0) {
+    header = (ArenaBlockHeader *)theCurrentArena->allocate(sizeof(ArenaBlockHeader) + size);
+    if (header != 0) {
+      header->theArena = theCurrentArena;
+      return header + 1;
+    }
+  }
+
+  header = (ArenaBlockHeader *)::operator new(sizeof(ArenaBlockHeader) + size);
+  header->theArena = 0;
+  return header + 1;
+}
+
+void
+ObjectArena::releaseObject(void *block)
+{
+  if (block == 0)
+    return;
+
+  ArenaBlockHeader *header = (ArenaBlockHeader *)block - 1;
+
+  if (header->theArena != 0)
+    header->theArena->release();
+  else
+    ::operator delete(header);
+}
@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-23 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/ObjectArena.h,v $
+
+// Description: This file contains the class definition for ObjectArena.
+// An ObjectArena hands out memory from a few large chunks, one block
+// after the other, so that the objects of a model built in one go lie
+// next to each other in memory.  A block is never freed on its own:
+// releasing it only counts down the live blocks, and once all of them
+// have been released reset() makes the chunks available again.
+//
+// While an arena is set as the current one of a thread, every
+// TaggedObject created by that thread is taken from it (see
+// allocateObject()); otherwise it comes from the heap as before.
+// Destructors still run as usual, so the objects are deleted by their
+// owners exactly as heap objects are.  An arena must outlive all the
+// blocks taken from it.
+//
+// What: "@(#) ObjectArena.h, revA"
+
+#ifndef ObjectArena_h
+#define ObjectArena_h
+
+#include <stddef.h>
+#include <vector>
+
+class ObjectArena
+{
+  public:
+    ObjectArena(size_t chunkSize = 65536);
+    ~ObjectArena();
+
+    void *allocate(size_t size);
+    void release(void);
+    int reset(void);
+
+    int getNumObjects(void) const;
+    size_t getNumBytes(void) const;
+
+    // the arena used by allocateObject() on the calling thread, 0 for the
+    // heap; setCurrent() returns the previous one for restoring it
+    static ObjectArena *getCurrent(void);
+    static ObjectArena *setCurrent(ObjectArena *theArena);
+
+    // a block from the current arena or the heap, and its release
+    static void *allocateObject(size_t size);
+    static void releaseObject(void *block);
+
+  private:
+    std::vector<char *> chunks;
+    size_t chunkSize;
+    int currentChunk;          // chunk blocks are taken from
+    size_t used;               // bytes taken from the current chunk
+    int numObjects;            // blocks not yet released
+    size_t numBytes;           // bytes taken since the last reset
+
+    static thread_local ObjectArena *theCurrentArena;
+};
+
+#endif
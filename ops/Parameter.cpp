@@ -108,9 +108,9 @@ Parameter::Parameter(int tag, int classTag)
 
 Parameter::Parameter()
   :TaggedObject(0), MovableObject(PARAMETER_TAG_Parameter), 
-   theObjects(0), 
+   parameterID(0), theObjects(0), numObjects(0), maxNumObjects(0),
    theComponents(0), numComponents(0), maxNumComponents(0),
-   numObjects(0), maxNumObjects(0), parameterID(0), gradIndex(-1)
+   gradIndex(-1)
 {
 
 }
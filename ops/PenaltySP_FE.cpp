@@ -50,13 +50,10 @@
 #include <SP_Constraint.h>
 #include <DOF_Group.h>
 
-Matrix PenaltySP_FE::tang(1,1);
-Vector PenaltySP_FE::resid(1);
-
 PenaltySP_FE::PenaltySP_FE(int tag, Domain &theDomain, 
 			   SP_Constraint &TheSP, double Alpha)
 :FE_Element(tag, 1,1), alpha(Alpha),
- theSP(&TheSP), theNode(0)
+ theSP(&TheSP), theNode(0), tang(1,1), resid(1)
 {
     // get a pointer to the Node
     theNode = theDomain.getNode(theSP->getNodeTag());
@@ -71,8 +71,8 @@ class PenaltySP_FE: public FE_Element
     double alpha;
     SP_Constraint *theSP;
     Node *theNode;
-    static Matrix tang;
-    static Vector resid;
+    Matrix tang;
+    Vector resid;
 };
 
 #endif
@@ -0,0 +1,458 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/pileChain/PileChainLinLapackSolver.cpp,v $
+                                                                        
+                                                                        
+// Description: This file contains the implementation of 
+// PileChainLinLapackSolver.
+//
+// For a chain with level blocks D(k), L(k), U(k) and border blocks 
+// E(k), F(k) the factorization computes, in place,
+//
+//   D'(k) = D(k) - L(k) Z(k-1)         (LU factored)
+//   Z(k)  = D'(k)^-1 U(k)              (stored in U)
+//   H(k)  = D'(k)^-1 (E(k) - L(k) H(k-1))
+//   G(k)  = H(k) - Z(k) G(k+1)         (stored in E)
+//
+// so that the chain solution is x(k) = g(k) - G(k) xI, and the interface 
+// equations become (S - sum F(k) G(k)) xI = bI - sum F(k) g(k).
+//
+// What: "@(#) PileChainLinLapackSolver.C, revA"
+
+#include <PileChainLinLapackSolver.h>
+#include <PileChainLinSOE.h>
+#include <math.h>
+
+#ifdef _WIN32
+
+extern "C" int DGETRF(int *M, int *N, double *A, int *LDA, 
+			      int *iPiv, int *INFO);
+
+extern "C" int DGETRS(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+			      int *iPiv, double *B, int *LDB, int *INFO);
+
+#define dgetrf_ DGETRF
+#define dgetrs_ DGETRS
+
+#else
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, 
+		       int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);
+#endif
+
+// C(m x n) -= A(m x l) * B(l x n), all stored column by column
+static void
+multSub(double *C, const double *A, const double *B, int m, int l, int n)
+{
+    for (int j=0; j<n; j++) {
+	double *cPtr = C + j*m;
+	const double *bPtr = B + j*l;
+	for (int p=0; p<l; p++) {
+	    double b = bPtr[p];
+	    if (b == 0.0)
+		continue;
+	    const double *aPtr = A + p*m;
+	    for (int i=0; i<m; i++)
+		cPtr[i] -= aPtr[i] * b;
+	}
+    }
+}
+
+// LU factorization with partial pivoting of the n x n matrix D, in place;
+// same result as dgetrf, without the call overhead for these small blocks
+static int
+factorBlock(double *D, int n, int *piv)
+{
+    for (int k=0; k<n; k++) {
+	double *colK = D + k*n;
+
+	int p = k;
+	double maxVal = fabs(colK[k]);
+	for (int i=k+1; i<n; i++) {
+	    if (fabs(colK[i]) > maxVal) {
+		maxVal = fabs(colK[i]);
+		p = i;
+	    }
+	}
+	piv[k] = p;
+	if (maxVal == 0.0)
+	    return k+1;
+
+	if (p != k) {
+	    for (int j=0; j<n; j++) {
+		double tmp = D[k + j*n];
+		D[k + j*n] = D[p + j*n];
+		D[p + j*n] = tmp;
+	    }
+	}
+
+	double invPivot = 1.0/colK[k];
+	for (int i=k+1; i<n; i++)
+	    colK[i] *= invPivot;
+
+	for (int j=k+1; j<n; j++) {
+	    double *colJ = D + j*n;
+	    double a = colJ[k];
+	    if (a == 0.0)
+		continue;
+	    for (int i=k+1; i<n; i++)
+		colJ[i] -= colK[i] * a;
+	}
+    }
+    return 0;
+}
+
+// solves D X = B for nrhs columns of B using the factors of factorBlock()
+static void
+solveBlock(const double *D, int n, const int *piv, double *B, int nrhs)
+{
+    for (int r=0; r<nrhs; r++) {
+	double *b = B + r*n;
+
+	for (int k=0; k<n; k++) {
+	    if (piv[k] != k) {
+		double tmp = b[k];
+		b[k] = b[piv[k]];
+		b[piv[k]] = tmp;
+	    }
+	}
+
+	for (int k=0; k<n; k++) {
+	    double bk = b[k];
+	    if (bk == 0.0)
+		continue;
+	    const double *colK = D + k*n;
+	    for (int i=k+1; i<n; i++)
+		b[i] -= colK[i] * bk;
+	}
+
+	for (int k=n-1; k>=0; k--) {
+	    const double *colK = D + k*n;
+	    b[k] /= colK[k];
+	    double bk = b[k];
+	    if (bk == 0.0)
+		continue;
+	    for (int i=0; i<k; i++)
+		b[i] -= colK[i] * bk;
+	}
+    }
+}
+
+
+PileChainLinLapackSolver::PileChainLinLapackSolver()
+:PileChainLinSolver(SOLVER_TAGS_PileChainLinLapackSolver),
+ numThreads(1)
+{
+    
+}
+
+PileChainLinLapackSolver::~PileChainLinLapackSolver()
+{
+
+}
+
+
+void
+PileChainLinLapackSolver::setNumThreads(int num)
+{
+    numThreads = (num > 0) ? num : 1;
+}
+
+int
+PileChainLinLapackSolver::getNumThreads(void) const
+{
+    return numThreads;
+}
+
+
+int
+PileChainLinLapackSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING PileChainLinLapackSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int numChains = theSOE->chains.size();
+    int nI = theSOE->numIface;
+    char trans[] = "N";
+    int nrhs = 1;
+    int result;
+
+    if ((int)iPiv.size() != numChains || (int)iPivS.size() != nI) {
+	opserr << "WARNING PileChainLinLapackSolver::solve(void)- ";
+	opserr << " work areas not set up - has setSize() been called?\n";
+	return -1;
+    }
+
+    if (theSOE->factored == false) {
+
+	// eliminate the chains ...
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for (int c=0; c<numChains; c++)
+	    info[c] = this->factorChain(c);
+
+	for (int c=0; c<numChains; c++) {
+	    if (info[c] != 0) {
+		opserr << "WARNING PileChainLinLapackSolver::solve() -";
+		opserr << " zero pivot " << info[c] << " in a level block of chain " << c << endln;
+		return -info[c];
+	    }
+	}
+
+	// ... add their share to the interface equations ...
+	double *S = theSOE->S.data();
+	for (int c=0; c<numChains; c++) {
+	    const std::vector<int> &iface = theSOE->chains[c].iface;
+	    int nJ = iface.size();
+	    const double *Sc = border[c].data();
+	    for (int b=0; b<nJ; b++)
+		for (int a=0; a<nJ; a++)
+		    S[iface[a] + iface[b]*nI] += Sc[a + b*nJ];
+	}
+
+	// ... and factor the interface block
+	if (nI > 0) {
+	    dgetrf_(&nI, &nI, S, &nI, iPivS.data(), &result);
+	    if (result != 0) {
+		opserr << "WARNING PileChainLinLapackSolver::solve() -";
+		opserr << "LAPACK routine returned " << result << " for the interface" << endln;
+		return -result;
+	    }
+	}
+
+	theSOE->factored = true;
+    }
+
+    //
+    // forward elimination of the right hand side of each chain
+    //
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads) if(numThreads > 1)
+#endif
+    for (int c=0; c<numChains; c++)
+	this->reduceChain(c);
+
+    //
+    // solve for the interface
+    //
+
+    for (int a=0; a<nI; a++)
+	xI[a] = theSOE->B[theSOE->ifaceEqn[a]];
+
+    for (int c=0; c<numChains; c++) {
+	const std::vector<int> &iface = theSOE->chains[c].iface;
+	int nJ = iface.size();
+	const double *bc = border[c].data() + nJ*nJ;
+	for (int a=0; a<nJ; a++)
+	    xI[iface[a]] += bc[a];
+    }
+
+    if (nI > 0) {
+	dgetrs_(trans, &nI, &nrhs, theSOE->S.data(), &nI, iPivS.data(), xI.data(), &nI, &result);
+	if (result != 0) {
+	    opserr << "WARNING PileChainLinLapackSolver::solve() -";
+	    opserr << "LAPACK routine returned " << result << endln;
+	    return -result;
+	}
+    }
+
+    for (int a=0; a<nI; a++)
+	theSOE->X[theSOE->ifaceEqn[a]] = xI[a];
+
+    //
+    // and back substitute in the chains
+    //
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads) if(numThreads > 1)
+#endif
+    for (int c=0; c<numChains; c++)
+	this->backSubstituteChain(c);
+
+    return 0;
+}
+
+
+int
+PileChainLinLapackSolver::factorChain(int c)
+{
+    PileChainLinSOE::Chain &theChain = theSOE->chains[c];
+    double *A = theChain.A.data();
+    int *piv = iPiv[c].data();
+    int m  = theChain.numLevels;
+    int nJ = theChain.iface.size();
+    int result = 0;
+
+    for (int k=0; k<m; k++) {
+	int n = theChain.levelSize[k];
+	double *D = A + theChain.offD[k];
+	double *E = A + theChain.offE[k];
+	int *pivK = piv + theChain.levelStart[k];
+
+	if (k > 0) {
+	    int nPrev = theChain.levelSize[k-1];
+	    double *L = A + theChain.offL[k];
+	    multSub(D, L, A + theChain.offU[k-1], n, nPrev, n);
+	    multSub(E, L, A + theChain.offE[k-1], n, nPrev, nJ);
+	}
+
+	result = factorBlock(D, n, pivK);
+	if (result != 0)
+	    return result;
+
+	if (k < m-1)
+	    solveBlock(D, n, pivK, A + theChain.offU[k], theChain.levelSize[k+1]);
+	solveBlock(D, n, pivK, E, nJ);
+    }
+
+    // G(k) and the chain's share of the interface matrix, - sum F(k) G(k)
+    double *Sc = border[c].data();
+    for (int i=0; i<nJ*nJ; i++)
+	Sc[i] = 0.0;
+
+    for (int k=m-1; k>=0; k--) {
+	int n = theChain.levelSize[k];
+	double *G = A + theChain.offE[k];
+	if (k < m-1)
+	    multSub(G, A + theChain.offU[k], A + theChain.offE[k+1], n, theChain.levelSize[k+1], nJ);
+	multSub(Sc, A + theChain.offF[k], G, nJ, n, nJ);
+    }
+
+    return 0;
+}
+
+
+int
+PileChainLinLapackSolver::reduceChain(int c)
+{
+    PileChainLinSOE::Chain &theChain = theSOE->chains[c];
+    const double *A = theChain.A.data();
+    int *piv = iPiv[c].data();
+    double *y = work[c].data();
+    int m  = theChain.numLevels;
+    int nJ = theChain.iface.size();
+
+    int numEqn = theChain.eqn.size();
+    for (int i=0; i<numEqn; i++)
+	y[i] = theSOE->B[theChain.eqn[i]];
+
+    // y(k) = D'(k)^-1 (b(k) - L(k) y(k-1))
+    for (int k=0; k<m; k++) {
+	int n = theChain.levelSize[k];
+	double *yK = y + theChain.levelStart[k];
+	if (k > 0)
+	    multSub(yK, A + theChain.offL[k], y + theChain.levelStart[k-1], n, theChain.levelSize[k-1], 1);
+	solveBlock(A + theChain.offD[k], n, piv + theChain.levelStart[k], yK, 1);
+    }
+
+    // g(k) = y(k) - Z(k) g(k+1)
+    for (int k=m-2; k>=0; k--)
+	multSub(y + theChain.levelStart[k], A + theChain.offU[k], y + theChain.levelStart[k+1], 
+		theChain.levelSize[k], theChain.levelSize[k+1], 1);
+
+    // the chain's share of the interface right hand side, - sum F(k) g(k)
+    double *bc = border[c].data() + nJ*nJ;
+    for (int a=0; a<nJ; a++)
+	bc[a] = 0.0;
+    for (int k=0; k<m; k++)
+	multSub(bc, A + theChain.offF[k], y + theChain.levelStart[k], nJ, theChain.levelSize[k], 1);
+
+    return 0;
+}
+
+
+int
+PileChainLinLapackSolver::backSubstituteChain(int c)
+{
+    PileChainLinSOE::Chain &theChain = theSOE->chains[c];
+    const double *A = theChain.A.data();
+    double *y = work[c].data();
+    int m  = theChain.numLevels;
+    int nJ = theChain.iface.size();
+
+    // x(k) = g(k) - G(k) xI
+    double *xJ = border[c].data() + nJ*nJ;
+    for (int a=0; a<nJ; a++)
+	xJ[a] = xI[theChain.iface[a]];
+
+    for (int k=0; k<m; k++)
+	multSub(y + theChain.levelStart[k], A + theChain.offE[k], xJ, theChain.levelSize[k], nJ, 1);
+
+    int numEqn = theChain.eqn.size();
+    for (int i=0; i<numEqn; i++)
+	theSOE->X[theChain.eqn[i]] = y[i];
+
+    return 0;
+}
+
+
+int
+PileChainLinLapackSolver::setSize()
+{
+    int numChains = theSOE->chains.size();
+
+    iPiv.resize(numChains);
+    work.resize(numChains);
+    border.resize(numChains);
+    info.assign(numChains, 0);
+
+    for (int c=0; c<numChains; c++) {
+	const PileChainLinSOE::Chain &theChain = theSOE->chains[c];
+	int numEqn = theChain.eqn.size();
+	int nJ = theChain.iface.size();
+
+	iPiv[c].assign(numEqn, 0);
+	work[c].assign(numEqn, 0.0);
+	border[c].assign(nJ*nJ + nJ, 0.0);
+    }
+
+    iPivS.assign(theSOE->numIface, 0);
+    xI.assign(theSOE->numIface, 0.0);
+
+    return 0;
+}
+
+
+int    
+PileChainLinLapackSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+int
+PileChainLinLapackSolver::recvSelf(int commitTag,
+				   Channel &theChannel, 
+				   FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
+
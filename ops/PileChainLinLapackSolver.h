@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/pileChain/PileChainLinLapackSolver.h,v $
+                                                                        
+                                                                        
+// Description: This file contains the class definition for 
+// PileChainLinLapackSolver. It solves a PileChainLinSOE by a block 
+// tridiagonal (Thomas) elimination of every chain, with an LU 
+// factorization (partial pivoting) of each level block, followed by a 
+// dense Lapack solve of the Schur complement of the interface equations.
+//
+// The chains are independent of each other and are processed in 
+// parallel if OpenMP is available and setNumThreads() was given more 
+// than one thread.  The contributions to the interface are summed in 
+// chain order, so the result does not depend on the number of threads.
+//
+// What: "@(#) PileChainLinLapackSolver.h, revA"
+
+#ifndef PileChainLinLapackSolver_h
+#define PileChainLinLapackSolver_h
+
+#include <PileChainLinSolver.h>
+#include <vector>
+
+class PileChainLinLapackSolver : public PileChainLinSolver
+{
+  public:
+    PileChainLinLapackSolver();    
+    ~PileChainLinLapackSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    void setNumThreads(int num);
+    int getNumThreads(void) const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+
+  private:
+    int factorChain(int chain);
+    int reduceChain(int chain);
+    int backSubstituteChain(int chain);
+
+    std::vector<std::vector<int> > iPiv;      // pivots of the level blocks
+    std::vector<std::vector<double> > work;   // solution of a chain
+    std::vector<std::vector<double> > border; // interface part of a chain
+    std::vector<int> info;
+
+    std::vector<int> iPivS;                   // pivots of the interface
+    std::vector<double> xI;                   // solution of the interface
+
+    int numThreads;
+};
+
+#endif
+
@@ -0,0 +1,716 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/pileChain/PileChainLinSOE.cpp,v $
+                                                                        
+                                                                        
+// Description: This file contains the implementation for PileChainLinSOE
+
+#include <stdlib.h>
+
+#include <PileChainLinSOE.h>
+#include <PileChainLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <math.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <new>
+
+int
+PileChainLinSOE::Chain::ifaceIndex(int ifaceEqn) const
+{
+    for (int a=0; a<(int)iface.size(); a++)
+	if (iface[a] == ifaceEqn)
+	    return a;
+    return -1;
+}
+
+
+PileChainLinSOE::PileChainLinSOE(PileChainLinSolver &theSolvr)
+:LinearSOE(theSolvr, LinSOE_TAGS_PileChainLinSOE),
+ size(0), numIface(0), B(0), X(0), vectX(0), vectB(0), Bsize(0), 
+ factored(false), nodeChain(0), nodeLevel(0)
+{
+    theSolvr.setLinearSOE(*this);
+}
+
+PileChainLinSOE::PileChainLinSOE(int classTag)
+:LinearSOE(classTag),
+ size(0), numIface(0), B(0), X(0), vectX(0), vectB(0), Bsize(0), 
+ factored(false), nodeChain(0), nodeLevel(0)
+{
+
+}
+
+PileChainLinSOE::~PileChainLinSOE()
+{
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;    
+    if (vectB != 0) delete vectB;    
+}
+
+
+int
+PileChainLinSOE::setNodeLevel(int nodeTag, int chain, int level)
+{
+    if (nodeTag < 0 || chain < 0 || level < 0) {
+	opserr << "WARNING PileChainLinSOE::setNodeLevel() - invalid node ";
+	opserr << nodeTag << ", chain " << chain << " or level " << level << endln;
+	return -1;
+    }
+
+    // the ID objects grow as needed, unassigned nodes are left at 0
+    nodeChain[nodeTag] = chain+1;
+    nodeLevel[nodeTag] = level;
+
+    return 0;
+}
+
+void
+PileChainLinSOE::clearNodeLevels(void)
+{
+    nodeChain.Zero();
+    nodeLevel.Zero();
+}
+
+
+int
+PileChainLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+int
+PileChainLinSOE::getNumChains(void) const
+{
+    return chains.size();
+}
+
+int
+PileChainLinSOE::getNumInterfaceEqn(void) const
+{
+    return numIface;
+}
+
+
+int 
+PileChainLinSOE::setSize(Graph &theGraph)
+{
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    eqChain.assign(size, -1);
+    eqLevel.assign(size, 0);
+    eqLocal.assign(size, 0);
+
+    /*
+     * place the equations of the assigned nodes into their chain and level
+     */
+
+    int numChains = 0;
+
+    if (theModel != 0) {
+	DOF_GrpIter &theDOFs = theModel->getDOFs();
+	DOF_Group *dofPtr;
+
+	while ((dofPtr = theDOFs()) != 0) {
+	    int nodeTag = dofPtr->getNodeTag();
+	    if (nodeTag < 0 || nodeTag >= nodeChain.Size() || nodeChain(nodeTag) == 0)
+		continue;
+
+	    int chain = nodeChain(nodeTag) - 1;
+	    const ID &theID = dofPtr->getID();
+	    for (int i=0; i<theID.Size(); i++) {
+		int eq = theID(i);
+		if (eq >= 0 && eq < size) {
+		    eqChain[eq] = chain;
+		    eqLevel[eq] = nodeLevel(nodeTag);
+		}
+	    }
+	    if (chain >= numChains)
+		numChains = chain+1;
+	}
+    } else {
+	opserr << "WARNING PileChainLinSOE::setSize() - no AnalysisModel has been set,";
+	opserr << " all equations are treated as interface equations\n";
+    }
+
+    /*
+     * equations coupled to other chains or to levels further away than
+     * the neighboring ones are moved to the interface
+     */
+
+    Vertex *vertexPtr;
+    VertexIter &theVertices = theGraph.getVertices();
+
+    while ((vertexPtr = theVertices()) != 0) {
+	int eq = vertexPtr->getTag();
+	if (eqChain[eq] < 0)
+	    continue;
+
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	for (int i=0; i<theAdjacency.Size(); i++) {
+	    int other = theAdjacency(i);
+	    if (eqChain[other] < 0)
+		continue;
+	    int diff = eqLevel[eq] - eqLevel[other];
+	    if (eqChain[other] != eqChain[eq] || diff > 1 || diff < -1) {
+		eqChain[eq] = -1;
+		break;
+	    }
+	}
+    }
+
+    /*
+     * number the levels of each chain consecutively, skipping empty ones,
+     * and the equations within each level
+     */
+
+    chains.resize(numChains);   // keeps the storage of existing chains
+    std::vector<std::vector<int> > levelMap(numChains);
+
+    for (int eq=0; eq<size; eq++) {
+	int c = eqChain[eq];
+	if (c < 0)
+	    continue;
+	int level = eqLevel[eq];
+	if (level >= (int)levelMap[c].size())
+	    levelMap[c].resize(level+1, -1);
+	levelMap[c][level] = 0;
+    }
+
+    for (int c=0; c<numChains; c++) {
+	Chain &theChain = chains[c];
+	theChain.numLevels = 0;
+	for (int l=0; l<(int)levelMap[c].size(); l++)
+	    if (levelMap[c][l] == 0)
+		levelMap[c][l] = theChain.numLevels++;
+	theChain.levelSize.assign(theChain.numLevels, 0);
+	theChain.levelStart.assign(theChain.numLevels, 0);
+    }
+
+    numIface = 0;
+    ifaceEqn.clear();
+
+    for (int eq=0; eq<size; eq++) {
+	int c = eqChain[eq];
+	if (c < 0) {
+	    eqLocal[eq] = numIface++;
+	    ifaceEqn.push_back(eq);
+	} else {
+	    int level = levelMap[c][eqLevel[eq]];
+	    eqLevel[eq] = level;
+	    eqLocal[eq] = chains[c].levelSize[level]++;
+	}
+    }
+
+    for (int c=0; c<numChains; c++) {
+	Chain &theChain = chains[c];
+	int numEqn = 0;
+	for (int k=0; k<theChain.numLevels; k++) {
+	    theChain.levelStart[k] = numEqn;
+	    numEqn += theChain.levelSize[k];
+	}
+	theChain.eqn.assign(numEqn, 0);
+	theChain.iface.clear();
+    }
+
+    /*
+     * local equation lists and the interface equations seen by each chain
+     */
+
+    VertexIter &theVertices2 = theGraph.getVertices();
+
+    while ((vertexPtr = theVertices2()) != 0) {
+	int eq = vertexPtr->getTag();
+	int c = eqChain[eq];
+	if (c < 0)
+	    continue;
+
+	Chain &theChain = chains[c];
+	theChain.eqn[theChain.levelStart[eqLevel[eq]] + eqLocal[eq]] = eq;
+
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	for (int i=0; i<theAdjacency.Size(); i++) {
+	    int other = theAdjacency(i);
+	    if (eqChain[other] < 0 && theChain.ifaceIndex(eqLocal[other]) < 0)
+		theChain.iface.push_back(eqLocal[other]);
+	}
+    }
+
+    /*
+     * storage for the blocks
+     */
+
+    for (int c=0; c<numChains; c++) {
+	Chain &theChain = chains[c];
+	int m = theChain.numLevels;
+	int nI = theChain.iface.size();
+
+	theChain.offD.assign(m, 0);
+	theChain.offL.assign(m, 0);
+	theChain.offU.assign(m, 0);
+	theChain.offE.assign(m, 0);
+	theChain.offF.assign(m, 0);
+
+	int pos = 0;
+	for (int k=0; k<m; k++) {
+	    int n     = theChain.levelSize[k];
+	    int nPrev = (k > 0)   ? theChain.levelSize[k-1] : 0;
+	    int nNext = (k < m-1) ? theChain.levelSize[k+1] : 0;
+
+	    theChain.offD[k] = pos;  pos += n*n;
+	    theChain.offL[k] = pos;  pos += n*nPrev;
+	    theChain.offU[k] = pos;  pos += n*nNext;
+	    theChain.offE[k] = pos;  pos += n*nI;
+	    theChain.offF[k] = pos;  pos += nI*n;
+	}
+	theChain.A.assign(pos, 0.0);
+    }
+
+    S.assign(numIface*numIface, 0.0);
+
+    blockA.resize(numChains+1);
+    for (int c=0; c<numChains; c++)
+	blockA[c] = chains[c].A.data();
+    blockA[numChains] = S.data();
+
+    factored = false;
+    this->newStorageStamp();
+    
+    if (size > Bsize) { // we have to get space for the vectors
+	
+	// delete the old	
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+
+	// create the new
+	B = new (std::nothrow) double[size];
+	X = new (std::nothrow) double[size];
+	
+        if (B == 0 || X == 0) {
+            opserr << "WARNING PileChainLinSOE::setSize() :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    Bsize = 0; size = 0;
+	    result = -1;
+        }
+	else 
+	    Bsize = size;
+    }
+
+    // zero the vectors
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+
+    // get new Vector objects if size has changes
+    if (oldSize != size) {
+	if (vectX != 0) 
+	    delete vectX;
+
+	if (vectB != 0) 
+	    delete vectB;
+		
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+    
+    // invoke setSize() on the Solver
+    LinearSOESolver *theSolvr = this->getSolver();
+    int solverOK = theSolvr->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:PileChainLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }    
+
+    return result;    
+}
+
+
+// location of A(row,col) in blockA[block], -1 if it is outside the 
+// chain structure
+int
+PileChainLinSOE::getLocation(int row, int col, int &block)
+{
+    int rowChain = eqChain[row];
+    int colChain = eqChain[col];
+
+    if (rowChain < 0) {
+	// interface row
+	if (colChain < 0) {
+	    block = chains.size();
+	    return eqLocal[row] + eqLocal[col]*numIface;
+	}
+
+	Chain &theChain = chains[colChain];
+	int a = theChain.ifaceIndex(eqLocal[row]);
+	if (a < 0)
+	    return -1;
+	int nI = theChain.iface.size();
+	block = colChain;
+	return theChain.offF[eqLevel[col]] + a + eqLocal[col]*nI;
+    }
+
+    Chain &theChain = chains[rowChain];
+    int k = eqLevel[row];
+    int n = theChain.levelSize[k];
+
+    if (colChain < 0) {
+	int a = theChain.ifaceIndex(eqLocal[col]);
+	if (a < 0)
+	    return -1;
+	block = rowChain;
+	return theChain.offE[k] + eqLocal[row] + a*n;
+    }
+
+    if (colChain != rowChain)
+	return -1;
+
+    block = rowChain;
+    int diff = eqLevel[col] - k;
+    int pos = eqLocal[row] + eqLocal[col]*n;
+    if (diff == 0)
+	return theChain.offD[k] + pos;
+    else if (diff == 1)
+	return theChain.offU[k] + pos;
+    else if (diff == -1)
+	return theChain.offL[k] + pos;
+
+    return -1;
+}
+
+
+double *
+PileChainLinSOE::getEntry(int row, int col)
+{
+    int block;
+    int loc = this->getLocation(row, col, block);
+    if (loc < 0)
+	return 0;
+
+    return blockA[block] + loc;
+}
+
+
+int 
+PileChainLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();    
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "PileChainLinSOE::addA()	- Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    int result = 0;
+
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col >= size || col < 0)
+	    continue;
+
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    if (row >= size || row < 0)
+		continue;
+
+	    double value = m(j,i);
+	    if (value == 0.0)
+		continue;
+
+	    double *APtr = this->getEntry(row, col);
+	    if (APtr != 0)
+		*APtr += (fact == 1.0) ? value : value*fact;
+	    else
+		result = -1;
+	}  // for j
+    }  // for i
+
+    if (result != 0) {
+	opserr << "WARNING PileChainLinSOE::addA() - entry outside the chain structure,";
+	opserr << " has setSize() been called?\n";
+    }
+
+    return result;
+}
+
+
+// the map holds for entry (j,i) of the matrix, in column order, the pair
+// block, location in blockA; the block is -1 if the entry is not
+// assembled and -2 if it falls outside the chain structure
+int 
+PileChainLinSOE::formScatterMap(const ID &id, ID &map)
+{
+    int idSize = id.Size();
+    if (map.resize(2*idSize*idSize) < 0)
+	return -1;
+
+    int loc = 0;
+
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    int block = -1;
+	    int pos = 0;
+	    if (col < size && col >= 0 && row < size && row >= 0) {
+		pos = this->getLocation(row, col, block);
+		if (pos < 0) {
+		    block = -2;
+		    pos = 0;
+		}
+	    }
+	    map(loc++) = block;
+	    map(loc++) = pos;
+	}
+    }
+
+    return 0;
+}
+
+
+int 
+PileChainLinSOE::addAScatter(const Matrix &m, const ID &map, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    int idSize = m.noRows();
+    if (idSize != m.noCols() || 2*idSize*idSize != map.Size()) {
+	opserr << "PileChainLinSOE::addAScatter()	- Matrix and map not of similar sizes\n";
+	return -1;
+    }
+
+    int result = 0;
+    int loc = 0;
+
+    for (int i=0; i<idSize; i++) {
+	for (int j=0; j<idSize; j++, loc += 2) {
+	    double value = m(j,i);
+	    if (value == 0.0)
+		continue;
+
+	    int block = map(loc);
+	    if (block >= 0)
+		blockA[block][map(loc+1)] += (fact == 1.0) ? value : value*fact;
+	    else if (block == -2)
+		result = -1;
+	}  // for j
+    }  // for i
+
+    if (result != 0) {
+	opserr << "WARNING PileChainLinSOE::addAScatter() - entry outside the chain structure,";
+	opserr << " has setSize() been called?\n";
+    }
+
+    return result;
+}
+
+    
+int 
+PileChainLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+
+    // check that m and id are of similar size
+    int idSize = id.Size();        
+    if (idSize != v.Size() ) {
+	opserr << "PileChainLinSOE::addB()	- Vector and ID not of similar sizes\n";
+	return -1;
+    }    
+    
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }	
+    return 0;
+}
+
+
+int
+PileChainLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+
+    if (v.Size() != size) {
+	opserr << "WARNING PileChainLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+    
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }	
+    return 0;
+}
+
+
+void 
+PileChainLinSOE::zeroA(void)
+{
+    for (int c=0; c<(int)chains.size(); c++) {
+	std::vector<double> &A = chains[c].A;
+	for (int i=0; i<(int)A.size(); i++)
+	    A[i] = 0.0;
+    }
+    for (int i=0; i<(int)S.size(); i++)
+	S[i] = 0.0;
+    
+    factored = false;
+}
+	
+void 
+PileChainLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+const Vector &
+PileChainLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL PileChainLinSOE::getX - vectX == 0!";
+	exit(-1);
+    }    
+    
+    return *vectX;
+}
+
+
+const Vector &
+PileChainLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL PileChainLinSOE::getB - vectB == 0!";
+	exit(-1);
+    }    
+
+    return *vectB;
+}
+
+
+double 
+PileChainLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    double *Bptr = B;
+    for (int i=0; i<size; i++) {
+	double Yi = *Bptr++;
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}    
+
+
+void 
+PileChainLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >= 0)
+	X[loc] = value;
+}
+
+void 
+PileChainLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+      *vectX = x;
+}
+
+
+int
+PileChainLinSOE::setPileChainSolver(PileChainLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+    
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:PileChainLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return solverOK;
+	}
+    }	
+    
+    return this->setSolver(newSolver);
+}
+
+
+int 
+PileChainLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int 
+PileChainLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
+
+
@@ -0,0 +1,137 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/pileChain/PileChainLinSOE.h,v $
+                                                                        
+                                                                        
+#ifndef PileChainLinSOE_h
+#define PileChainLinSOE_h
+
+// Description: This file contains the class definition for PileChainLinSOE.
+// PileChainLinSOE is a subclass of LinearSOE for models made of 1-D chains
+// (piles) that are coupled to each other only through a small set of
+// interface equations (the pile cap).  
+//
+// Every node is assigned to a chain and a level along that chain with
+// setNodeLevel(); all equations of a node belong to its block.  The
+// equations of a chain then form a block-tridiagonal matrix, coupled to 
+// the interface equations by dense border blocks.  Equations of nodes
+// without an assignment, and equations whose couplings do not fit this
+// pattern, are treated as interface equations.  The node information is
+// obtained from the AnalysisModel, setLinks() must have been invoked.
+//
+// What: "@(#) PileChainLinSOE.h, revA"
+
+#include <LinearSOE.h>
+#include <Vector.h>
+#include <ID.h>
+#include <vector>
+
+class PileChainLinSolver;
+
+class PileChainLinSOE : public LinearSOE
+{
+  public:
+    PileChainLinSOE(PileChainLinSolver &theSolver);        
+    PileChainLinSOE(int classTag);        
+
+    virtual ~PileChainLinSOE();
+
+    // assignment of nodes to chains -- must be set before setSize()
+    int setNodeLevel(int nodeTag, int chain, int level);
+    void clearNodeLevels(void);
+
+    virtual int getNumEqn(void) const;
+    virtual int setSize(Graph &theGraph);
+    
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int formScatterMap(const ID &id, ID &map);
+    virtual int addAScatter(const Matrix &, const ID &map, double fact = 1.0);
+    virtual int addB(const Vector &, const ID &, double fact = 1.0);    
+    virtual int setB(const Vector &, double fact = 1.0);        
+
+    virtual void zeroA(void);
+    virtual void zeroB(void);
+
+    virtual const Vector &getX(void);
+    virtual const Vector &getB(void);
+    virtual double normRHS(void);
+
+    virtual void setX(int loc, double value);    
+    virtual void setX(const Vector &x);    
+
+    int getNumChains(void) const;
+    int getNumInterfaceEqn(void) const;
+
+    virtual int setPileChainSolver(PileChainLinSolver &newSolver);    
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    friend class PileChainLinLapackSolver;
+
+  protected:
+    // the blocks of one chain; all blocks are stored column by column.
+    // For level k with n(k) equations and nI interface equations of the
+    // chain: D(k) is n(k) x n(k), L(k) is n(k) x n(k-1), U(k) is 
+    // n(k) x n(k+1), E(k) is n(k) x nI and F(k) is nI x n(k).
+    class Chain {
+      public:
+	int numLevels;
+	std::vector<int> levelSize;
+	std::vector<int> levelStart;     // first local equation of a level
+	std::vector<int> eqn;            // local equation -> equation number
+	std::vector<int> iface;          // interface index of the border columns
+
+	std::vector<int> offD, offL, offU, offE, offF;
+	std::vector<double> A;           // D, L, U, E and F of all levels
+
+	int ifaceIndex(int ifaceEqn) const;
+    };
+
+    int size;
+    std::vector<Chain> chains;
+    std::vector<int> eqChain;        // chain of an equation, -1 for interface
+    std::vector<int> eqLevel;        // level of an equation in its chain
+    std::vector<int> eqLocal;        // index in its level or in the interface
+
+    int numIface;
+    std::vector<int> ifaceEqn;       // interface index -> equation number
+    std::vector<double> S;           // interface block, numIface x numIface
+    std::vector<double *> blockA;    // A of each chain, then S
+
+    double *B, *X;
+    Vector *vectX;
+    Vector *vectB;
+    int Bsize;
+    bool factored;
+
+  private:
+    int getLocation(int row, int col, int &block);
+    double *getEntry(int row, int col);
+
+    ID nodeChain;                    // chain+1 of a node tag, 0 if none
+    ID nodeLevel;
+};
+
+
+#endif
+
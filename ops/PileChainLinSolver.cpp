@@ -0,0 +1,51 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/pileChain/PileChainLinSolver.cpp,v $
+                                                                        
+                                                                        
+// Description: This file contains the implementation of PileChainLinSolver.
+//
+// What: "@(#) PileChainLinSolver.C, revA"
+
+#include <PileChainLinSolver.h>
+#include <PileChainLinSOE.h>
+
+PileChainLinSolver::PileChainLinSolver(int classTag)    
+:LinearSOESolver(classTag),
+ theSOE(0)
+{
+
+}    
+
+PileChainLinSolver::~PileChainLinSolver()    
+{
+
+}    
+
+int 
+PileChainLinSolver::setLinearSOE(PileChainLinSOE &thePileChainSOE)
+{
+    theSOE = &thePileChainSOE;
+    return 0;
+}
+
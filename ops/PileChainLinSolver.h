@@ -0,0 +1,56 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/pileChain/PileChainLinSolver.h,v $
+                                                                        
+                                                                        
+// Description: This file contains the class definition for PileChainLinSolver.
+// PileChainLinSolver is an abstract base class and thus no objects of it's type
+// can be instantiated. It has pure virtual functions which must be
+// implemented in it's derived classes.  Instances of PileChainLinSolver 
+// are used to solve a system of equations of type PileChainLinSOE.
+//
+// What: "@(#) PileChainLinSolver.h, revA"
+
+#ifndef PileChainLinSolver_h
+#define PileChainLinSolver_h
+
+#include <LinearSOESolver.h>
+class PileChainLinSOE;
+
+class PileChainLinSolver : public LinearSOESolver
+{
+  public:
+    PileChainLinSolver(int classTag);    
+    virtual ~PileChainLinSolver();
+
+    virtual int setLinearSOE(PileChainLinSOE &theSOE);
+    
+  protected:
+    PileChainLinSOE *theSOE;
+
+  private:
+
+};
+
+#endif
+
@@ -57,6 +57,9 @@
 #include "PySimple1.h"
 #include <Vector.h>
 #include <Channel.h>
+#include <Parameter.h>
+#include <Information.h>
+#include <string.h>
 #include <elementAPI.h>
 
 #include "qdebug.h"
@@ -885,6 +888,43 @@ PySimple1::recvSelf(int cTag, Channel &theChannel,
   return res;
 }
 
+/////////////////////////////////////////////////////////////////////
+int
+PySimple1::setParameter(const char **argv, int argc, Parameter &param)
+{
+  if (argc < 1)
+    return -1;
+
+  if (strcmp(argv[0],"pult") == 0) {
+    param.setValue(pult);
+    return param.addObject(1, this);
+  }
+  if (strcmp(argv[0],"y50") == 0) {
+    param.setValue(y50);
+    return param.addObject(2, this);
+  }
+  return -1;
+}
+
+/////////////////////////////////////////////////////////////////////
+int
+PySimple1::updateParameter(int parameterID, Information &info)
+{
+  if (parameterID == 1)
+    pult = info.theDouble;
+  else if (parameterID == 2)
+    y50 = info.theDouble;
+  else
+    return -1;
+
+  // the p-y backbone constants are formed in revertToStart(); the
+  // material restarts from its virgin state with the new parameters
+  this->revertToStart();
+  initialTangent = Ttangent;
+
+  return 0;
+}
+
 /////////////////////////////////////////////////////////////////////
 void 
 PySimple1::Print(OPS_Stream &s, int flag)
@@ -88,6 +88,9 @@ class PySimple1 : public UniaxialMaterial
     
     void Print(OPS_Stream &s, int flag =0);
 
+    int setParameter(const char **argv, int argc, Parameter &param);
+    int updateParameter(int parameterID, Information &info);
+
    
   protected:
 
@@ -55,6 +55,9 @@
 #include "QzSimple1.h"
 #include <Vector.h>
 #include <Channel.h>
+#include <Parameter.h>
+#include <Information.h>
+#include <string.h>
 
 // Controls on internal iterations between spring components
 const int QZmaxIterations = 20;
@@ -903,6 +906,43 @@ QzSimple1::recvSelf(int cTag, Channel &theChannel,
   return res;
 }
 
+/////////////////////////////////////////////////////////////////////
+int
+QzSimple1::setParameter(const char **argv, int argc, Parameter &param)
+{
+  if (argc < 1)
+    return -1;
+
+  if (strcmp(argv[0],"qult") == 0) {
+    param.setValue(Qult);
+    return param.addObject(1, this);
+  }
+  if (strcmp(argv[0],"z50") == 0) {
+    param.setValue(z50);
+    return param.addObject(2, this);
+  }
+  return -1;
+}
+
+/////////////////////////////////////////////////////////////////////
+int
+QzSimple1::updateParameter(int parameterID, Information &info)
+{
+  if (parameterID == 1)
+    Qult = info.theDouble;
+  else if (parameterID == 2)
+    z50 = info.theDouble;
+  else
+    return -1;
+
+  // the q-z backbone constants are formed in revertToStart(); the
+  // material restarts from its virgin state with the new parameters
+  this->revertToStart();
+  initialTangent = Ttangent;
+
+  return 0;
+}
+
 /////////////////////////////////////////////////////////////////////
 void 
 QzSimple1::Print(OPS_Stream &s, int flag)
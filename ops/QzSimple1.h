@@ -87,6 +87,9 @@ class QzSimple1 : public UniaxialMaterial
     
     void Print(OPS_Stream &s, int flag =0);
 
+    int setParameter(const char **argv, int argc, Parameter &param);
+    int updateParameter(int parameterID, Information &info);
+
    
   protected:
     
@@ -39,8 +39,8 @@
 #include <Node.h>
 #include <ID.h>
 
-static int numSPs = 0;
-static int nextTag = 0;
+static thread_local int numSPs = 0;
+static thread_local int nextTag = 0;
 
 int OPS_HomogeneousBC()
 {
@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/SecantLineSearch.cpp,v $
+
+
+// Description: This file contains the implementation for SecantLineSearch.
+//
+// What: "@(#)SecantLineSearch.C, revA"
+
+#include <SecantLineSearch.h>
+#include <math.h>
+
+SecantLineSearch::SecantLineSearch(double tol, int mIter, double mnEta, double mxEta, int pFlag)
+:LineSearch(LINESEARCH_TAGS_SecantLineSearch, tol, mIter, mnEta, mxEta, pFlag)
+{
+
+}
+
+SecantLineSearch::~SecantLineSearch()
+{
+
+}
+
+int
+SecantLineSearch::findEta(double s0, double s1)
+{
+  double etaPrev = 0.0, sPrev = s0;
+  double etaJ    = 1.0, sJ    = s1;
+
+  for (int count = 0; count < maxIter; count++) {
+
+    if (sJ == sPrev)
+      break;
+
+    double etaNext = etaJ - sJ*(etaJ - etaPrev)/(sJ - sPrev);
+    if (etaNext < minEta)
+      etaNext = minEta;
+    else if (etaNext > maxEta)
+      etaNext = maxEta;
+
+    // stuck at a bound
+    if (etaNext == etaJ)
+      break;
+
+    etaPrev = etaJ;
+    sPrev   = sJ;
+    etaJ    = etaNext;
+    sJ      = this->moveTo(etaJ);
+
+    if (fabs(sJ) <= tolerance*fabs(s0) || error != 0)
+      break;
+  }
+
+  return 0;
+}
+
+void
+SecantLineSearch::Print(OPS_Stream &s, int flag)
+{
+  if (flag == 0) {
+    s << "Secant Line Search - tolerance: " << tolerance << endln;
+  }
+}
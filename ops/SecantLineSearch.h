@@ -0,0 +1,52 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/SecantLineSearch.h,v $
+
+
+#ifndef SecantLineSearch_h
+#define SecantLineSearch_h
+
+// Description: This file contains the class definition for SecantLineSearch.
+// SecantLineSearch finds the root of s(eta) by secant iterations started
+// from eta = 0 and eta = 1, without bracketing.
+//
+// What: "@(#)SecantLineSearch.h, revA"
+
+#include <LineSearch.h>
+
+class SecantLineSearch: public LineSearch
+{
+  public:
+    SecantLineSearch(double tolerance = 0.8, int maxIter = 10,
+                     double minEta = 0.1, double maxEta = 10.0, int printFlag = 0);
+    ~SecantLineSearch();
+
+    void Print(OPS_Stream &s, int flag =0);
+
+  protected:
+    int findEta(double s0, double s1);
+
+  private:
+};
+
+#endif
@@ -39,8 +39,8 @@
 #include <stdlib.h>
 
 
-static int numSimulationInformation = 0;
-static SimulationInformation *theLastSimulationInformation = 0;
+static thread_local int numSimulationInformation = 0;
+static thread_local SimulationInformation *theLastSimulationInformation = 0;
 
 SimulationInformation::SimulationInformation() 
   :title(0), description(0), contactName(0),
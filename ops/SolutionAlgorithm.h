@@ -44,7 +44,7 @@ class Channel;
 class FEM_ObjectBroker;
 class Recorder;
 
-extern int SOLUTION_ALGORITHM_tangentFlag;
+extern thread_local int SOLUTION_ALGORITHM_tangentFlag;
 
 class SolutionAlgorithm: public MovableObject
 {
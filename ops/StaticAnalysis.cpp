@@ -74,7 +74,7 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
  theDOF_Numberer(&theNumberer), theAnalysisModel(&theModel), 
  theAlgorithm(&theSolnAlgo), theSOE(&theLinSOE), theEigenSOE(0),
  theIntegrator(&theStaticIntegrator), theTest(theConvergenceTest),
- domainStamp(0)
+ domainStamp(0), sizedSOE(false)
 {
     // first we set up the links needed by the elements in the 
     // aggregation
@@ -84,6 +84,7 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
 
     theIntegrator->setLinks(theModel, theLinSOE, theTest);
     theAlgorithm->setLinks(theModel, theStaticIntegrator, theLinSOE, theTest);
+    theSOE->setLinks(theModel);
 
     if (theTest != 0)
       theAlgorithm->setConvergenceTest(theTest);
@@ -423,27 +424,43 @@ StaticAnalysis::domainChanged(void)
     }	    
 
     // we invoke setSize() on the LinearSOE which
-    // causes that object to determine its size
+    // causes that object to determine its size; if the numberer
+    // found the model's connectivity unchanged the SOE keeps its 
+    // structure and storage and is only zeroed
 
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    if (sizedSOE == true && theEigenSOE == 0 &&
+	theDOF_Numberer->isNumberingReused() == true &&
+	theSOE->getNumEqn() == theAnalysisModel->getNumEqn()) {
 
-    result = theSOE->setSize(theGraph);
-    if (result < 0) {
-	opserr << "StaticAnalysis::handle() - ";
-	opserr << "LinearSOE::setSize() failed";
-	return -3;
-    }	    
+	theSOE->zeroA();
+	theSOE->zeroB();
+
+    } else {
 
-    if (theEigenSOE != 0) {
-      result = theEigenSOE->setSize(theGraph);
+      sizedSOE = false;
+
+      Graph &theGraph = theAnalysisModel->getDOFGraph();
+
+      result = theSOE->setSize(theGraph);
       if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
-	opserr << "EigenSOE::setSize() failed";
+	opserr << "LinearSOE::setSize() failed";
 	return -3;
       }	    
-    }
 
-    theAnalysisModel->clearDOFGraph();
+      if (theEigenSOE != 0) {
+	result = theEigenSOE->setSize(theGraph);
+	if (result < 0) {
+	  opserr << "StaticAnalysis::handle() - ";
+	  opserr << "EigenSOE::setSize() failed";
+	  return -3;
+	}	    
+      }
+
+      theAnalysisModel->clearDOFGraph();
+
+      sizedSOE = true;
+    }
 
     // finally we invoke domainChanged on the Integrator and Algorithm
     // objects .. informing them that the model has changed
@@ -489,6 +506,29 @@ StaticAnalysis::setSensitivityAlgorithm(Integrator *passedSensitivityAlgorithm)
 // AddingSensitivity:END ///////////////////////////////
 
 
+int 
+StaticAnalysis::setConstraintHandler(ConstraintHandler &theNewHandler) 
+{
+    // the FE_Elements and DOF_Groups of the old handler go with it
+    if (theConstraintHandler != 0) {
+	theAnalysisModel->clearAll();
+	theConstraintHandler->clearAll();
+	delete theConstraintHandler;
+    }
+
+    // set the links needed by the new handler
+    Domain *the_Domain = this->getDomainPtr();
+    theConstraintHandler = &theNewHandler;
+    theAnalysisModel->setLinks(*the_Domain, *theConstraintHandler);
+    theConstraintHandler->setLinks(*the_Domain, *theAnalysisModel, *theIntegrator);
+    sizedSOE = false;
+
+    // invoke domainChanged() either indirectly or directly
+    domainStamp = 0;
+
+    return 0;
+}
+
 int 
 StaticAnalysis::setNumberer(DOF_Numberer &theNewNumberer) 
 {
@@ -499,6 +539,7 @@ StaticAnalysis::setNumberer(DOF_Numberer &theNewNumberer)
     // first set the links needed by the Algorithm
     theDOF_Numberer = &theNewNumberer;
     theDOF_Numberer->setLinks(*theAnalysisModel);
+    sizedSOE = false;
 
     // invoke domainChanged() either indirectly or directly
     domainStamp = 0;
@@ -573,6 +614,8 @@ StaticAnalysis::setLinearSOE(LinearSOE &theNewSOE)
     if (theEigenSOE != 0) 
       theEigenSOE->setLinearSOE(*theSOE);
 
+    sizedSOE = false;
+
     // cause domainChanged to be invoked on next analyze
     /*
     if (domainStamp != 0) {
@@ -77,6 +77,7 @@ class StaticAnalysis: public Analysis
     int initialize(void);
     int domainChanged(void);
 
+    int setConstraintHandler(ConstraintHandler &theHandler);
     int setNumberer(DOF_Numberer &theNumberer);
     int setAlgorithm(EquiSolnAlgo &theAlgorithm);
     int setIntegrator(StaticIntegrator &theIntegrator);
@@ -106,6 +107,7 @@ class StaticAnalysis: public Analysis
     StaticIntegrator    *theIntegrator;
     ConvergenceTest     *theTest;
     int domainStamp;
+    bool sizedSOE;     // theSOE is sized for the current numbering
 
 #ifdef _RELIABILITY
 
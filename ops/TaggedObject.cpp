@@ -36,6 +36,7 @@
 // What: "@(#) TaggedObject.C, revA"
 
 #include "TaggedObject.h"
+#include <ObjectArena.h>
 
 TaggedObject::TaggedObject(int tag)
   :theTag(tag)
@@ -48,6 +49,18 @@ TaggedObject::~TaggedObject()
     // does nothing
 }
  
+void *
+TaggedObject::operator new(size_t size)
+{
+    return ObjectArena::allocateObject(size);
+}
+
+void
+TaggedObject::operator delete(void *p)
+{
+    ObjectArena::releaseObject(p);
+}
+
 void
 TaggedObject::setTag(int newTag) 
 {
@@ -35,10 +35,13 @@
 // Description: This file contains the class definition for TaggedObject.
 // A TaggedObject is an object with an integer identifier. It is used as
 // a base class by DomainComponent, Graph and other classes in the framework.
+// TaggedObjects are allocated through ObjectArena, so that they are taken
+// from the current arena of the thread if there is one.
 //
 // What: "@(#) TaggedObject.h, revA"
 
 #include <OPS_Stream.h>
+#include <stddef.h>
 
 class Domain;
 
@@ -48,6 +51,9 @@ class TaggedObject
     TaggedObject(int tag);
     virtual ~TaggedObject();
 
+    static void *operator new(size_t size);
+    static void operator delete(void *p);
+
     inline int getTag(void) const;
 
     virtual void Print(OPS_Stream &s, int flag =0) =0;       
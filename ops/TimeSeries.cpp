@@ -38,7 +38,7 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theTimeSeriesObjects;
+static thread_local MapOfTaggedObjects theTimeSeriesObjects;
 
 bool OPS_addTimeSeries(TimeSeries *newComponent) {
   return theTimeSeriesObjects.addComponent(newComponent);
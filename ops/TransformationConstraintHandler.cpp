@@ -472,9 +472,21 @@ TransformationConstraintHandler::enforceSPs(void)
 	theDof->enforceSPs(0);
     }
 
-    for (int j=0; j<numFE; j++) {
-      FE_Element *theEle = theFEs[j];
-      theEle->updateElement();
+    // the elements are not updated here, the TransformationFEs add the
+    // effect of the imposed displacements to their residual
+
+    return 0;
+}
+
+int 
+TransformationConstraintHandler::update(void)
+{
+    // the domain has been updated, the elements have seen the displacements
+    for (int i=1; i<=numConstrainedNodes; i++) {
+	// upward cast - safe as i put it in this location
+	TransformationDOF_Group *theDof  =
+	    (TransformationDOF_Group *)theDOFs[numDOF-i];
+	theDof->clearSP_DispIncr();
     }
 
     return 0;
@@ -35,6 +35,12 @@
 // constraining an elements node or the node; otherwise a TransformationFE
 // element and a TransformationDOF_Group are created. 
 //
+// The displacements prescribed by the SP_Constraints are imposed on the
+// nodes at the start of each step; the elements see them together with
+// the first correction, until then the TransformationFEs account for them
+// in the residual with the element tangent (as the penalty method does in
+// the first iteration), update() marks them as seen.
+//
 // What: "@(#) TransformationConstraintHandler.h, revA"
 
 #ifndef TransformationConstraintHandler_h
@@ -53,6 +59,7 @@ class TransformationConstraintHandler : public ConstraintHandler
 
     int handle(const ID *nodesNumberedLast =0);
     int applyLoad();
+    int update(void);
     void clearAll(void);    
     int enforceSPs(void);    
     int doneNumberingDOF(void);        
@@ -45,19 +45,12 @@
 #include <SP_ConstraintIter.h>
 #include <TransformationConstraintHandler.h>
 
-#define MAX_NUM_DOF 16
-
-// static variables initialisation
-Matrix **TransformationDOF_Group::modMatrices; 
-Vector **TransformationDOF_Group::modVectors;  
-int TransformationDOF_Group::numTransDOFs(0);     // number of objects
-TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
-
 TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, 
 						 MP_Constraint *mp,
 						 TransformationConstraintHandler *theTHandler)  
 :DOF_Group(tag,node),
- theMP(mp),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0)
+ theMP(mp),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0),
+ spDispIncr(0),spIncrPending(false)
 {
     // determine the number of DOF 
     int numNodalDOF = node->getNumberDOF();
@@ -119,59 +112,17 @@ TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node,
     for (int k=numConstrainedNodeRetainedDOF; k<modNumDOF; k++)
 	(*modID)(k) = -1;
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
+    // create matrices and vectors for each object instance
+    modUnbalance = new Vector(modNumDOF);
+    modTangent = new Matrix(modNumDOF, modNumDOF);
+    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||
+	modTangent == 0 || modTangent->noRows() != modNumDOF) {
 	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
-    // set the pointers for the modTangent and residual
-    if (modNumDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[modNumDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    modVectors[modNumDOF] = new Vector(modNumDOF);
-	    modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-		modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-		opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << modNumDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	modUnbalance = new Vector(modNumDOF);
-	modTangent = new Matrix(modNumDOF, modNumDOF);
-	if (modUnbalance == 0 || modTangent ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << modNumDOF << endln;
-	    exit(-1);
-	}
+	opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
+	opserr << " ran out of memory for vector/Matrix of size :";
+	opserr << modNumDOF << endln;
+	exit(-1);
     }
-    
-    numTransDOFs++;
-    theHandler = theTHandler;
 }
 
 void 
@@ -189,7 +140,8 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 						 Node *node, 
 						 TransformationConstraintHandler *theTHandler)
 :DOF_Group(tag,node),
- theMP(0),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0) 
+ theMP(0),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0),
+ spDispIncr(0),spIncrPending(false) 
 {
     modNumDOF = node->getNumberDOF();
     // create space for the SP_Constraint array
@@ -208,26 +160,6 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 	    theSPs[dof] = sp;
 	}
     }    
-    
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
-    numTransDOFs++;
-    theHandler = theTHandler;
 }
 
 
@@ -236,30 +168,13 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 
 TransformationDOF_Group::~TransformationDOF_Group()
 {
-    numTransDOFs--;
-
-    // delete modTangent and residual if created specially
-    if (modNumDOF > MAX_NUM_DOF) {
-	if (modTangent != 0) delete modTangent;
-	if (modUnbalance != 0) delete modUnbalance;
-    }
+    if (modTangent != 0) delete modTangent;
+    if (modUnbalance != 0) delete modUnbalance;
     
     if (modID != 0) delete modID;
     if (Trans != 0) delete Trans;
     if (theSPs != 0) delete [] theSPs;
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}	
-	delete [] modMatrices;
-	delete [] modVectors;
-    }    
+    if (spDispIncr != 0) delete spDispIncr;
 }    
 
 
@@ -789,40 +704,6 @@ TransformationDOF_Group::doneID(void)
 	    }
 	}
     }
-	
-    // set the pointers for the tangent and residual
-    if (modNumDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[modNumDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    modVectors[modNumDOF] = new Vector(modNumDOF);
-	    modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-		modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-		opserr << "DOF_Group::DOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << modNumDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	modUnbalance = new Vector(modNumDOF);
-	modTangent = new Matrix(modNumDOF, modNumDOF);
-	if (modUnbalance == 0 || modUnbalance->Size() ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "DOF_Group::DOF_Group(Node *) ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << modNumDOF << endln;
-	    exit(-1);
-	}
-    }    
 
     if (modID != 0) {
       for (int i=numConstrainedNodeRetainedDOF; i<modNumDOF; i++)
@@ -836,8 +717,14 @@ TransformationDOF_Group::doneID(void)
 int 
 TransformationDOF_Group::addSP_Constraint(SP_Constraint &theSP)
 {
-    // add the SP_Constraint
     int dof = theSP.getDOF_Number();
+
+    // a dof constrained by the MP_Constraint follows the retained node,
+    // which carries any fixity -- the SP_Constraint is redundant
+    if (theMP != 0 && theMP->getConstrainedDOFs().getLocation(dof) >= 0)
+	return 0;
+
+    // add the SP_Constraint
     theSPs[dof] = &theSP;
 
     // set a -1 in the correct ID location
@@ -858,11 +745,22 @@ int
 TransformationDOF_Group::enforceSPs(int doMP)
 {
   int numDof = myNode->getNumberDOF();
+
+  if (spDispIncr == 0)
+    spDispIncr = new Vector(numDof);
   
   if (doMP == 1) {
+    spDispIncr->Zero();
+    spIncrPending = false;
+
     for (int i=0; i<numDof; i++)
       if (theSPs[i] != 0) {
 	double value = theSPs[i]->getValue();
+	double incr = value - myNode->getTrialDisp()(i);
+	if (incr != 0.0) {
+	  (*spDispIncr)(i) = incr;
+	  spIncrPending = true;
+	}
 	myNode->setTrialDisp(value, i);
       }
   } 
@@ -873,20 +771,17 @@ TransformationDOF_Group::enforceSPs(int doMP)
       
       if (theMP != 0) {
 	
-	const ID &theID = this->getID();
-	
 	int retainedNode = theMP->getNodeRetained();
 	Domain *theDomain = myNode->getDomain();
 	Node *retainedNodePtr = theDomain->getNode(retainedNode);
 	const Vector &responseR = retainedNodePtr->getTrialDisp();
 	const ID &retainedDOF = theMP->getRetainedDOFs();
 	
+	// the constrained dofs follow all retained dofs, not just the ones
+	// prescribed -- the others carry the displacement of earlier steps
 	modUnbalance->Zero();    
-	for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
-	  int loc = theID(i);
-	  if (loc < 0)
-	    (*modUnbalance)(i) = responseR(retainedDOF(j));
-	}
+	for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++)
+	  (*modUnbalance)(i) = responseR(retainedDOF(j));
 	
 	Matrix *T = this->getT();
 	if (T != 0) {
@@ -897,6 +792,11 @@ TransformationDOF_Group::enforceSPs(int doMP)
 	  const ID &constrainedDOF = theMP->getConstrainedDOFs();
 	  for (int i=0; i<constrainedDOF.Size(); i++) {
 	    int cDOF = constrainedDOF(i);
+	    double incr = (*unbalance)(cDOF) - myNode->getTrialDisp()(cDOF);
+	    if (incr != 0.0) {
+	      (*spDispIncr)(cDOF) += incr;
+	      spIncrPending = true;
+	    }
 	    myNode->setTrialDisp((*unbalance)(cDOF), cDOF);
 	  }
 	}
@@ -907,6 +807,21 @@ TransformationDOF_Group::enforceSPs(int doMP)
   return 0;
 }
 
+const Vector *
+TransformationDOF_Group::getSP_DispIncr(void)
+{
+  if (spIncrPending == false)
+    return 0;
+
+  return spDispIncr;
+}
+
+void
+TransformationDOF_Group::clearSP_DispIncr(void)
+{
+  spIncrPending = false;
+}
+
 void
 TransformationDOF_Group::addM_Force(const Vector &Udotdot, double fact)
 {
@@ -34,7 +34,9 @@
 // TransformationDOF_Group. A TransformationDOF_Group object is 
 // instantiated by the TransformationConstraintHandler for 
 // every node in the domain which is constrained by an MP_Constraint
-// or an SP_Constrant.
+// or an SP_Constrant. The displacement increments imposed on the node by
+// enforceSPs() are kept, for the TransformationFEs, until the elements
+// have been updated.
 //
 // What: "@(#) TransformationDOF_Group.h, revA"
 
@@ -89,6 +91,8 @@ class TransformationDOF_Group: public DOF_Group
 
     int addSP_Constraint(SP_Constraint &theSP);
     int enforceSPs(int doMP);
+    const Vector *getSP_DispIncr(void);
+    void clearSP_DispIncr(void);
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
     void addM_ForceSensitivity(const Vector &Udotdot, double fact = 1.0);        
@@ -118,12 +122,8 @@ class TransformationDOF_Group: public DOF_Group
     int numConstrainedNodeRetainedDOF; 
     int needRetainedData;
     SP_Constraint **theSPs;
-    
-    // static variables - single copy for all objects of the class	    
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static int numTransDOFs;           // number of objects        
-    static TransformationConstraintHandler *theHandler;
+    Vector *spDispIncr;      // increments imposed by enforceSPs()
+    bool spIncrPending;      // not yet seen by the elements
 };
 
 #endif
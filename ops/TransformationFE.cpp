@@ -42,25 +42,13 @@
 #include <Vector.h>
 #include <TransformationConstraintHandler.h>
 
-#define MAX_NUM_DOF 64
-
-// static variables initialisation
-Matrix **TransformationFE::modMatrices; 
-Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
-int TransformationFE::numTransFE(0);           
-int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
-double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
-int TransformationFE::sizeBuffer(0);            
-
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
 TransformationFE::TransformationFE(int tag, Element *ele)
 :FE_Element(tag, ele), theDOFs(0), numSPs(0), theSPs(0), modID(0), 
-  modTangent(0), modResidual(0), numGroups(0), numTransformedDOF(0)
+  modTangent(0), modResidual(0), numGroups(0), numTransformedDOF(0),
+  theTransformations(0), dofData(0), dataBuffer(0), localKbuffer(0),
+  sizeBuffer(0), spResidual(0), spDispIncr(0)
 {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -95,46 +83,15 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	theDOFs[i] = theDofGroup;
     }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new one
-    if (numNodes > sizeTransformations) {
-	if (theTransformations != 0) 
-	    delete [] theTransformations;
-	
-	theTransformations = new Matrix *[numNodes];
-	if (theTransformations == 0) {
-	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
-	    opserr << "for array of pointers for Transformation matrices of size ";
-	    opserr << numNodes;
-	    exit(-1);
-	}		    
-	sizeTransformations = numNodes;
-    }	
-
-    // if this is the first element of this type create the arrays for 
-    // modified tangent and residual matrices
-    if (numTransFE == 0) {
-
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
-	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
-	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
-	    opserr << "TransformationFE::TransformationFE(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }
-
-    // increment the number of transformations
-    numTransFE++;
+    // the T matrices and number of dof of the groups, set in setID()
+    theTransformations = new Matrix *[numNodes];
+    dofData = new int[numNodes];
+    if (theTransformations == 0 || dofData == 0) {
+	opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
+	opserr << "for array of pointers for Transformation matrices of size ";
+	opserr << numNodes;
+	exit(-1);
+    }		    
 }
 
 
@@ -144,52 +101,28 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 
 TransformationFE::~TransformationFE()
 {
-
-    numTransFE--;
-    
     if (theDOFs != 0)
 	delete [] theDOFs;
     if (theSPs != 0)
 	delete [] theSPs;
-
-    int numDOF = 0;    
-    if (modID != 0)
-	numDOF = modID->Size();
-    
     if (modID != 0)
 	delete modID;
-
-    if (numDOF > MAX_NUM_DOF) {
-	// tangent and residual may have been  created specially
-	if (modTangent != 0) delete modTangent;
-	if (modResidual != 0) delete modResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransFE == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}
-	delete [] modMatrices;
-	delete [] modVectors;
+    if (modTangent != 0)
+	delete modTangent;
+    if (modResidual != 0)
+	delete modResidual;
+    if (theTransformations != 0)
 	delete [] theTransformations;
+    if (dofData != 0)
+	delete [] dofData;
+    if (dataBuffer != 0)
 	delete [] dataBuffer;
+    if (localKbuffer != 0)
 	delete [] localKbuffer;
-	delete [] dofData;
-	modMatrices = 0;
-	modVectors = 0;
-	theTransformations = 0;
-	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
-	sizeTransformations = 0;
-	sizeBuffer = 0;
-	transCounter = 0;
-    }
+    if (spResidual != 0)
+	delete spResidual;
+    if (spDispIncr != 0)
+	delete spDispIncr;
 }    
 
 
@@ -252,27 +185,11 @@ TransformationFE::setID(void)
 	    }		
     }
     
-    // set the pointers to the modified tangent matrix and residual vector
-    if (numTransformedDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[numTransformedDOF] == 0) {
-	    modVectors[numTransformedDOF] = new Vector(numTransformedDOF);
-	    modMatrices[numTransformedDOF] = new Matrix(numTransformedDOF,numTransformedDOF);
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	    if (modResidual == 0 || modResidual->Size() != numTransformedDOF ||	
-		modTangent == 0 || modTangent->noCols() != numTransformedDOF)	{  
-		opserr << "TransformationFE::setID() ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numTransformedDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
+    // create the modified tangent matrix and residual vector, and the
+    // work space for the blocks of T^t K T
+    if (modTangent == 0 || modTangent->noRows() != numTransformedDOF) {
+	if (modTangent != 0) delete modTangent;
+	if (modResidual != 0) delete modResidual;
 	modResidual = new Vector(numTransformedDOF);
 	modTangent = new Matrix(numTransformedDOF, numTransformedDOF);
 	if (modResidual == 0 || modResidual->Size() ==0 ||
@@ -285,6 +202,33 @@ TransformationFE::setID(void)
 	}
     }     
 
+    int maxBlock = 0;
+    for (int k=0; k<numGroups; k++) {
+	const Matrix *T = theDOFs[k]->getT();
+	int numDOF = theDOFs[k]->getNumDOF();
+	if (T != 0 && T->noRows() > maxBlock) maxBlock = T->noRows();
+	if (T != 0 && T->noCols() > maxBlock) maxBlock = T->noCols();
+	if (numDOF > maxBlock) maxBlock = numDOF;
+    }
+
+    int newSize = maxBlock*maxBlock;
+    if (newSize < numOriginalDOF)
+	newSize = numOriginalDOF;
+
+    if (newSize > sizeBuffer) {
+	if (dataBuffer != 0) delete [] dataBuffer;
+	if (localKbuffer != 0) delete [] localKbuffer;
+	dataBuffer = new double[newSize];
+	localKbuffer = new double[newSize];
+	if (dataBuffer == 0 || localKbuffer == 0) {
+	    opserr << "TransformationFE::setID() ";
+	    opserr << " ran out of memory for work space of size :";
+	    opserr << newSize << endln;
+	    exit(-1);
+	}
+	sizeBuffer = newSize;
+    }
+
     return 0;
 }
 
@@ -293,95 +237,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for (int a = 0; a<numNode; a++) {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if (theT != 0)
-	numDOFs[a] = theT->noRows(); // T^ 
-      else
-	numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-
-	int startCol = 0;
-	int numDOFi = numDOFs[i];	
-	int noColsOriginal = 0;
-
-	for (int j=0; j<numNode; j++) {
-
-	    const Matrix *Ti = theTransformations[i];
-	    const Matrix *Tj = theTransformations[j];
-	    int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer, numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFFER	    
-	    for (int a=0; a<numDOFi; a++)
-		for (int b=0; b<numDOFj; b++)
-		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	    // now perform the matrix computation T(i)^T localK T(j)
-	    // note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-	    
-	    if (Ti != 0 && Tj != 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	    } else if (Ti == 0 && Tj != 0) {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	    } else if (Ti != 0 && Tj == 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	    } else {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
-	    }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-	    
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
-	}
-
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
-    }
+    this->transformTangent(theTangent);
 
     return *modTangent;
 }
@@ -394,12 +250,42 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
     const Vector &theResidual = this->FE_Element::getResidual(theNewIntegrator);
     // DO THE SP STUFF TO THE TANGENT
     
+    // the displacements imposed by the SP_Constraints at the start of the
+    // step, which the element has not seen yet, enter linearised: R - K du
+    const Vector *theResponse = &theResidual;
+
+    int numNode = numGroups;
+    int pending = 0;
+    for (int a=0; a<numNode; a++)
+	if (theDOFs[a]->getSP_DispIncr() != 0)
+	    pending = 1;
+
+    if (pending == 1) {
+	if (spResidual == 0) {
+	    spResidual = new Vector(numOriginalDOF);
+	    spDispIncr = new Vector(numOriginalDOF);
+	}
+
+	int loc = 0;
+	for (int a=0; a<numNode; a++) {
+	    const Matrix *Ta = theDOFs[a]->getT();
+	    int numDOFa = (Ta != 0) ? Ta->noRows() : theDOFs[a]->getNumDOF();
+	    const Vector *du = theDOFs[a]->getSP_DispIncr();
+	    for (int b=0; b<numDOFa; b++, loc++)
+		(*spDispIncr)(loc) = (du != 0) ? (*du)(b) : 0.0;
+	}
+
+	*spResidual = theResidual;
+	const Matrix &K = this->getElement()->getTangentStiff();
+	spResidual->addMatrixVector(1.0, K, *spDispIncr, -1.0);
+	theResponse = spResidual;
+    }
+
     // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
     // where blocks are of size equal to num ele dof at a node
 
     int startRowTransformed = 0;
     int startRowOriginal = 0;
-    int numNode = numGroups;
 
     // foreach block row, for each block col do
     for (int i=0; i<numNode; i++) {
@@ -410,21 +296,10 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 	  noRows = Ti->noCols(); // T^
 	  noCols = Ti->noRows();
 
-	  /*
-	  Vector orig(noCols);
-	  Vector mod(noRows);
-	  for (int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-	    orig(k-startRowOriginal)= theResidual(k);
-	  mod = (*Ti)^orig;
-	  for (int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-	    (*modResidual)(k) = mod (k-startRowTransformed);
-
-	  */
-
 	  for (int j=0; j<noRows; j++) {
 	    double sum = 0.0;
 	    for (int k=0; k<noCols; k++)
-	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
+	      sum += (*Ti)(k,j) * (*theResponse)(startRowOriginal + k);
 	    (*modResidual)(startRowTransformed +j) = sum;
 	  }
 
@@ -432,7 +307,7 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 	  noCols = theDOFs[i]->getNumDOF();
 	  noRows = noCols;
 	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
+	    (*modResidual)(startRowTransformed +j) = (*theResponse)(startRowOriginal + j);
 	}
 	startRowTransformed += noRows;
 	startRowOriginal += noCols;
@@ -459,96 +334,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -574,96 +360,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   this->FE_Element::addKiToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -688,96 +385,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   this->FE_Element::addMtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -802,96 +410,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -916,8 +435,7 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -936,8 +454,7 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -974,6 +491,97 @@ TransformationFE::getLastResponse(void)
 }
 
 
+int
+TransformationFE::transformTangent(const Matrix &theTangent)
+{
+    ID numDOFs(dofData, numGroups);
+    
+    // get the transformation matrix from each dof group & number of local dof
+    // for original node.
+    int numNode = numGroups;
+    for (int a = 0; a<numNode; a++) {
+      Matrix *theT = theDOFs[a]->getT();
+      theTransformations[a] = theT;
+      if (theT != 0)
+	numDOFs[a] = theT->noRows(); // T^ 
+      else
+	numDOFs[a] = theDOFs[a]->getNumDOF();
+    }
+
+    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
+    // where blocks are of size equal to num ele dof at a node
+
+    int startRow = 0;
+    int noRowsTransformed = 0;
+    int noRowsOriginal = 0;
+
+    Matrix localK;
+    Matrix localTtKT;
+
+    // foreach block row, for each block col do
+    for (int i=0; i<numNode; i++) {
+
+	int startCol = 0;
+	int numDOFi = numDOFs[i];	
+	int noColsOriginal = 0;
+
+	for (int j=0; j<numNode; j++) {
+
+	    const Matrix *Ti = theTransformations[i];
+	    const Matrix *Tj = theTransformations[j];
+	    int numDOFj = numDOFs[j];	
+	    localK.setData(localKbuffer, numDOFi, numDOFj);
+
+	    // copy K(i,j) into localK matrix
+	    for (int a=0; a<numDOFi; a++)
+		for (int b=0; b<numDOFj; b++)
+		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
+
+	    // now perform the matrix computation T(i)^T localK T(j)
+	    // note: if T == 0 then the Identity is assumed
+	    int noColsTransformed = 0;
+	    
+	    if (Ti != 0 && Tj != 0) {
+		noRowsTransformed = Ti->noCols();
+		noColsTransformed = Tj->noCols();
+		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+		//localTtKT = (*Ti) ^ localK * (*Tj);
+		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
+	    } else if (Ti == 0 && Tj != 0) {
+		noRowsTransformed = numDOFi;
+		noColsTransformed = Tj->noCols();
+		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+		// localTtKT = localK * (*Tj);	       
+		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
+	    } else if (Ti != 0 && Tj == 0) {
+		noRowsTransformed = Ti->noCols();
+		noColsTransformed = numDOFj;
+		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+		//localTtKT = (*Ti) ^ localK;
+		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
+	    } else {
+		noRowsTransformed = numDOFi;
+		noColsTransformed = numDOFj;
+		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+		localTtKT = localK;
+	    }
+	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
+	    for (int c=0; c<noRowsTransformed; c++) 
+		for (int d=0; d<noColsTransformed; d++) 
+		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	    
+	    startCol += noColsTransformed;
+	    noColsOriginal += numDOFj;
+	}
+
+	noRowsOriginal += numDOFi;
+	startRow += noRowsTransformed;
+    }
+
+    return 0;
+}
+
+
 int 
 TransformationFE::transformResponse(const Vector &modResp, 
 				    Vector &unmodResp)
@@ -1019,8 +627,7 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -1039,8 +646,7 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
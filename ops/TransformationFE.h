@@ -33,6 +33,10 @@
 // Description: This file contains the class definition for TransformationFE.
 // TransformationFE objects handle MP_Constraints using the transformation
 // method T^t K T. SP_Constraints are handled by the TransformationConstraintHandler.
+// Displacements imposed by the SP_Constraints at the start of a step that
+// the element has not yet seen enter the residual linearised, R - K du.
+// Each object keeps its own tangent, residual and work space, so that
+// the elements can be formed concurrently.
 //
 // What: "@(#) TransformationFE.h, revA"
 
@@ -77,6 +81,7 @@ class TransformationFE: public FE_Element
     
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
+    int transformTangent(const Matrix &theTangent);
     
   private:
     
@@ -90,18 +95,14 @@ class TransformationFE: public FE_Element
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
-    
-    // static variables - single copy for all objects of the class	
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
-    static int numTransFE;     // number of objects    
-    static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
-    static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
-    static int sizeBuffer;
+
+    Matrix **theTransformations; // for holding pointers to the T matrices
+    int    *dofData;             // number of original dof at each group
+    double *dataBuffer;          // work space for a T^t K T block
+    double *localKbuffer;        // work space for a K block
+    int sizeBuffer;
+    Vector *spResidual;          // residual with the imposed displacements
+    Vector *spDispIncr;
 };
 
 #endif
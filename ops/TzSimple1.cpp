@@ -55,6 +55,9 @@
 #include "TzSimple1.h"
 #include <Vector.h>
 #include <Channel.h>
+#include <Parameter.h>
+#include <Information.h>
+#include <string.h>
 #include <math.h>
 #include <elementAPI.h>
 
@@ -586,6 +589,43 @@ TzSimple1::recvSelf(int cTag, Channel &theChannel,
   return res;
 }
 
+/////////////////////////////////////////////////////////////////////
+int
+TzSimple1::setParameter(const char **argv, int argc, Parameter &param)
+{
+  if (argc < 1)
+    return -1;
+
+  if (strcmp(argv[0],"tult") == 0) {
+    param.setValue(tult);
+    return param.addObject(1, this);
+  }
+  if (strcmp(argv[0],"z50") == 0) {
+    param.setValue(z50);
+    return param.addObject(2, this);
+  }
+  return -1;
+}
+
+/////////////////////////////////////////////////////////////////////
+int
+TzSimple1::updateParameter(int parameterID, Information &info)
+{
+  if (parameterID == 1)
+    tult = info.theDouble;
+  else if (parameterID == 2)
+    z50 = info.theDouble;
+  else
+    return -1;
+
+  // the t-z backbone constants are formed in revertToStart(); the
+  // material restarts from its virgin state with the new parameters
+  this->revertToStart();
+  initialTangent = Ttangent;
+
+  return 0;
+}
+
 /////////////////////////////////////////////////////////////////////
 void 
 TzSimple1::Print(OPS_Stream &s, int flag)
@@ -85,6 +85,9 @@ class TzSimple1 : public UniaxialMaterial
     
     void Print(OPS_Stream &s, int flag =0);
 
+    int setParameter(const char **argv, int argc, Parameter &param);
+    int updateParameter(int parameterID, Information &info);
+
    
   protected:
     
@@ -43,7 +43,8 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theUniaxialMaterialObjects;
+// registries of named components are per thread, like the globals in OPS_Globals.h
+static thread_local MapOfTaggedObjects theUniaxialMaterialObjects;
 
 bool OPS_addUniaxialMaterial(UniaxialMaterial *newComponent) {
   return theUniaxialMaterialObjects.addComponent(newComponent);
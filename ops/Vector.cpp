@@ -34,7 +34,9 @@
 #include "Vector.h"
 #include "Matrix.h"
 #include "ID.h"
+#include "MatrixUtil.h"
 #include <iostream>
+#include <utility>
 using std::nothrow;
 
 #include <math.h>
@@ -121,6 +123,33 @@ Vector::Vector(const Vector &other)
 }	
 
 
+// Vector(Vector &&):
+//	Constructor to take over the data of a temporary vector, which is
+//	left empty. The data of a vector that does not own it, one created
+//	with Vector(double *, int), is copied instead.
+
+Vector::Vector(Vector &&other)
+: sz(other.sz),theData(other.theData),fromFree(0)
+{
+  if (other.fromFree == 0) {
+    other.sz = 0;
+    other.theData = 0;
+    return;
+  }
+
+  theData = new (nothrow) double [sz];    
+  
+  if (theData == 0) {
+    opserr << "Vector::Vector(Vector &&) - out of memory creating vector of size " << sz << endln;
+    sz = 0;
+    return;
+  }
+
+  for (int i=0; i<sz; i++)
+    theData[i] = other.theData[i];
+}
+
+
 // ~Vector():
 // 	destructor, deletes the [] data
 
@@ -255,18 +284,9 @@ Vector::addVector(double thisFact, const Vector &other, double otherFact )
 
   if (thisFact == 1.0) {
 
-    // want: this += other * otherFact
-    double *dataPtr = theData;
-    double *otherDataPtr = other.theData;
-    if (otherFact == 1.0) { // no point doing a multiplication if otherFact == 1.0
-      for (int i=0; i<sz; i++) 
-	*dataPtr++ += *otherDataPtr++;
-    } else if (otherFact == -1.0) { // no point doing a multiplication if otherFact == 1.0
-      for (int i=0; i<sz; i++) 
-	*dataPtr++ -= *otherDataPtr++;
-    } else 
-      for (int i=0; i<sz; i++) 
-	*dataPtr++ += *otherDataPtr++ * otherFact;
+    // want: this += other * otherFact; the multiplication is exact if
+    // otherFact is 1.0 or -1.0
+    denseAxpy(sz, otherFact, other.theData, theData);
   } 
 
   else if (thisFact == 0.0) {
@@ -742,6 +762,32 @@ Vector::operator=(const Vector &V)
 }
 
 
+// Vector &operator=(Vector &&V):
+//	the move assignment operator, this takes over the data of V, which
+//	is left empty. If either vector does not own its data the data is
+//	copied as in operator=(const Vector &).
+
+Vector &
+Vector::operator=(Vector &&V) 
+{
+  if (fromFree != 0 || V.fromFree != 0)
+    return *this = static_cast<const Vector &>(V);
+
+  if (this != &V) {
+    if (sz != 0 && theData != 0)
+      delete [] theData;
+
+    sz = V.sz;
+    theData = V.theData;
+
+    V.sz = 0;
+    V.theData = 0;
+  }
+
+  return *this;
+}
+
+
 // Vector &operator+=(double fact):
 //	The += operator adds fact to each element of the vector, data[i] = data[i]+fact.
 
@@ -805,7 +851,7 @@ Vector &Vector::operator/=(double fact)
 //	are return(i) = theData[i]+fact;
 
 Vector 
-Vector::operator+(double fact) const
+Vector::operator+(double fact) const &
 {
   Vector result(*this);
   if (result.Size() != sz) 
@@ -822,7 +868,7 @@ Vector::operator+(double fact) const
 //	are return(i) = theData[i]-fact;
 
 Vector 
-Vector::operator-(double fact) const
+Vector::operator-(double fact) const &
 {
     Vector result(*this);
     if (result.Size() != sz) 
@@ -839,7 +885,7 @@ Vector::operator-(double fact) const
 //	are return(i) = theData[i]*fact;
 
 Vector 
-Vector::operator*(double fact) const
+Vector::operator*(double fact) const &
 {
     Vector result(*this);
     if (result.Size() != sz) 
@@ -855,7 +901,7 @@ Vector::operator*(double fact) const
 //	are return(i) = theData[i]/fact; Exits if divide-by-zero error.
 
 Vector 
-Vector::operator/(double fact) const
+Vector::operator/(double fact) const &
 {
     if (fact == 0.0) 
       opserr << "Vector::operator/(double fact) - divide-by-zero error coming\n";
@@ -869,6 +915,48 @@ Vector::operator/(double fact) const
 }
 
 
+// Vector operator+(double fact) &&:
+// Vector operator-(double fact) &&:
+// Vector operator*(double fact) &&:
+// Vector operator/(double fact) &&:
+//	As above, but the result is formed in the data of the temporary.
+
+Vector 
+Vector::operator+(double fact) &&
+{
+  Vector result(std::move(*this));
+  result += fact;
+  return result;
+}
+
+Vector 
+Vector::operator-(double fact) &&
+{
+  Vector result(std::move(*this));
+  result -= fact;
+  return result;
+}
+
+Vector 
+Vector::operator*(double fact) &&
+{
+  Vector result(std::move(*this));
+  result *= fact;
+  return result;
+}
+
+Vector 
+Vector::operator/(double fact) &&
+{
+  if (fact == 0.0) 
+    opserr << "Vector::operator/(double fact) - divide-by-zero error coming\n";
+
+  Vector result(std::move(*this));
+  result /= fact;
+  return result;
+}
+
+
 
 // Vector &operator+=(const Vector &V):
 //	The += operator adds V's data to data, data[i]+=V(i). A check to see if
@@ -917,7 +1005,7 @@ Vector::operator-=(const Vector &other)
 // 	Then returns a Vector whose components are the vector sum of current and V's data.
 
 Vector 
-Vector::operator+(const Vector &b) const
+Vector::operator+(const Vector &b) const &
 {
 #ifdef _G3DEBUG
   if (sz != b.sz) {
@@ -943,7 +1031,7 @@ Vector::operator+(const Vector &b) const
 //	whose components are the vector difference of current and V's data.
 
 Vector 
-Vector::operator-(const Vector &b) const
+Vector::operator-(const Vector &b) const &
 {
 #ifdef _G3DEBUG
   if (sz != b.sz) {
@@ -965,6 +1053,89 @@ Vector::operator-(const Vector &b) const
 }
 
 
+// Vector operator+(const Vector &V) &&:
+// Vector operator-(const Vector &V) &&:
+// Vector operator+(Vector &&V) const &:
+// Vector operator-(Vector &&V) const &:
+// Vector operator+(Vector &&V) &&:
+// Vector operator-(Vector &&V) &&:
+//	As above, but the result is formed in the data of a temporary
+//	operand, so that in a chain like a + b*c only b*c allocates.
+
+Vector 
+Vector::operator+(const Vector &b) &&
+{
+#ifdef _G3DEBUG
+  if (sz != b.sz) {
+    opserr << "WARNING Vector::operator+(Vector):Vectors not of same sizes: " << sz << " != " << b.sz << endln;
+    return std::move(*this);
+  }
+#endif
+
+  Vector result(std::move(*this));
+  result += b;
+  return result;
+}
+
+Vector 
+Vector::operator-(const Vector &b) &&
+{
+#ifdef _G3DEBUG
+  if (sz != b.sz) {
+    opserr << "WARNING Vector::operator-(Vector):Vectors not of same sizes: " << sz << " != " << b.sz << endln;
+    return std::move(*this);
+  }
+#endif
+
+  Vector result(std::move(*this));
+  result -= b;
+  return result;
+}
+
+Vector 
+Vector::operator+(Vector &&b) const &
+{
+#ifdef _G3DEBUG
+  if (sz != b.sz) {
+    opserr << "WARNING Vector::operator+(Vector):Vectors not of same sizes: " << sz << " != " << b.sz << endln;
+    return *this;
+  }
+#endif
+
+  Vector result(std::move(b));
+  result += *this;
+  return result;
+}
+
+Vector 
+Vector::operator-(Vector &&b) const &
+{
+#ifdef _G3DEBUG
+  if (sz != b.sz) {
+    opserr << "WARNING Vector::operator-(Vector):Vectors not of same sizes: " << sz << " != " << b.sz << endln;
+    return *this;
+  }
+#endif
+
+  Vector result(std::move(b));
+  for (int i=0; i<sz; i++)
+    result.theData[i] = theData[i] - result.theData[i];
+  return result;
+}
+
+Vector 
+Vector::operator+(Vector &&b) &&
+{
+  return std::move(*this) + static_cast<const Vector &>(b);
+}
+
+Vector 
+Vector::operator-(Vector &&b) &&
+{
+  return std::move(*this) - static_cast<const Vector &>(b);
+}
+
+
 
 // double operator^(const Vector &V) const;
 //	Method to perform (Vector)transposed * vector.
@@ -1117,6 +1288,12 @@ Vector operator*(double a, const Vector &V)
 }
 
 
+Vector operator*(double a, Vector &&V)
+{
+  return std::move(V) * a;
+}
+
+
 int
 Vector::Assemble(const Vector &V, int init_pos, double fact) 
 {
@@ -48,6 +48,7 @@ class Vector
     Vector();
     Vector(int);
     Vector(const Vector &);    
+    Vector(Vector &&);
     Vector(double *data, int size);
     ~Vector();
 
@@ -73,22 +74,35 @@ class Vector
     double &operator[](int x);
     Vector operator()(const ID &rows) const;
     Vector &operator=(const Vector  &V);
+    Vector &operator=(Vector &&V);
     
     Vector &operator+=(double fact);
     Vector &operator-=(double fact);
     Vector &operator*=(double fact);
     Vector &operator/=(double fact); 
 
-    Vector operator+(double fact) const;
-    Vector operator-(double fact) const;
-    Vector operator*(double fact) const;
-    Vector operator/(double fact) const;
+    // the && versions work in the storage of a temporary operand
+    // instead of allocating a new Vector
+    Vector operator+(double fact) const &;
+    Vector operator-(double fact) const &;
+    Vector operator*(double fact) const &;
+    Vector operator/(double fact) const &;
+    Vector operator+(double fact) &&;
+    Vector operator-(double fact) &&;
+    Vector operator*(double fact) &&;
+    Vector operator/(double fact) &&;
     
     Vector &operator+=(const Vector &V);
     Vector &operator-=(const Vector &V);
     
-    Vector operator+(const Vector &V) const;
-    Vector operator-(const Vector &V) const;
+    Vector operator+(const Vector &V) const &;
+    Vector operator-(const Vector &V) const &;
+    Vector operator+(const Vector &V) &&;
+    Vector operator-(const Vector &V) &&;
+    Vector operator+(Vector &&V) const &;
+    Vector operator-(Vector &&V) const &;
+    Vector operator+(Vector &&V) &&;
+    Vector operator-(Vector &&V) &&;
     double operator^(const Vector &V) const;
     Vector operator/(const Matrix &M) const;
 
@@ -108,6 +122,7 @@ class Vector
     friend QTextStream &operator<<(QTextStream &s, const Vector &V);
     // friend istream &operator>>(istream &s, Vector &V);    
     friend Vector operator*(double a, const Vector &V);
+    friend Vector operator*(double a, Vector &&V);
     
     friend class Message;
     friend class SystemOfEqn;
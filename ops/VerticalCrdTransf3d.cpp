@@ -0,0 +1,521 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// $Revision: 1.1 $
+// $Date: 2018-07-09 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/coordTransformation/VerticalCrdTransf3d.cpp,v $
+
+
+// Purpose: This file contains the implementation for the
+// VerticalCrdTransf3d class. All transformations between the
+// global and local systems are gathers and scatters with the
+// permutation and signs found in initialize(); the local and
+// basic systems are related as in LinearCrdTransf3d.
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <Node.h>
+#include <Channel.h>
+#include <classTags.h>
+#include <VerticalCrdTransf3d.h>
+
+#include <math.h>
+
+// initialize static variables
+thread_local FixedMatrix<12,12> VerticalCrdTransf3d::kg;
+
+
+// constructor:
+VerticalCrdTransf3d::VerticalCrdTransf3d(int tag, const Vector &vecInLocXZPlane):
+CrdTransf(tag, CRDTR_TAG_VerticalCrdTransf3d),
+nodeIPtr(0), nodeJPtr(0), L(0)
+{
+    for (int i = 0; i < 3; i++) {
+        vecXZ[i] = vecInLocXZPlane(i);
+        axis[i] = i;
+        sign[i] = 0.0;
+    }
+}
+
+
+// constructor:
+// invoked by a FEM_ObjectBroker, recvSelf() needs to be invoked on this object.
+VerticalCrdTransf3d::VerticalCrdTransf3d():
+CrdTransf(0, CRDTR_TAG_VerticalCrdTransf3d),
+nodeIPtr(0), nodeJPtr(0), L(0)
+{
+    for (int i = 0; i < 3; i++) {
+        vecXZ[i] = 0.0;
+        axis[i] = i;
+        sign[i] = 0.0;
+    }
+}
+
+
+// destructor:
+VerticalCrdTransf3d::~VerticalCrdTransf3d()
+{
+
+}
+
+
+int
+VerticalCrdTransf3d::commitState(void)
+{
+    return 0;
+}
+
+
+int
+VerticalCrdTransf3d::revertToLastCommit(void)
+{
+    return 0;
+}
+
+
+int
+VerticalCrdTransf3d::revertToStart(void)
+{
+    return 0;
+}
+
+
+int
+VerticalCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
+{
+    nodeIPtr = nodeIPointer;
+    nodeJPtr = nodeJPointer;
+
+    if ((!nodeIPtr) || (!nodeJPtr))
+    {
+        opserr << "\nVerticalCrdTransf3d::initialize";
+        opserr << "\ninvalid pointers to the element nodes\n";
+        return -1;
+    }
+
+    const Vector &ndICoords = nodeIPtr->getCrds();
+    const Vector &ndJCoords = nodeJPtr->getCrds();
+
+    double dx = ndJCoords(0) - ndICoords(0);
+    double dy = ndJCoords(1) - ndICoords(1);
+    double dz = ndJCoords(2) - ndICoords(2);
+
+    // calculate the element length
+    L = sqrt(dx*dx + dy*dy + dz*dz);
+
+    if (L == 0.0) {
+        opserr << "\nVerticalCrdTransf3d::initialize: 0 length\n";
+        return -2;
+    }
+
+    const double tol = 1.0e-8;
+
+    if (fabs(dx) > tol*L || fabs(dy) > tol*L) {
+        opserr << "\nVerticalCrdTransf3d::initialize";
+        opserr << "\nelement is not parallel to the global Z axis\n";
+        return -2;
+    }
+
+    // the vector in the x-z plane must lie along the global X or Y axis
+    int v;
+    if (fabs(vecXZ[1]) <= tol*fabs(vecXZ[0]) && fabs(vecXZ[2]) <= tol*fabs(vecXZ[0]))
+        v = 0;
+    else if (fabs(vecXZ[0]) <= tol*fabs(vecXZ[1]) && fabs(vecXZ[2]) <= tol*fabs(vecXZ[1]))
+        v = 1;
+    else {
+        opserr << "\nVerticalCrdTransf3d::initialize";
+        opserr << "\nvector v that defines plane xz is not along the global X or Y axis\n";
+        return -3;
+    }
+
+    double sx = (dz > 0.0) ? 1.0 : -1.0;
+    double sv = (vecXZ[v] > 0.0) ? 1.0 : -1.0;
+
+    // x = sx*Z, y = v cross x, z = x cross y
+    axis[0] = 2;
+    sign[0] = sx;
+
+    if (v == 0) {
+        axis[1] = 1;
+        sign[1] = -sv*sx;
+    } else {
+        axis[1] = 0;
+        sign[1] =  sv*sx;
+    }
+
+    axis[2] = v;
+    sign[2] = sv;
+
+    return 0;
+}
+
+
+int
+VerticalCrdTransf3d::update(void)
+{
+    return 0;
+}
+
+
+int
+VerticalCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
+{
+    XAxis.Zero();
+    YAxis.Zero();
+    ZAxis.Zero();
+
+    XAxis(axis[0]) = sign[0];
+    YAxis(axis[1]) = sign[1];
+    ZAxis(axis[2]) = sign[2];
+
+    return 0;
+}
+
+
+double
+VerticalCrdTransf3d::getInitialLength(void)
+{
+    return L;
+}
+
+
+double
+VerticalCrdTransf3d::getDeformedLength(void)
+{
+    return L;
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getBasicFromGlobal(const Vector &disp1, const Vector &disp2)
+{
+    static thread_local double ul[12];
+
+    // gather the local displacements
+    for (int a = 0; a < 3; a++) {
+        ul[a]   = sign[a]*disp1(axis[a]);
+        ul[a+3] = sign[a]*disp1(axis[a]+3);
+        ul[a+6] = sign[a]*disp2(axis[a]);
+        ul[a+9] = sign[a]*disp2(axis[a]+3);
+    }
+
+    double oneOverL = 1.0/L;
+
+    static thread_local FixedVector<6> ub;
+
+    ub(0) = ul[6] - ul[0];
+    double tmp;
+    tmp = oneOverL*(ul[1]-ul[7]);
+    ub(1) = ul[5] + tmp;
+    ub(2) = ul[11] + tmp;
+    tmp = oneOverL*(ul[8]-ul[2]);
+    ub(3) = ul[4] + tmp;
+    ub(4) = ul[10] + tmp;
+    ub(5) = ul[9] - ul[3];
+
+    return ub;
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getBasicTrialDisp(void)
+{
+    return this->getBasicFromGlobal(nodeIPtr->getTrialDisp(), nodeJPtr->getTrialDisp());
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getBasicIncrDisp(void)
+{
+    return this->getBasicFromGlobal(nodeIPtr->getIncrDisp(), nodeJPtr->getIncrDisp());
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getBasicIncrDeltaDisp(void)
+{
+    return this->getBasicFromGlobal(nodeIPtr->getIncrDeltaDisp(), nodeJPtr->getIncrDeltaDisp());
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getBasicTrialVel(void)
+{
+    return this->getBasicFromGlobal(nodeIPtr->getTrialVel(), nodeJPtr->getTrialVel());
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getBasicTrialAccel(void)
+{
+    return this->getBasicFromGlobal(nodeIPtr->getTrialAccel(), nodeJPtr->getTrialAccel());
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
+{
+    // transform resisting forces from the basic system to local coordinates
+    static thread_local double pl[12];
+
+    double q0 = pb(0);
+    double q1 = pb(1);
+    double q2 = pb(2);
+    double q3 = pb(3);
+    double q4 = pb(4);
+    double q5 = pb(5);
+
+    double oneOverL = 1.0/L;
+
+    pl[0]  = -q0;
+    pl[1]  =  oneOverL*(q1+q2);
+    pl[2]  = -oneOverL*(q3+q4);
+    pl[3]  = -q5;
+    pl[4]  =  q3;
+    pl[5]  =  q1;
+    pl[6]  =  q0;
+    pl[7]  = -pl[1];
+    pl[8]  = -pl[2];
+    pl[9]  =  q5;
+    pl[10] =  q4;
+    pl[11] =  q2;
+
+    pl[0] += p0(0);
+    pl[1] += p0(1);
+    pl[7] += p0(2);
+    pl[2] += p0(3);
+    pl[8] += p0(4);
+
+    // scatter the resisting forces to global coordinates
+    static thread_local FixedVector<12> pg;
+
+    for (int a = 0; a < 3; a++) {
+        pg(axis[a])   = sign[a]*pl[a];
+        pg(axis[a]+3) = sign[a]*pl[a+3];
+        pg(axis[a]+6) = sign[a]*pl[a+6];
+        pg(axis[a]+9) = sign[a]*pl[a+9];
+    }
+
+    return pg;
+}
+
+
+const Matrix &
+VerticalCrdTransf3d::getGlobalMatrixFromBasic(const Matrix &KB)
+{
+    static thread_local double kb[6][6];		// Basic stiffness
+    static thread_local double tmp[6][12];	// Temporary storage
+    static thread_local FixedMatrix<12,12> kl;	// Local stiffness
+    double oneOverL = 1.0/L;
+
+    int i,j;
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 6; j++)
+            kb[i][j] = KB(i,j);
+
+    // Transform basic stiffness to local system
+    // First compute kb*T_{bl}
+    for (i = 0; i < 6; i++) {
+        tmp[i][0]  = -kb[i][0];
+        tmp[i][1]  =  oneOverL*(kb[i][1]+kb[i][2]);
+        tmp[i][2]  = -oneOverL*(kb[i][3]+kb[i][4]);
+        tmp[i][3]  = -kb[i][5];
+        tmp[i][4]  =  kb[i][3];
+        tmp[i][5]  =  kb[i][1];
+        tmp[i][6]  =  kb[i][0];
+        tmp[i][7]  = -tmp[i][1];
+        tmp[i][8]  = -tmp[i][2];
+        tmp[i][9]  =  kb[i][5];
+        tmp[i][10] =  kb[i][4];
+        tmp[i][11] =  kb[i][2];
+    }
+
+    // Now compute T'_{bl}*(kb*T_{bl})
+    for (i = 0; i < 12; i++) {
+        kl(0,i)  = -tmp[0][i];
+        kl(1,i)  =  oneOverL*(tmp[1][i]+tmp[2][i]);
+        kl(2,i)  = -oneOverL*(tmp[3][i]+tmp[4][i]);
+        kl(3,i)  = -tmp[5][i];
+        kl(4,i)  =  tmp[3][i];
+        kl(5,i)  =  tmp[1][i];
+        kl(6,i)  =  tmp[0][i];
+        kl(7,i)  = -kl(1,i);
+        kl(8,i)  = -kl(2,i);
+        kl(9,i)  =  tmp[5][i];
+        kl(10,i) =  tmp[4][i];
+        kl(11,i) =  tmp[2][i];
+    }
+
+    return this->getGlobalMatrixFromLocal(kl);
+}
+
+
+const Matrix &
+VerticalCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
+{
+    return this->getGlobalMatrixFromBasic(KB);
+}
+
+
+const Matrix &
+VerticalCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
+{
+    return this->getGlobalMatrixFromBasic(KB);
+}
+
+
+const Matrix &
+VerticalCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
+{
+    // global dof of each local dof and its sign
+    int    g[12];
+    double s[12];
+    for (int k = 0; k < 12; k += 3)
+        for (int a = 0; a < 3; a++) {
+            g[k+a] = k + axis[a];
+            s[k+a] = sign[a];
+        }
+
+    // kg = T_{lg}'*ml*T_{lg} is a signed permutation of ml
+    for (int j = 0; j < 12; j++) {
+        int gj = g[j];
+        double sj = s[j];
+        for (int i = 0; i < 12; i++)
+            kg(g[i],gj) = s[i]*sj*ml(i,j);
+    }
+
+    return kg;
+}
+
+
+CrdTransf *
+VerticalCrdTransf3d::getCopy3d(void)
+{
+    Vector xz(3);
+    xz(0) = vecXZ[0];
+    xz(1) = vecXZ[1];
+    xz(2) = vecXZ[2];
+
+    VerticalCrdTransf3d *theCopy = new VerticalCrdTransf3d(this->getTag(), xz);
+
+    theCopy->nodeIPtr = nodeIPtr;
+    theCopy->nodeJPtr = nodeJPtr;
+    theCopy->L = L;
+    for (int i = 0; i < 3; i++) {
+        theCopy->axis[i] = axis[i];
+        theCopy->sign[i] = sign[i];
+    }
+
+    return theCopy;
+}
+
+
+int
+VerticalCrdTransf3d::sendSelf(int cTag, Channel &theChannel)
+{
+    int res = 0;
+
+    static thread_local Vector data(5);
+    data(0) = this->getTag();
+    data(1) = L;
+    data(2) = vecXZ[0];
+    data(3) = vecXZ[1];
+    data(4) = vecXZ[2];
+
+    res += theChannel.sendVector(this->getDbTag(), cTag, data);
+    if (res < 0) {
+        opserr << "VerticalCrdTransf3d::sendSelf - failed to send Vector\n";
+
+        return res;
+    }
+
+    return res;
+}
+
+
+int
+VerticalCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    int res = 0;
+
+    static thread_local Vector data(5);
+
+    res += theChannel.recvVector(this->getDbTag(), cTag, data);
+    if (res < 0) {
+        opserr << "VerticalCrdTransf3d::recvSelf - failed to receive Vector\n";
+
+        return res;
+    }
+
+    this->setTag((int)data(0));
+    L = data(1);
+    vecXZ[0] = data(2);
+    vecXZ[1] = data(3);
+    vecXZ[2] = data(4);
+
+    return res;
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
+{
+    static thread_local Vector xg(3);
+
+    xg = nodeIPtr->getCrds();
+
+    // xg = xg + Rlj'*xl
+    for (int a = 0; a < 3; a++)
+        xg(axis[a]) += sign[a]*xl(a);
+
+    return xg;
+}
+
+
+const Vector &
+VerticalCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
+{
+    // determine global displacements
+    const Vector &disp1 = nodeIPtr->getTrialDisp();
+    const Vector &disp2 = nodeJPtr->getTrialDisp();
+
+    // compute displacements at point xi, in local coordinates
+    static thread_local double uxl[3];
+    static thread_local Vector uxg(3);
+
+    uxl[0] = uxb(0) + sign[0]*disp1(axis[0]);
+    uxl[1] = uxb(1) + (1-xi)*sign[1]*disp1(axis[1]) + xi*sign[1]*disp2(axis[1]);
+    uxl[2] = uxb(2) + (1-xi)*sign[2]*disp1(axis[2]) + xi*sign[2]*disp2(axis[2]);
+
+    // rotate displacements to global coordinates
+    for (int a = 0; a < 3; a++)
+        uxg(axis[a]) = sign[a]*uxl[a];
+
+    return uxg;
+}
+
+
+void
+VerticalCrdTransf3d::Print(OPS_Stream &s, int flag)
+{
+    s << "\nCrdTransf: " << this->getTag() << " Type: VerticalCrdTransf3d";
+    s << "\tvecxz: " << vecXZ[0] << " " << vecXZ[1] << " " << vecXZ[2] << endln;
+}
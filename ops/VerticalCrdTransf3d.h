@@ -0,0 +1,106 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-07-09 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/coordTransformation/VerticalCrdTransf3d.h,v $
+
+// Description: This file contains the class definition for
+// VerticalCrdTransf3d.h. VerticalCrdTransf3d is the linear
+// transformation of LinearCrdTransf3d restricted to members along
+// the global Z axis whose vector in the local x-z plane lies along
+// the global X or Y axis.  Each local axis is then a global axis,
+// possibly reversed, and the rotation reduces to a fixed permutation
+// and sign pattern of the dofs that is set up by initialize().  There
+// are no rigid joint offsets and no initial displacements.
+
+// What: "@(#) VerticalCrdTransf3d.h, revA"
+
+#ifndef VerticalCrdTransf3d_h
+#define VerticalCrdTransf3d_h
+
+#include <CrdTransf.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <FixedMatrix.h>
+
+class VerticalCrdTransf3d: public CrdTransf
+{
+public:
+    VerticalCrdTransf3d(int tag, const Vector &vecInLocXZPlane);
+
+    VerticalCrdTransf3d();
+    ~VerticalCrdTransf3d();
+
+    const char *getClassType() const {return "VerticalCrdTransf3d";};
+
+    int initialize(Node *node1Pointer, Node *node2Pointer);
+    int update(void);
+    double getInitialLength(void);
+    double getDeformedLength(void);
+
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+
+    const Vector &getBasicTrialDisp(void);
+    const Vector &getBasicIncrDisp(void);
+    const Vector &getBasicIncrDeltaDisp(void);
+    const Vector &getBasicTrialVel(void);
+    const Vector &getBasicTrialAccel(void);
+
+    const Vector &getGlobalResistingForce(const Vector &basicForce, const Vector &p0);
+    const Matrix &getGlobalStiffMatrix(const Matrix &basicStiff, const Vector &basicForce);
+    const Matrix &getInitialGlobalStiffMatrix(const Matrix &basicStiff);
+
+    CrdTransf *getCopy3d(void);
+
+    int sendSelf(int cTag, Channel &theChannel);
+    int recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+    // method used to rotate consistent mass matrix
+    const Matrix &getGlobalMatrixFromLocal(const Matrix &local);
+
+    // methods used in post-processing only
+    const Vector &getPointGlobalCoordFromLocal(const Vector &localCoords);
+    const Vector &getPointGlobalDisplFromBasic(double xi, const Vector &basicDisps);
+
+    int getLocalAxes(Vector &xAxis, Vector &yAxis, Vector &zAxis);
+
+private:
+    const Vector &getBasicFromGlobal(const Vector &disp1, const Vector &disp2);
+    const Matrix &getGlobalMatrixFromBasic(const Matrix &KB);
+
+    // internal data
+    Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
+
+    double vecXZ[3];            // vector in the local x-z plane
+    double L;                   // undeformed element length
+
+    // local dof 3*k+a is global dof 3*k+axis[a] times sign[a]
+    int axis[3];
+    double sign[3];
+
+    static thread_local FixedMatrix<12,12> kg;   // global stiffness matrix
+};
+
+#endif
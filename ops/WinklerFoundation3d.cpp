@@ -0,0 +1,645 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/winkler/WinklerFoundation3d.cpp,v $
+
+
+// Description: This file contains the implementation for the WinklerFoundation3d class.
+//
+// What: "@(#) WinklerFoundation3d.C, revA"
+
+#include <WinklerFoundation3d.h>
+#include <GroundDisplacement.h>
+#include <LegendreBeamIntegration.h>
+#include <Information.h>
+#include <ElementResponse.h>
+
+#include <Domain.h>
+#include <Node.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <UniaxialMaterial.h>
+#include <classTags.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// the element dofs the p-y materials (u_x, theta_y) and t-z materials (u_z) act on
+static const int pyDOF[4] = {0, 4, 6, 10};
+static const int tzDOF[2] = {2, 8};
+
+WinklerFoundation3d::WinklerFoundation3d(int tag, int nd1, int nd2, int numPts,
+					 UniaxialMaterial **pyMat, UniaxialMaterial **tzMat)
+ :Element(tag, ELE_TAG_WinklerFoundation3d),
+  connectedExternalNodes(2),
+  numPoints(numPts), theMaterials(0),
+  groundDisp(2*numPts), trialDeformation(2*numPts)
+{
+    connectedExternalNodes(0) = nd1;
+    connectedExternalNodes(1) = nd2;
+    theNodes[0] = 0;
+    theNodes[1] = 0;
+
+    if (numPoints < 1 || numPoints > maxNumPoints) {
+      opserr << "FATAL WinklerFoundation3d::WinklerFoundation3d - " << numPoints;
+      opserr << " integration points, must be 1 to " << maxNumPoints << endln;
+      exit(-1);
+    }
+
+    // get a copy of the material objects and check we obtained a valid copy
+    theMaterials = new UniaxialMaterial *[2*numPoints];
+    for (int i=0; i<numPoints; i++) {
+      theMaterials[i] = pyMat[i]->getCopy();
+      theMaterials[numPoints+i] = tzMat[i]->getCopy();
+      if (theMaterials[i] == 0 || theMaterials[numPoints+i] == 0) {
+	opserr << "FATAL WinklerFoundation3d::WinklerFoundation3d - failed to get a copy of the materials at point " << i+1 << endln;
+	exit(-1);
+      }
+    }
+
+    for (int i=0; i<maxNumPoints; i++) {
+      Npy[i][0] = Npy[i][1] = Npy[i][2] = Npy[i][3] = 0.0;
+      Ntz[i][0] = Ntz[i][1] = 0.0;
+    }
+}
+
+WinklerFoundation3d::WinklerFoundation3d()
+ :Element(0, ELE_TAG_WinklerFoundation3d),
+  connectedExternalNodes(2),
+  numPoints(0), theMaterials(0),
+  groundDisp(0), trialDeformation(0)
+{
+    theNodes[0] = 0;
+    theNodes[1] = 0;
+}
+
+WinklerFoundation3d::~WinklerFoundation3d()
+{
+    for (int i=0; i<2*numPoints; i++)
+      if (theMaterials[i] != 0)
+	delete theMaterials[i];
+
+    if (theMaterials != 0)
+      delete [] theMaterials;
+}
+
+int
+WinklerFoundation3d::getNumExternalNodes(void) const
+{
+    return 2;
+}
+
+const ID &
+WinklerFoundation3d::getExternalNodes(void)
+{
+    return connectedExternalNodes;
+}
+
+Node **
+WinklerFoundation3d::getNodePtrs(void)
+{
+    return theNodes;
+}
+
+int
+WinklerFoundation3d::getNumDOF(void)
+{
+    return 12;
+}
+
+void
+WinklerFoundation3d::setDomain(Domain *theDomain)
+{
+    // check Domain is not null - invoked when object removed from a domain
+    if (theDomain == 0) {
+      theNodes[0] = 0;
+      theNodes[1] = 0;
+      return;
+    }
+
+    for (int i=0; i<2; i++) {
+      theNodes[i] = theDomain->getNode(connectedExternalNodes(i));
+      if (theNodes[i] == 0) {
+	opserr << "WARNING WinklerFoundation3d::setDomain() - node " << connectedExternalNodes(i);
+	opserr << " does not exist in model for WinklerFoundation3d ele: " << this->getTag() << endln;
+	return;
+      }
+      if (theNodes[i]->getNumberDOF() != 6) {
+	opserr << "WARNING WinklerFoundation3d::setDomain() - node " << connectedExternalNodes(i);
+	opserr << " does not have 6 dof, WinklerFoundation3d ele: " << this->getTag() << endln;
+	theNodes[i] = 0;
+	return;
+      }
+    }
+
+    const Vector &crdI = theNodes[0]->getCrds();
+    const Vector &crdJ = theNodes[1]->getCrds();
+    if (fabs(crdJ(0)-crdI(0)) > 1.0e-8*fabs(crdJ(2)-crdI(2)) ||
+	fabs(crdJ(1)-crdI(1)) > 1.0e-8*fabs(crdJ(2)-crdI(2)) || crdJ(2) == crdI(2))
+      opserr << "WARNING WinklerFoundation3d::setDomain() - element " << this->getTag() << " is not vertical\n";
+
+    this->computeShapeFunctions();
+
+    // call the base class method
+    this->DomainComponent::setDomain(theDomain);
+
+    this->update();
+}
+
+void
+WinklerFoundation3d::getPointLocations(int numPts, double *xi)
+{
+    LegendreBeamIntegration theIntegration;
+    theIntegration.getSectionLocations(numPts, 1.0, xi);
+}
+
+void
+WinklerFoundation3d::getPointWeights(int numPts, double *wt)
+{
+    LegendreBeamIntegration theIntegration;
+    theIntegration.getSectionWeights(numPts, 1.0, wt);
+}
+
+void
+WinklerFoundation3d::computeShapeFunctions(void)
+{
+    // signed length along the global z-axis: the rotation about y
+    // is the derivative of u_x with respect to z
+    double L = theNodes[1]->getCrds()(2) - theNodes[0]->getCrds()(2);
+
+    double xi[maxNumPoints];
+    getPointLocations(numPoints, xi);
+
+    for (int i=0; i<numPoints; i++) {
+      double s  = xi[i];
+      double s2 = s*s;
+      double s3 = s2*s;
+
+      Npy[i][0] = 1.0 - 3.0*s2 + 2.0*s3;
+      Npy[i][1] = L*(s - 2.0*s2 + s3);
+      Npy[i][2] = 3.0*s2 - 2.0*s3;
+      Npy[i][3] = L*(s3 - s2);
+
+      Ntz[i][0] = 1.0 - s;
+      Ntz[i][1] = s;
+    }
+}
+
+void
+WinklerFoundation3d::computeDeformations(Vector &def)
+{
+    const Vector &dispI = theNodes[0]->getTrialDisp();
+    const Vector &dispJ = theNodes[1]->getTrialDisp();
+
+    double u[12];
+    for (int k=0; k<6; k++) {
+      u[k]   = dispI(k);
+      u[k+6] = dispJ(k);
+    }
+
+    for (int i=0; i<numPoints; i++) {
+      def(i) = Npy[i][0]*u[pyDOF[0]] + Npy[i][1]*u[pyDOF[1]]
+	     + Npy[i][2]*u[pyDOF[2]] + Npy[i][3]*u[pyDOF[3]] - groundDisp(i);
+      def(numPoints+i) = Ntz[i][0]*u[tzDOF[0]] + Ntz[i][1]*u[tzDOF[1]] - groundDisp(numPoints+i);
+    }
+}
+
+int
+WinklerFoundation3d::commitState(void)
+{
+    int code = 0;
+
+    // call element commitState to do any base class stuff
+    if ((code = this->Element::commitState()) != 0) {
+      opserr << "WinklerFoundation3d::commitState () - failed in base class";
+    }
+
+    for (int i=0; i<2*numPoints; i++)
+      code += theMaterials[i]->commitState();
+
+    return code;
+}
+
+int
+WinklerFoundation3d::revertToLastCommit(void)
+{
+    int code = 0;
+
+    for (int i=0; i<2*numPoints; i++)
+      code += theMaterials[i]->revertToLastCommit();
+
+    return code;
+}
+
+int
+WinklerFoundation3d::revertToStart(void)
+{
+    int code = 0;
+
+    for (int i=0; i<2*numPoints; i++)
+      code += theMaterials[i]->revertToStart();
+
+    trialDeformation.Zero();
+
+    return code;
+}
+
+int
+WinklerFoundation3d::update(void)
+{
+    this->computeDeformations(trialDeformation);
+
+    int ret = 0;
+    for (int i=0; i<2*numPoints; i++)
+      ret += theMaterials[i]->setTrialStrain(trialDeformation(i));
+
+    return ret;
+}
+
+const Matrix &
+WinklerFoundation3d::getTangentStiff(void)
+{
+    K.Zero();
+
+    for (int i=0; i<numPoints; i++) {
+      double kpy = theMaterials[i]->getTangent();
+      for (int a=0; a<4; a++)
+	for (int b=0; b<4; b++)
+	  K(pyDOF[a], pyDOF[b]) += Npy[i][a]*kpy*Npy[i][b];
+
+      double ktz = theMaterials[numPoints+i]->getTangent();
+      for (int a=0; a<2; a++)
+	for (int b=0; b<2; b++)
+	  K(tzDOF[a], tzDOF[b]) += Ntz[i][a]*ktz*Ntz[i][b];
+    }
+
+    return K;
+}
+
+const Matrix &
+WinklerFoundation3d::getInitialStiff(void)
+{
+    K.Zero();
+
+    for (int i=0; i<numPoints; i++) {
+      double kpy = theMaterials[i]->getInitialTangent();
+      for (int a=0; a<4; a++)
+	for (int b=0; b<4; b++)
+	  K(pyDOF[a], pyDOF[b]) += Npy[i][a]*kpy*Npy[i][b];
+
+      double ktz = theMaterials[numPoints+i]->getInitialTangent();
+      for (int a=0; a<2; a++)
+	for (int b=0; b<2; b++)
+	  K(tzDOF[a], tzDOF[b]) += Ntz[i][a]*ktz*Ntz[i][b];
+    }
+
+    return K;
+}
+
+const Matrix &
+WinklerFoundation3d::getMass(void)
+{
+    // no mass
+    K.Zero();
+    return K;
+}
+
+void
+WinklerFoundation3d::zeroLoad(void)
+{
+    groundDisp.Zero();
+}
+
+int
+WinklerFoundation3d::addLoad(ElementalLoad *theLoad, double loadFactor)
+{
+    int type;
+    const Vector &data = theLoad->getData(type, loadFactor);
+
+    if (type != LOAD_TAG_GroundDisplacement || data.Size() != 2*numPoints) {
+      opserr << "WinklerFoundation3d::addLoad - load type unknown for element with tag: " << this->getTag() << endln;
+      return -1;
+    }
+
+    groundDisp.addVector(1.0, data, loadFactor);
+
+    return 0;
+}
+
+int
+WinklerFoundation3d::addInertiaLoadToUnbalance(const Vector &accel)
+{
+    // does nothing as element has no mass
+    return 0;
+}
+
+const Vector &
+WinklerFoundation3d::getResistingForce(void)
+{
+    P.Zero();
+
+    // the materials hold the state at trialDeformation; a ground displacement
+    // applied since then is added with the tangent until the next update()
+    static thread_local Vector def(2*maxNumPoints);
+    this->computeDeformations(def);
+
+    for (int i=0; i<numPoints; i++) {
+      UniaxialMaterial *pyMat = theMaterials[i];
+      double p = pyMat->getStress() + pyMat->getTangent()*(def(i) - trialDeformation(i));
+      for (int a=0; a<4; a++)
+	P(pyDOF[a]) += Npy[i][a]*p;
+
+      UniaxialMaterial *tzMat = theMaterials[numPoints+i];
+      double t = tzMat->getStress() + tzMat->getTangent()*(def(numPoints+i) - trialDeformation(numPoints+i));
+      for (int a=0; a<2; a++)
+	P(tzDOF[a]) += Ntz[i][a]*t;
+    }
+
+    return P;
+}
+
+const Vector &
+WinklerFoundation3d::getResistingForceIncInertia(void)
+{
+    return this->getResistingForce();
+}
+
+int
+WinklerFoundation3d::sendSelf(int commitTag, Channel &theChannel)
+{
+    int res = 0;
+    int dataTag = this->getDbTag();
+
+    static thread_local ID idData(4);
+    idData(0) = this->getTag();
+    idData(1) = connectedExternalNodes(0);
+    idData(2) = connectedExternalNodes(1);
+    idData(3) = numPoints;
+
+    res += theChannel.sendID(dataTag, commitTag, idData);
+    if (res < 0) {
+      opserr << "WinklerFoundation3d::sendSelf -- failed to send ID data\n";
+      return res;
+    }
+
+    int numMaterials = 2*numPoints;
+    ID classTags(2*numMaterials);
+    for (int i=0; i<numMaterials; i++) {
+      int matDbTag = theMaterials[i]->getDbTag();
+      if (matDbTag == 0) {
+	matDbTag = theChannel.getDbTag();
+	if (matDbTag != 0)
+	  theMaterials[i]->setDbTag(matDbTag);
+      }
+      classTags(i) = matDbTag;
+      classTags(numMaterials+i) = theMaterials[i]->getClassTag();
+    }
+
+    res += theChannel.sendID(dataTag, commitTag, classTags);
+    if (res < 0) {
+      opserr << "WinklerFoundation3d::sendSelf -- failed to send classTags ID\n";
+      return res;
+    }
+
+    for (int i=0; i<numMaterials; i++) {
+      res += theMaterials[i]->sendSelf(commitTag, theChannel);
+      if (res < 0) {
+	opserr << "WinklerFoundation3d::sendSelf -- failed to send material " << i << endln;
+	return res;
+      }
+    }
+
+    return res;
+}
+
+int
+WinklerFoundation3d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    int res = 0;
+    int dataTag = this->getDbTag();
+
+    static thread_local ID idData(4);
+    res += theChannel.recvID(dataTag, commitTag, idData);
+    if (res < 0) {
+      opserr << "WinklerFoundation3d::recvSelf -- failed to receive ID data\n";
+      return res;
+    }
+
+    this->setTag(idData(0));
+    connectedExternalNodes(0) = idData(1);
+    connectedExternalNodes(1) = idData(2);
+
+    if (numPoints != idData(3)) {
+      for (int i=0; i<2*numPoints; i++)
+	if (theMaterials[i] != 0)
+	  delete theMaterials[i];
+      if (theMaterials != 0)
+	delete [] theMaterials;
+
+      numPoints = idData(3);
+      theMaterials = new UniaxialMaterial *[2*numPoints];
+      for (int i=0; i<2*numPoints; i++)
+	theMaterials[i] = 0;
+
+      groundDisp.resize(2*numPoints);
+      trialDeformation.resize(2*numPoints);
+    }
+
+    int numMaterials = 2*numPoints;
+    ID classTags(2*numMaterials);
+    res += theChannel.recvID(dataTag, commitTag, classTags);
+    if (res < 0) {
+      opserr << "WinklerFoundation3d::recvSelf -- failed to receive classTags ID\n";
+      return res;
+    }
+
+    for (int i=0; i<numMaterials; i++) {
+      int matClassTag = classTags(numMaterials+i);
+
+      // a new material from the broker if there is none, or one of the wrong type
+      if (theMaterials[i] != 0 && theMaterials[i]->getClassTag() != matClassTag) {
+	delete theMaterials[i];
+	theMaterials[i] = 0;
+      }
+      if (theMaterials[i] == 0)
+	theMaterials[i] = theBroker.getNewUniaxialMaterial(matClassTag);
+
+      if (theMaterials[i] == 0) {
+	opserr << "WinklerFoundation3d::recvSelf -- failed to allocate new material " << i << endln;
+	return -1;
+      }
+
+      theMaterials[i]->setDbTag(classTags(i));
+      res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
+      if (res < 0) {
+	opserr << "WinklerFoundation3d::recvSelf -- failed to receive material " << i << endln;
+	return res;
+      }
+    }
+
+    return res;
+}
+
+void
+WinklerFoundation3d::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+      s << "Element: " << this->getTag();
+      s << " type: WinklerFoundation3d  iNode: " << connectedExternalNodes(0);
+      s << " jNode: " << connectedExternalNodes(1) << endln;
+      for (int i=0; i<numPoints; i++) {
+	s << "\tIntegration point " << i+1
+	  << ", ground displacement: " << groundDisp(i) << " " << groundDisp(numPoints+i) << endln;
+	s << *(theMaterials[i]);
+	s << *(theMaterials[numPoints+i]);
+      }
+    } else if (flag == 1) {
+      s << this->getTag() << "  " << trialDeformation;
+    }
+}
+
+Response *
+WinklerFoundation3d::setResponse(const char **argv, int argc, OPS_Stream &output)
+{
+    Response *theResponse = 0;
+
+    output.tag("ElementOutput");
+    output.attr("eleType", "WinklerFoundation3d");
+    output.attr("eleTag", this->getTag());
+    output.attr("node1", connectedExternalNodes[0]);
+    output.attr("node2", connectedExternalNodes[1]);
+
+    char outputData[16];   // a letter and any int
+
+    if (strcmp(argv[0],"force") == 0 || strcmp(argv[0],"forces") == 0 ||
+	strcmp(argv[0],"globalForce") == 0 || strcmp(argv[0],"globalForces") == 0) {
+
+      theResponse = new ElementResponse(this, 1, P);
+
+    } else if (strcmp(argv[0],"soilForce") == 0 || strcmp(argv[0],"soilForces") == 0) {
+
+      for (int i=0; i<numPoints; i++) {
+	snprintf(outputData, sizeof(outputData), "p%d", i+1);
+	output.tag("ResponseType", outputData);
+      }
+      for (int i=0; i<numPoints; i++) {
+	snprintf(outputData, sizeof(outputData), "t%d", i+1);
+	output.tag("ResponseType", outputData);
+      }
+      theResponse = new ElementResponse(this, 2, Vector(2*numPoints));
+
+    } else if (strcmp(argv[0],"deformation") == 0 || strcmp(argv[0],"deformations") == 0) {
+
+      for (int i=0; i<numPoints; i++) {
+	snprintf(outputData, sizeof(outputData), "y%d", i+1);
+	output.tag("ResponseType", outputData);
+      }
+      for (int i=0; i<numPoints; i++) {
+	snprintf(outputData, sizeof(outputData), "z%d", i+1);
+	output.tag("ResponseType", outputData);
+      }
+      theResponse = new ElementResponse(this, 3, Vector(2*numPoints));
+
+    } else if (strcmp(argv[0],"material") == 0) {
+      if (argc > 2) {
+	int matNum = atoi(argv[1]);
+	if (matNum >= 1 && matNum <= 2*numPoints)
+	  theResponse = theMaterials[matNum-1]->setResponse(&argv[2], argc-2, output);
+      }
+    }
+
+    output.endTag();
+
+    return theResponse;
+}
+
+int
+WinklerFoundation3d::getResponse(int responseID, Information &eleInformation)
+{
+    switch (responseID) {
+    case 1:
+      return eleInformation.setVector(this->getResistingForce());
+
+    case 2:
+      if (eleInformation.theVector != 0) {
+	for (int i=0; i<2*numPoints; i++)
+	  (*(eleInformation.theVector))(i) = theMaterials[i]->getStress();
+      }
+      return 0;
+
+    case 3:
+      if (eleInformation.theVector != 0) {
+	for (int i=0; i<2*numPoints; i++)
+	  (*(eleInformation.theVector))(i) = theMaterials[i]->getStrain();
+      }
+      return 0;
+
+    default:
+      return -1;
+    }
+}
+
+int
+WinklerFoundation3d::setParameter(const char **argv, int argc, Parameter &param)
+{
+    int result = -1;
+
+    if (argc < 1)
+      return -1;
+
+    if (strcmp(argv[0], "material") == 0) {
+      if (argc > 2) {
+	int matNum = atoi(argv[1]);
+	if (matNum >= 1 && matNum <= 2*numPoints)
+	  return theMaterials[matNum-1]->setParameter(&argv[2], argc-2, param);
+      }
+      return -1;
+    }
+
+    // the p-y and t-z materials of one integration point
+    int first = 0;
+    int last  = numPoints;
+    if (strcmp(argv[0], "point") == 0) {
+      if (argc < 3)
+	return -1;
+      int pointNum = atoi(argv[1]);
+      if (pointNum < 1 || pointNum > numPoints)
+	return -1;
+      first = pointNum-1;
+      last  = pointNum;
+      argv += 2;
+      argc -= 2;
+    }
+
+    // p-y and t-z parameters go to whichever material knows them
+    for (int i=first; i<last; i++) {
+      int res = theMaterials[i]->setParameter(argv, argc, param);
+      if (res != -1)
+	result = res;
+      res = theMaterials[numPoints+i]->setParameter(argv, argc, param);
+      if (res != -1)
+	result = res;
+    }
+
+    return result;
+}
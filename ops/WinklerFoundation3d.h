@@ -0,0 +1,135 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2018-06-25 12:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/winkler/WinklerFoundation3d.h,v $
+
+
+#ifndef WinklerFoundation3d_h
+#define WinklerFoundation3d_h
+
+// Description: This file contains the class definition for WinklerFoundation3d.
+// A WinklerFoundation3d element is the nonlinear Winkler foundation of a
+// vertical beam segment between two 6 dof nodes.  Together with the beam
+// element between the same nodes it forms a beam on a nonlinear Winkler
+// foundation (BNWF).  The soil resistance is integrated along the segment
+// at the Gauss-Legendre points of LegendreBeamIntegration: a p-y material
+// acts along the global x-axis and a t-z material along the global z-axis
+// at each point.  The lateral deformation follows the cubic Hermite shape
+// functions of the beam (u_x and rotation about y), the axial deformation
+// the linear ones.  Each material carries the resistance of the tributary
+// length of its integration point, i.e. its weight times the length.
+//
+// The deformation of a material is the pile displacement less that of the
+// ground, which is zero unless prescribed by GroundDisplacement loads.  The
+// data of such a load holds the ground displacement at all p-y points
+// followed by those at all t-z points.  As for GroundedSpring, a change of
+// the ground displacement enters the resisting force linearised about the
+// last trial state until the next update().
+//
+// What: "@(#) WinklerFoundation3d.h, revA"
+
+#include <Element.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <FixedMatrix.h>
+#include <ID.h>
+
+class Node;
+class Channel;
+class UniaxialMaterial;
+class Response;
+
+class WinklerFoundation3d : public Element
+{
+  public:
+    WinklerFoundation3d(int tag, int nd1, int nd2, int numPoints,
+			UniaxialMaterial **pyMaterials, UniaxialMaterial **tzMaterials);
+    WinklerFoundation3d();
+    ~WinklerFoundation3d();
+
+    const char *getClassType(void) const {return "WinklerFoundation3d";};
+
+    // public methods to obtain inforrmation about dof & connectivity
+    int getNumExternalNodes(void) const;
+    const ID &getExternalNodes(void);
+    Node **getNodePtrs(void);
+
+    int getNumDOF(void);
+    void setDomain(Domain *theDomain);
+
+    // public methods to set the state of the element
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+    int update(void);
+
+    // public methods to obtain stiffness, mass, damping and residual information
+    const Matrix &getTangentStiff(void);
+    const Matrix &getInitialStiff(void);
+    const Matrix &getMass(void);
+
+    void zeroLoad(void);
+    int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int addInertiaLoadToUnbalance(const Vector &accel);
+
+    const Vector &getResistingForce(void);
+    const Vector &getResistingForceIncInertia(void);
+
+    // public methods for element output
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+    Response *setResponse(const char **argv, int argc, OPS_Stream &s);
+    int getResponse(int responseID, Information &eleInformation);
+
+    int setParameter(const char **argv, int argc, Parameter &param);
+
+    // relative locations (0..1) and weights of the integration points
+    static void getPointLocations(int numPoints, double *xi);
+    static void getPointWeights(int numPoints, double *wt);
+
+  protected:
+
+  private:
+    enum {maxNumPoints = 10};
+
+    void computeShapeFunctions(void);
+    void computeDeformations(Vector &def);
+
+    ID  connectedExternalNodes;         // contains the tags of the end nodes
+    Node *theNodes[2];
+
+    FixedMatrix<12,12> K;               // objects own stiffness matrix
+    FixedVector<12> P;                  // objects own resisting force vector
+
+    int numPoints;                      // number of integration points
+    UniaxialMaterial **theMaterials;    // p-y materials followed by the t-z materials
+
+    double Npy[maxNumPoints][4];        // Hermite shape functions at each p-y point
+    double Ntz[maxNumPoints][2];        // linear shape functions at each t-z point
+
+    Vector groundDisp;                  // ground displacement at each material
+    Vector trialDeformation;            // deformation the materials were last set to
+};
+
+#endif
@@ -49,14 +49,6 @@
 #include <vector>
 
 // initialise the class wide variables
-Matrix ZeroLength::ZeroLengthM2(2,2);
-Matrix ZeroLength::ZeroLengthM4(4,4);
-Matrix ZeroLength::ZeroLengthM6(6,6);
-Matrix ZeroLength::ZeroLengthM12(12,12);
-Vector ZeroLength::ZeroLengthV2(2);
-Vector ZeroLength::ZeroLengthV4(4);
-Vector ZeroLength::ZeroLengthV6(6);
-Vector ZeroLength::ZeroLengthV12(12);
 
 void* OPS_ZeroLength()
 {
@@ -238,7 +230,7 @@ ZeroLength::ZeroLength(int tag,
 		       int doRayleigh)
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
-  dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
+  dimension(dim), numDOF(0), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
   numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
@@ -282,7 +274,7 @@ ZeroLength::ZeroLength(int tag,
 		       int direction)
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
-  dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(2),
+  dimension(dim), numDOF(0), useRayleighDamping(2),
   theMatrix(0), theVector(0),
   numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
@@ -333,7 +325,7 @@ ZeroLength::ZeroLength(int tag,
 		       int doRayleigh)
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
-  dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
+  dimension(dim), numDOF(0), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
   numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
@@ -384,7 +376,7 @@ ZeroLength::ZeroLength(int tag,
 		       int doRayleigh)
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
-  dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
+  dimension(dim), numDOF(0), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
   numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
@@ -430,7 +422,7 @@ ZeroLength::ZeroLength(int tag,
 ZeroLength::ZeroLength(void)
   :Element(0,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
-  dimension(0), numDOF(0), transformation(3,3),
+  dimension(0), numDOF(0),
   theMatrix(0), theVector(0),
   numMaterials1d(0), theMaterial1d(0),
   dir1d(0), t1d(0), d0(0), v0(0)
@@ -473,6 +465,11 @@ ZeroLength::~ZeroLength()
 
     if (v0 != 0)
       delete v0;
+
+    if (theMatrix != 0)
+      delete theMatrix;
+    if (theVector != 0)
+      delete theVector;
 }
 
 
@@ -522,8 +519,7 @@ ZeroLength::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &ZeroLengthM2;
-    theVector = &ZeroLengthV2;
+    this->setWorkArea();
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -576,32 +572,22 @@ ZeroLength::setDomain(Domain *theDomain)
     // set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &ZeroLengthM2;
-	theVector = &ZeroLengthV2;
 	elemType  = D1N2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &ZeroLengthM4;
-	theVector = &ZeroLengthV4;
 	elemType  = D2N4;
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
 	elemType  = D2N6;
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
 	elemType  = D3N6;
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &ZeroLengthM12;
-	theVector = &ZeroLengthV12;
 	elemType  = D3N12;
     }
     else {
@@ -610,6 +596,8 @@ ZeroLength::setDomain(Domain *theDomain)
       return;
     }
 
+    this->setWorkArea();
+
     // create the basic deformation-displacement transformation matrix for the element
     // for 1d materials (uniaxial materials)
     if ( numMaterials1d > 0 )
@@ -636,6 +624,27 @@ ZeroLength::setDomain(Domain *theDomain)
 
 
 
+// method: setWorkArea()
+//    allocates the matrix and vector returned by the element for the
+//    current number of dof; each element owns its own so that the
+//    state of several elements may be determined concurrently.
+
+void
+ZeroLength::setWorkArea(void)
+{
+    if (theMatrix != 0 && theMatrix->noRows() == numDOF)
+	return;
+
+    if (theMatrix != 0)
+	delete theMatrix;
+    if (theVector != 0)
+	delete theVector;
+
+    theMatrix = new Matrix(numDOF, numDOF);
+    theVector = new Vector(numDOF);
+}
+
+
 int
 ZeroLength::commitState()
 {
@@ -955,7 +964,7 @@ ZeroLength::sendSelf(int commitTag, Channel &theChannel)
 
 	// Make one size bigger so not a multiple of 3, otherwise will conflict
 	// with classTags ID
-	static ID idData(7);
+	static thread_local ID idData(7);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -1027,7 +1036,7 @@ ZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
   // ZeroLength creates an ID, receives the ID and then sets the 
   // internal data with the data in the ID
 
-  static ID idData(7);
+  static thread_local ID idData(7);
 
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1141,8 +1150,8 @@ ZeroLength::displaySelf(Renderer &theViewer, int displayMode, float fact, const
     if (theNodes[0] == 0 || theNodes[1] == 0 )
        return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     float d1 = 1.0;
     float d2 = 1.0;
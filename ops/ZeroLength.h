@@ -42,6 +42,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <FixedMatrix.h>
 
 // Tolerance for zero length of element
 #define	LENTOL 1.0e-6
@@ -164,18 +165,19 @@ class ZeroLength : public Element
     
     void   setTran1d ( Etype e, int n );
     double computeCurrentStrain1d ( int mat, const Vector& diff ) const;    
+    void   setWorkArea (void);
 
     // private attributes - a copy for each object of the class
     ID  connectedExternalNodes;         // contains the tags of the end nodes
     int dimension;                      // = 1, 2, or 3 dimensions
     int numDOF;	                        // number of dof for ZeroLength
-    Matrix transformation;		// transformation matrix for orientation
+    FixedMatrix<3,3> transformation;	// transformation matrix for orientation
     int useRayleighDamping;
 	
     Node *theNodes[2];
 
-    Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
-    Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Matrix *theMatrix; 	    	// objects own matrix, sized for numDOF
+    Vector *theVector;      	// objects own vector, sized for numDOF
 
     // Storage for uniaxial material models
     int numMaterials1d;			   // number of 1d materials
@@ -187,16 +189,6 @@ class ZeroLength : public Element
     Vector *d0;
     Vector *v0;
 
-    // static data - single copy for all objects of the class	
-    static Matrix ZeroLengthM2;   // class wide matrix for 2*2
-    static Matrix ZeroLengthM4;   // class wide matrix for 4*4
-    static Matrix ZeroLengthM6;   // class wide matrix for 6*6
-    static Matrix ZeroLengthM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthV2;   // class wide Vector for size 2
-    static Vector ZeroLengthV4;   // class wide Vector for size 4
-    static Vector ZeroLengthV6;   // class wide Vector for size 6
-    static Vector ZeroLengthV12;  // class wide Vector for size 12
-
     int mInitialize;  // tag to fix bug in recvSelf/setDomain when using database command
 };
 
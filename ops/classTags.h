@@ -467,6 +467,7 @@
 #define LOAD_TAG_SelfWeight              10 // C.McGann, U.W.
 #define LOAD_TAG_Beam2dThermalAction      11
 #define LOAD_TAG_Beam2dPartialUniformLoad 12
+#define LOAD_TAG_GroundDisplacement      13
 
 
 
@@ -647,6 +648,8 @@
 #define ELE_TAG_PFEMElement2DFIC          164
 #define ELE_TAG_ElastomericBearingBoucWenMod3d 165
 #define ELE_TAG_FPBearingPTV              166
+#define ELE_TAG_GroundedSpring            167
+#define ELE_TAG_WinklerFoundation3d       168
 
 #define FRN_TAG_Coulomb            1
 #define FRN_TAG_VelDependent       2
@@ -699,6 +702,7 @@
 #define CRDTR_TAG_ModerateDispCrdTransf3d 9
 #define CRDTR_TAG_CorotCrdTransf3d  6
 #define CRDTR_TAG_LinearCrdTransf2dInt 7
+#define CRDTR_TAG_VerticalCrdTransf3d 10
 
 #define NOD_TAG_Node      	1
 #define NOD_TAG_DummyNode 	2
@@ -828,6 +832,7 @@
 #define INTEGRATOR_TAGS_PFEMIntegrator                  52
 #define INTEGRATOR_TAGS_KRAlphaExplicit                 53
 #define INTEGRATOR_TAGS_KRAlphaExplicit_TP              54
+#define INTEGRATOR_TAGS_AdaptiveLoadControl             55
 
 #define LinSOE_TAGS_FullGenLinSOE		1
 #define LinSOE_TAGS_BandGenLinSOE		2
@@ -857,6 +862,7 @@
 #define LinSOE_TAGS_PFEMLinSOE 26
 #define LinSOE_TAGS_SProfileSPDLinSOE		27
 #define LinSOE_TAGS_PFEMCompressibleLinSOE 28
+#define LinSOE_TAGS_PileChainLinSOE 29
 
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
@@ -890,6 +896,7 @@
 #define SOLVER_TAGS_CulaSparseS4                        29
 #define SOLVER_TAGS_CulaSparseS5                        30
 #define SOLVER_TAGS_CuSP                                31
+#define SOLVER_TAGS_PileChainLinLapackSolver            32
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2